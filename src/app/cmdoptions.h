@@ -14,12 +14,15 @@ enum class ConvertType {
     Batch,
     ConvertScoreParts,
     ExportScoreMedia,
+    ExportScoreMediaDir,
     ExportScoreMeta,
     ExportScoreParts,
     ExportScorePartsPdf,
     ExportScoreTranspose,
     SourceUpdate,
-    ExportScoreVideo
+    ExportScoreVideo,
+    AudioRenderBenchmark,
+    PartsPdfBenchmark
 };
 
 enum class DiagnosticType {
@@ -27,7 +30,8 @@ enum class DiagnosticType {
     GenDrawData,
     ComDrawData,
     DrawDataToPng,
-    DrawDiffToPng
+    DrawDiffToPng,
+    LayoutProfile
 };
 
 struct CmdOptions {
@@ -38,6 +42,7 @@ struct CmdOptions {
         ScoreTransposeOptions,
         ForceMode,
         SoundProfile,
+        InputFiles,
 
         // Video
     };
@@ -94,6 +94,10 @@ void CommandLineParser::init()
 
     m_parser.addOption(QCommandLineOption("score-media",
                                           "Export all media (excepting mp3) for a given score in a single JSON file and print it to stdout"));
+    m_parser.addOption(QCommandLineOption("score-media-dir",
+                                          "Export all media (excepting mp3) for a given score as separate files with a manifest "
+                                          "to the directory given with '-o <dir>'; files of a previous export to that directory "
+                                          "are only written again if they changed"));
     m_parser.addOption(QCommandLineOption("highlight-config", "Set highlight to svg, generated from a given score", "highlight-config"));
     m_parser.addOption(QCommandLineOption("score-meta", "Export score metadata to JSON document and print it to stdout"));
     m_parser.addOption(QCommandLineOption("score-parts", "Generate parts data for the given score and save them to separate mscz files"));
@@ -103,6 +107,12 @@ void CommandLineParser::init()
                                           "Transpose the given score and export the data to a single JSON file, print it to stdout",
                                           "options"));
     m_parser.addOption(QCommandLineOption("source-update", "Update the source in the given score"));
+    m_parser.addOption(QCommandLineOption("audio-benchmark",
+                                          "Render the given score(s) offline without an audio driver and export audio engine "
+                                          "performance to a single JSON file (use with '-o <file>.json'), or print it to stdout"));
+    m_parser.addOption(QCommandLineOption("parts-pdf-benchmark",
+                                          "Export the score and parts PDFs of the given score(s) as with '--score-parts-pdf' and export "
+                                          "time and memory use to a single JSON file (use with '-o <file>.json'), or print it to stdout"));
 
     m_parser.addOption(QCommandLineOption({ "S", "style" }, "Load style file", "style"));
 
@@ -144,6 +154,8 @@ void CommandLineParser::init()
     m_parser.addOption(QCommandLineOption("diagnostic-com-drawdata", "Compare engraving draw data"));
     m_parser.addOption(QCommandLineOption("diagnostic-drawdata-to-png", "Convert draw data to png", "file"));
     m_parser.addOption(QCommandLineOption("diagnostic-drawdiff-to-png", "Convert draw diff to png"));
+    m_parser.addOption(QCommandLineOption("diagnostic-layout-profile", "Profile the layout of the score, "
+                                                                       "writes a Chrome trace to the diagnostic output", "file"));
 
     // Autobot
     m_parser.addOption(QCommandLineOption("test-case", "Run test case by name or file", "nameOrFile"));
@@ -317,6 +329,19 @@ void CommandLineParser::parse(int argc, char** argv)
         }
     }
 
+    if (m_parser.isSet("score-media-dir")) {
+        m_options.runMode = IApplication::RunMode::ConsoleApp;
+        m_options.converterTask.type = ConvertType::ExportScoreMediaDir;
+        m_options.converterTask.inputFile = scorefiles[0];
+        if (m_parser.isSet("highlight-config")) {
+            m_options.converterTask.params[CmdOptions::ParamKey::HighlightConfigPath]
+                = fromUserInputPath(m_parser.value("highlight-config"));
+        }
+        if (m_options.converterTask.outputFile.isEmpty()) {
+            LOGE() << "Option: --score-media-dir no output directory specified";
+        }
+    }
+
     if (m_parser.isSet("score-meta")) {
         m_options.runMode = IApplication::RunMode::ConsoleApp;
         m_options.converterTask.type = ConvertType::ExportScoreMeta;
@@ -356,6 +381,24 @@ void CommandLineParser::parse(int argc, char** argv)
         }
     }
 
+    if (m_parser.isSet("audio-benchmark")) {
+        m_options.runMode = IApplication::RunMode::ConsoleApp;
+        m_options.converterTask.type = ConvertType::AudioRenderBenchmark;
+        m_options.converterTask.params[CmdOptions::ParamKey::InputFiles] = scorefiles;
+        if (scorefiles.empty()) {
+            LOGE() << "Option: --audio-benchmark no input file specified";
+        }
+    }
+
+    if (m_parser.isSet("parts-pdf-benchmark")) {
+        m_options.runMode = IApplication::RunMode::ConsoleApp;
+        m_options.converterTask.type = ConvertType::PartsPdfBenchmark;
+        m_options.converterTask.params[CmdOptions::ParamKey::InputFiles] = scorefiles;
+        if (scorefiles.empty()) {
+            LOGE() << "Option: --parts-pdf-benchmark no input file specified";
+        }
+    }
+
     // MusicXML
     if (m_parser.isSet("musicxml-use-default-font")) {
         m_options.importMusicXML.useDefaultFont = true;
@@ -463,6 +506,12 @@ void CommandLineParser::parse(int argc, char** argv)
         m_options.diagnostic.input = scorefiles;
     }
 
+    if (m_parser.isSet("diagnostic-layout-profile")) {
+        m_options.runMode = IApplication::RunMode::ConsoleApp;
+        m_options.diagnostic.type = DiagnosticType::LayoutProfile;
+        m_options.diagnostic.input << m_parser.value("diagnostic-layout-profile");
+    }
+
     // Autobot
     if (m_parser.isSet("test-case")) {
         m_options.runMode = IApplication::RunMode::ConsoleApp;
@@ -287,6 +287,10 @@ int ConsoleApp::processConverter(const CmdOptions::ConverterTask& task)
         muse::io::path_t highlightConfigPath = task.params[CmdOptions::ParamKey::HighlightConfigPath].toString();
         ret = converter()->exportScoreMedia(task.inputFile, task.outputFile, highlightConfigPath, stylePath, forceMode);
     } break;
+    case ConvertType::ExportScoreMediaDir: {
+        muse::io::path_t highlightConfigPath = task.params[CmdOptions::ParamKey::HighlightConfigPath].toString();
+        ret = converter()->exportScoreMediaDir(task.inputFile, task.outputFile, highlightConfigPath, stylePath, forceMode);
+    } break;
     case ConvertType::ExportScoreMeta:
         ret = converter()->exportScoreMeta(task.inputFile, task.outputFile, stylePath, forceMode);
         break;
@@ -303,6 +307,20 @@ int ConsoleApp::processConverter(const CmdOptions::ConverterTask& task)
     case ConvertType::ExportScoreVideo: {
         ret = converter()->exportScoreVideo(task.inputFile, task.outputFile);
     } break;
+    case ConvertType::AudioRenderBenchmark: {
+        std::vector<muse::io::path_t> inputFiles;
+        for (const QString& file : task.params[CmdOptions::ParamKey::InputFiles].toStringList()) {
+            inputFiles.push_back(file);
+        }
+        ret = converter()->benchmarkAudioRender(inputFiles, task.outputFile);
+    } break;
+    case ConvertType::PartsPdfBenchmark: {
+        std::vector<muse::io::path_t> inputFiles;
+        for (const QString& file : task.params[CmdOptions::ParamKey::InputFiles].toStringList()) {
+            inputFiles.push_back(file);
+        }
+        ret = converter()->benchmarkScorePartsPdfs(inputFiles, task.outputFile, stylePath, forceMode);
+    } break;
     case ConvertType::SourceUpdate: {
         std::string scoreSource = task.params[CmdOptions::ParamKey::ScoreSource].toString().toStdString();
         ret = converter()->updateSource(task.inputFile, scoreSource, forceMode);
@@ -360,6 +378,12 @@ int ConsoleApp::processDiagnostic(const CmdOptions::Diagnostic& task)
         }
         ret = diagnosticDrawProvider()->drawDiffToPng(diffPath, refPath, output);
     } break;
+    case DiagnosticType::LayoutProfile:
+        if (task.output.isEmpty()) {
+            output = io::completeBasename(input.front()) + ".trace.json";
+        }
+        ret = diagnosticDrawProvider()->profileLayout(input.front(), output);
+        break;
     default:
         break;
     }
@@ -375,7 +375,10 @@ MenuItem* AppMenuModel::makeDiagnosticMenu()
             makeMenuItem("color-segment-shapes"),
             makeMenuItem("show-skylines"),
             makeMenuItem("show-system-bounding-rects"),
-            makeMenuItem("show-corrupted-measures")
+            makeMenuItem("show-corrupted-measures"),
+            makeSeparator(),
+            makeMenuItem("record-layout-profile"),
+            makeMenuItem("save-layout-profile")
         };
 
         MenuItemList autobotItems {
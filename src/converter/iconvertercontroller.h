@@ -22,6 +22,8 @@
 #ifndef MU_CONVERTER_ICONVERTERCONTROLLER_H
 #define MU_CONVERTER_ICONVERTERCONTROLLER_H
 
+#include <vector>
+
 #include "modularity/imoduleinterface.h"
 #include "types/ret.h"
 #include "io/path.h"
@@ -46,6 +48,9 @@ public:
     virtual muse::Ret exportScoreMedia(const muse::io::path_t& in, const muse::io::path_t& out,
                                        const muse::io::path_t& highlightConfigPath = muse::io::path_t(),
                                        const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) = 0;
+    virtual muse::Ret exportScoreMediaDir(const muse::io::path_t& in, const muse::io::path_t& outDir,
+                                          const muse::io::path_t& highlightConfigPath = muse::io::path_t(),
+                                          const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) = 0;
     virtual muse::Ret exportScoreMeta(const muse::io::path_t& in, const muse::io::path_t& out,
                                       const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) = 0;
     virtual muse::Ret exportScoreParts(const muse::io::path_t& in, const muse::io::path_t& out,
@@ -57,6 +62,10 @@ public:
 
     virtual muse::Ret exportScoreVideo(const muse::io::path_t& in, const muse::io::path_t& out) = 0;
 
+    virtual muse::Ret benchmarkAudioRender(const std::vector<muse::io::path_t>& in, const muse::io::path_t& out) = 0;
+    virtual muse::Ret benchmarkScorePartsPdfs(const std::vector<muse::io::path_t>& in, const muse::io::path_t& out,
+                                              const muse::io::path_t& stylePath = "", bool forceMode = false) = 0;
+
     virtual muse::Ret updateSource(const muse::io::path_t& in, const std::string& newSource, bool forceMode = false) = 0;
 };
 }
@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "artifactwritedevice.h"
+
+#include "log.h"
+
+using namespace mu::converter;
+using namespace muse;
+using namespace muse::io;
+
+ArtifactWriteDevice::ArtifactWriteDevice(const path_t& filePath)
+    : m_file(filePath.toQString()), m_hash(QCryptographicHash::Sha256)
+{
+}
+
+bool ArtifactWriteDevice::commit()
+{
+    if (!m_file.commit()) {
+        LOGE() << "failed write: " << m_file.fileName().toStdString() << ", error: " << m_file.errorString().toStdString();
+        return false;
+    }
+
+    return true;
+}
+
+std::string ArtifactWriteDevice::hash() const
+{
+    return m_hash.result().toHex().toStdString();
+}
+
+size_t ArtifactWriteDevice::written() const
+{
+    return m_written;
+}
+
+bool ArtifactWriteDevice::doOpen(OpenMode m)
+{
+    if (m != OpenMode::WriteOnly) {
+        return false;
+    }
+
+    return m_file.open(QIODevice::WriteOnly);
+}
+
+size_t ArtifactWriteDevice::dataSize() const
+{
+    return m_size;
+}
+
+const uint8_t* ArtifactWriteDevice::rawData() const
+{
+    return nullptr;
+}
+
+bool ArtifactWriteDevice::resizeData(size_t size)
+{
+    m_size = size;
+    return true;
+}
+
+size_t ArtifactWriteDevice::writeData(const uint8_t* data, size_t len)
+{
+    IF_ASSERT_FAILED(pos() == m_written) {
+        return 0;
+    }
+
+    const qint64 written = m_file.write(reinterpret_cast<const char*>(data), static_cast<qint64>(len));
+    if (written != static_cast<qint64>(len)) {
+        m_file.cancelWriting();
+        return 0;
+    }
+
+    m_hash.addData(QByteArrayView(reinterpret_cast<const char*>(data), static_cast<qsizetype>(len)));
+    m_written += len;
+
+    return len;
+}
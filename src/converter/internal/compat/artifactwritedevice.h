@@ -0,0 +1,59 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_CONVERTER_ARTIFACTWRITEDEVICE_H
+#define MU_CONVERTER_ARTIFACTWRITEDEVICE_H
+
+#include <QCryptographicHash>
+#include <QSaveFile>
+
+#include "io/iodevice.h"
+#include "io/path.h"
+
+namespace mu::converter {
+//! NOTE Write only device, which writes straight to a file (replacing it only on commit)
+//! and computes the SHA-256 of the content on the way. Only sequential writes are supported
+class ArtifactWriteDevice : public muse::io::IODevice
+{
+public:
+    explicit ArtifactWriteDevice(const muse::io::path_t& filePath);
+
+    bool commit();
+
+    std::string hash() const; // hex
+    size_t written() const;
+
+protected:
+    bool doOpen(OpenMode m) override;
+    size_t dataSize() const override;
+    const uint8_t* rawData() const override;
+    bool resizeData(size_t size) override;
+    size_t writeData(const uint8_t* data, size_t len) override;
+
+private:
+    QSaveFile m_file;
+    QCryptographicHash m_hash;
+    size_t m_size = 0;
+    size_t m_written = 0;
+};
+}
+
+#endif // MU_CONVERTER_ARTIFACTWRITEDEVICE_H
@@ -21,6 +21,8 @@
  */
 #include "backendapi.h"
 
+#include <algorithm>
+#include <numeric>
 #include <stdio.h>
 
 #include <QString>
@@ -29,14 +31,22 @@
 #include <QJsonArray>
 #include <QJsonValue>
 #include <QRandomGenerator>
+#include <QCryptographicHash>
 
 #include "io/buffer.h"
 
+#include "draw/bufferedpaintprovider.h"
+#include "draw/painter.h"
+#include "draw/utils/drawdatajson.h"
+
 #include "engraving/infrastructure/mscwriter.h"
 #include "engraving/dom/excerpt.h"
+#include "engraving/dom/mscore.h"
 #include "engraving/rw/mscsaver.h"
 
+#include "artifactwritedevice.h"
 #include "backendjsonwriter.h"
+#include "base64writedevice.h"
 #include "notationmeta.h"
 
 #include "log.h"
@@ -62,9 +72,38 @@ static const std::string MUSICXML_JSON_NAME = "mxml";
 static const std::string META_DATA_NAME = "metadata";
 static const std::string DEV_INFO_NAME = "devinfo";
 
+static const std::string MEDIA_MANIFEST_NAME = "manifest.json";
+static const std::string MEDIA_PAGES_DIR = "pages";
+static constexpr int MEDIA_MANIFEST_VERSION = 1;
+
 static constexpr bool ADD_SEPARATOR = true;
 static constexpr auto NO_STYLE = "";
 
+static QByteArray jsonString(const QString& str)
+{
+    QByteArray array = QJsonDocument(QJsonArray { str }).toJson(QJsonDocument::Compact);
+    return array.mid(1, array.size() - 2);
+}
+
+static std::string sha256(const std::vector<QByteArray>& parts)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    for (const QByteArray& part : parts) {
+        // the sizes keep the boundaries between the parts
+        hash.addData(QByteArray::number(part.size()));
+        hash.addData(part);
+    }
+
+    return hash.result().toHex().toStdString();
+}
+
+static Base64WriteDevice::Sink deviceSink(QIODevice* device)
+{
+    return [device](const char* data, size_t len) {
+        return device->write(data, static_cast<qint64>(len)) == static_cast<qint64>(len);
+    };
+}
+
 Ret BackendApi::exportScoreMedia(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& highlightConfigPath,
                                  const muse::io::path_t& stylePath,
                                  bool forceMode)
@@ -100,6 +139,126 @@ Ret BackendApi::exportScoreMedia(const muse::io::path_t& in, const muse::io::pat
     return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
+Ret BackendApi::exportScoreMediaDir(const muse::io::path_t& in, const muse::io::path_t& outDir, const muse::io::path_t& highlightConfigPath,
+                                    const muse::io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC
+
+    RetVal<INotationProjectPtr> prj = openProject(in, stylePath, forceMode);
+    if (!prj.ret) {
+        return prj.ret;
+    }
+
+    INotationPtr notation = prj.val->masterNotation()->notation();
+
+    Ret ret = fileSystem()->makePath(outDir + "/" + MEDIA_PAGES_DIR.c_str());
+    if (!ret) {
+        return ret;
+    }
+
+    auto readFileData = [](const muse::io::path_t& path) {
+        return path.empty() ? QByteArray() : fileSystem()->readFile(path).val.toQByteArray();
+    };
+
+    //! NOTE Everything depends on the app version, the score file and the style
+    const QByteArray version = String("%1(%2)").arg(application()->fullVersion().toString(),
+                                                    application()->revision()).toQString().toUtf8();
+    const std::string scoreInputHash = sha256({ version, readFileData(in), readFileData(stylePath) });
+    const QByteArray highlightConfig = readFileData(highlightConfigPath);
+
+    const MediaManifest previous = readMediaManifest(outDir + "/" + MEDIA_MANIFEST_NAME.c_str());
+    std::vector<MediaArtifact> artifacts;
+
+    //! NOTE The input of a page image is what is painted on the page, so that after a change to the score
+    //! only the pages that look different are written again. Pages are only painted for this when the score changed
+    std::vector<std::string> fingerprints;
+    auto pageInputHash = [&](const std::string& name, size_t pageIndex, const QByteArray& extra) {
+        if (previous.scoreInputHash == scoreInputHash) {
+            auto it = previous.artifacts.find(name);
+            if (it != previous.artifacts.end()) {
+                return it->second.inputHash;
+            }
+        }
+
+        if (fingerprints.empty()) {
+            fingerprints = pageFingerprints(notation);
+        }
+
+        return sha256({ version, QByteArray::fromStdString(fingerprints.at(pageIndex)), extra });
+    };
+
+    bool result = true;
+
+    INotationWriter::Options pngOptions {
+        { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) }
+    };
+
+    result &= exportMediaPages(PNG_WRITER_NAME, notation, pngOptions, outDir, previous, [&](const std::string& name, size_t pageIndex) {
+        return pageInputHash(name, pageIndex, QByteArray());
+    }, artifacts);
+
+    INotationWriter::Options svgOptions {
+        { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) },
+        { INotationWriter::OptionKey::BEATS_COLORS, Val::fromQVariant(readBeatsColors(highlightConfigPath)) },
+        { INotationWriter::OptionKey::ELEMENT_IDS, Val(true) }
+    };
+
+    result &= exportMediaPages(SVG_WRITER_NAME, notation, svgOptions, outDir, previous, [&](const std::string& name, size_t pageIndex) {
+        return pageInputHash(name, pageIndex, highlightConfig);
+    }, artifacts);
+
+    struct WriterArtifact {
+        std::string name;
+        std::string writerName;
+        INotationWriter::Options options;
+    };
+
+    const std::vector<WriterArtifact> writerArtifacts {
+        { "spos.xml", SEGMENTS_POSITIONS_WRITER_NAME, {} },
+        { "mpos.xml", MEASURES_POSITIONS_WRITER_NAME, {} },
+        { "score.pdf", PDF_WRITER_NAME, { { INotationWriter::OptionKey::STREAM_OUTPUT, Val(true) } } },
+        { "score.mid", MIDI_WRITER_NAME, {} },
+        { "score.mxl", MUSICXML_WRITER_NAME, {} },
+    };
+
+    for (const WriterArtifact& wa : writerArtifacts) {
+        result &= exportMediaArtifact(wa.name, wa.writerName, sha256({ QByteArray::fromStdString(scoreInputHash),
+                                                                      QByteArray::fromStdString(wa.name) }),
+                                      outDir, previous, [&](IODevice& device) {
+            return processWriter(wa.writerName, notation, wa.options, device);
+        }, artifacts);
+    }
+
+    const std::string metaName = "metadata.json";
+    result &= exportMediaArtifact(metaName, META_DATA_NAME, sha256({ QByteArray::fromStdString(scoreInputHash),
+                                                                      QByteArray::fromStdString(metaName) }),
+                                  outDir, previous, [&](IODevice& device) {
+        RetVal<std::string> meta = NotationMeta::metaJson(notation);
+        if (!meta.ret) {
+            return meta.ret;
+        }
+
+        const size_t size = meta.val.size();
+        return device.write(reinterpret_cast<const uint8_t*>(meta.val.data()), size) == size
+               ? make_ok() : make_ret(Ret::Code::InternalError);
+    }, artifacts);
+
+    // Remove what a previous export wrote, but this one didn't (e.g. removed pages)
+    for (const auto& pair : previous.artifacts) {
+        auto it = std::find_if(artifacts.cbegin(), artifacts.cend(), [&pair](const MediaArtifact& artifact) {
+            return artifact.name == pair.first;
+        });
+
+        if (it == artifacts.cend()) {
+            fileSystem()->remove(outDir + "/" + pair.first.c_str());
+        }
+    }
+
+    result &= writeMediaManifest(outDir + "/" + MEDIA_MANIFEST_NAME.c_str(), scoreInputHash, pages(notation).size(), artifacts);
+
+    return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
+}
+
 Ret BackendApi::exportScoreMeta(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& stylePath, bool forceMode)
 {
     TRACEFUNC
@@ -145,23 +304,31 @@ Ret BackendApi::exportScorePartsPdfs(const muse::io::path_t& in, const muse::io:
 {
     TRACEFUNC
 
-    RetVal<INotationProjectPtr> prj = openProject(in, stylePath, forceMode);
-    if (!prj.ret) {
-        return prj.ret;
-    }
-
     QFile outputFile;
     openOutputFile(outputFile, out);
 
-    std::string scoreFileName = io::dirpath(in).toStdString() + "/" + io::filename(in, false).toStdString() + ".pdf";
-
-    Ret ret = doExportScorePartsPdfs(prj.val->masterNotation(), outputFile, scoreFileName);
+    Ret ret = exportScorePartsPdfs(in, outputFile, stylePath, forceMode);
 
     outputFile.close();
 
     return ret;
 }
 
+Ret BackendApi::exportScorePartsPdfs(const muse::io::path_t& in, QIODevice& destinationDevice, const muse::io::path_t& stylePath,
+                                     bool forceMode)
+{
+    TRACEFUNC
+
+    RetVal<INotationProjectPtr> prj = openProject(in, stylePath, forceMode);
+    if (!prj.ret) {
+        return prj.ret;
+    }
+
+    std::string scoreFileName = io::dirpath(in).toStdString() + "/" + io::filename(in, false).toStdString() + ".pdf";
+
+    return doExportScorePartsPdfs(prj.val->masterNotation(), destinationDevice, scoreFileName);
+}
+
 Ret BackendApi::exportScoreTranspose(const muse::io::path_t& in, const muse::io::path_t& out, const std::string& optionsJson,
                                      const muse::io::path_t& stylePath,
                                      bool forceMode)
@@ -292,32 +459,29 @@ Ret BackendApi::exportScorePngs(const INotationPtr notation, BackendJsonWriter&
     jsonWriter.addKey("pngs");
     jsonWriter.openArray();
 
-    PageList notationPages = pages(notation);
-
-    bool result = true;
-    for (size_t i = 0; i < notationPages.size(); ++i) {
-        ByteArray pngData;
-        Buffer pngDevice(&pngData);
-        pngDevice.open(IODevice::ReadWrite);
-
-        INotationWriter::Options options = {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-            { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) }
-        };
+    const size_t pageCount = pages(notation).size();
+    std::vector<size_t> pageIndexes(pageCount);
+    std::iota(pageIndexes.begin(), pageIndexes.end(), 0);
 
-        Ret writeRet = pngWriter->write(notation, pngDevice, options);
-        if (!writeRet) {
-            LOGW() << writeRet.toString();
-            result = false;
-        }
+    INotationWriter::Options options = {
+        { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) }
+    };
 
-        bool lastArrayValue = ((notationPages.size() - 1) == i);
+    //! NOTE The writer sets up the score once for all the pages, they are added here in page order
+    auto addPage = [&jsonWriter, pageCount](size_t pageIndex, const ByteArray& pngData) {
+        bool lastArrayValue = ((pageCount - 1) == pageIndex);
         jsonWriter.addValue(pngData.toQByteArrayNoCopy().toBase64(), !lastArrayValue);
+        return make_ok();
+    };
+
+    Ret writeRet = pngWriter->writePages(notation, pageIndexes, addPage, options);
+    if (!writeRet) {
+        LOGW() << writeRet.toString();
     }
 
     jsonWriter.closeArray(addSeparator);
 
-    return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
+    return writeRet ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
 Ret BackendApi::exportScoreSvgs(const INotationPtr notation, const muse::io::path_t& highlightConfigPath, BackendJsonWriter& jsonWriter,
@@ -334,34 +498,32 @@ Ret BackendApi::exportScoreSvgs(const INotationPtr notation, const muse::io::pat
     jsonWriter.addKey("svgs");
     jsonWriter.openArray();
 
-    PageList notationPages = pages(notation);
-    QVariantMap beatsColors = readBeatsColors(highlightConfigPath);
+    const size_t pageCount = pages(notation).size();
+    std::vector<size_t> pageIndexes(pageCount);
+    std::iota(pageIndexes.begin(), pageIndexes.end(), 0);
 
-    bool result = true;
-    for (size_t i = 0; i < notationPages.size(); ++i) {
-        ByteArray svgData;
-        Buffer svgDevice(&svgData);
-        svgDevice.open(IODevice::ReadWrite);
-
-        INotationWriter::Options options {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-            { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) },
-            { INotationWriter::OptionKey::BEATS_COLORS, Val::fromQVariant(beatsColors) }
-        };
+    QVariantMap beatsColors = readBeatsColors(highlightConfigPath);
 
-        Ret writeRet = svgWriter->write(notation, svgDevice, options);
-        if (!writeRet) {
-            LOGW() << writeRet.toString();
-            result = false;
-        }
+    INotationWriter::Options options {
+        { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) },
+        { INotationWriter::OptionKey::BEATS_COLORS, Val::fromQVariant(beatsColors) }
+    };
 
-        bool lastArrayValue = ((notationPages.size() - 1) == i);
+    //! NOTE The writer sets up the score once for all the pages, they are added here in page order
+    auto addPage = [&jsonWriter, pageCount](size_t pageIndex, const ByteArray& svgData) {
+        bool lastArrayValue = ((pageCount - 1) == pageIndex);
         jsonWriter.addValue(svgData.toQByteArrayNoCopy().toBase64(), !lastArrayValue);
+        return make_ok();
+    };
+
+    Ret writeRet = svgWriter->writePages(notation, pageIndexes, addPage, options);
+    if (!writeRet) {
+        LOGW() << writeRet.toString();
     }
 
     jsonWriter.closeArray(addSeparator);
 
-    return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
+    return writeRet ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
 Ret BackendApi::exportScoreElementsPositions(const std::string& elementsPositionsWriterName, const std::string& elementsPositionsTagName,
@@ -384,15 +546,20 @@ Ret BackendApi::exportScorePdf(const INotationPtr notation, BackendJsonWriter& j
 {
     TRACEFUNC
 
-    RetVal<QByteArray> writerRetVal = processWriter(PDF_WRITER_NAME, notation);
-    if (!writerRetVal.ret) {
-        return writerRetVal.ret;
-    }
+    INotationWriter::Options options {
+        { INotationWriter::OptionKey::UNIT_TYPE, Val(INotationWriter::UnitType::PER_PART) },
+        { INotationWriter::OptionKey::STREAM_OUTPUT, Val(true) }
+    };
+
+    Ret ret = make_ret(Ret::Code::Ok);
 
     jsonWriter.addKey(PDF_WRITER_NAME.c_str());
-    jsonWriter.addValue(writerRetVal.val, addSeparator);
+    jsonWriter.addStreamedValue([&](QIODevice* device) {
+        ret = processWriter(PDF_WRITER_NAME, { notation }, options, deviceSink(device));
+        return ret.success();
+    }, addSeparator);
 
-    return make_ret(Ret::Code::Ok);
+    return ret;
 }
 
 Ret BackendApi::exportScorePdf(const INotationPtr notation, QIODevice& destinationDevice)
@@ -472,6 +639,232 @@ Ret BackendApi::devInfo(const notation::INotationPtr notation, BackendJsonWriter
     return make_ret(Ret::Code::Ok);
 }
 
+BackendApi::MediaManifest BackendApi::readMediaManifest(const muse::io::path_t& path)
+{
+    MediaManifest manifest;
+
+    if (!fileSystem()->exists(path)) {
+        return manifest;
+    }
+
+    RetVal<ByteArray> data = fileSystem()->readFile(path);
+    if (!data.ret) {
+        LOGW() << data.ret.toString();
+        return manifest;
+    }
+
+    const QJsonObject root = QJsonDocument::fromJson(data.val.toQByteArrayNoCopy()).object();
+    if (root.value("version").toInt() != MEDIA_MANIFEST_VERSION) {
+        return manifest;
+    }
+
+    manifest.scoreInputHash = root.value("scoreInputHash").toString().toStdString();
+
+    for (const QJsonValue artifactVal : root.value("artifacts").toArray()) {
+        const QJsonObject artifactObj = artifactVal.toObject();
+
+        MediaArtifact artifact;
+        artifact.name = artifactObj.value("name").toString().toStdString();
+        artifact.type = artifactObj.value("type").toString().toStdString();
+        artifact.page = artifactObj.value("page").toInt(-1);
+        artifact.inputHash = artifactObj.value("inputHash").toString().toStdString();
+        artifact.hash = artifactObj.value("hash").toString().toStdString();
+        artifact.size = static_cast<size_t>(artifactObj.value("size").toInteger());
+
+        manifest.artifacts[artifact.name] = artifact;
+    }
+
+    return manifest;
+}
+
+Ret BackendApi::writeMediaManifest(const muse::io::path_t& path, const std::string& scoreInputHash, size_t pageCount,
+                                   const std::vector<MediaArtifact>& artifacts)
+{
+    QJsonArray artifactList;
+    for (const MediaArtifact& artifact : artifacts) {
+        QJsonObject artifactObj;
+        artifactObj["name"] = QString::fromStdString(artifact.name);
+        artifactObj["type"] = QString::fromStdString(artifact.type);
+        if (artifact.page >= 0) {
+            artifactObj["page"] = artifact.page;
+        }
+        artifactObj["inputHash"] = QString::fromStdString(artifact.inputHash);
+        artifactObj["hash"] = QString::fromStdString(artifact.hash);
+        artifactObj["size"] = static_cast<qint64>(artifact.size);
+
+        artifactList << artifactObj;
+    }
+
+    QJsonObject root;
+    root["version"] = MEDIA_MANIFEST_VERSION;
+    root["generator"] = String("%1(%2)").arg(application()->fullVersion().toString(), application()->revision()).toQString();
+    root["scoreInputHash"] = QString::fromStdString(scoreInputHash);
+    root["pageCount"] = static_cast<qint64>(pageCount);
+    root["artifacts"] = artifactList;
+
+    ArtifactWriteDevice device(path);
+    if (!device.open(IODevice::WriteOnly)) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    const QByteArray json = QJsonDocument(root).toJson();
+    if (device.write(json) != static_cast<size_t>(json.size()) || !device.commit()) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
+bool BackendApi::isMediaArtifactUpToDate(const MediaManifest& previous, const muse::io::path_t& outDir, const MediaArtifact& artifact)
+{
+    auto it = previous.artifacts.find(artifact.name);
+    if (it == previous.artifacts.end()) {
+        return false;
+    }
+
+    const MediaArtifact& previousArtifact = it->second;
+    if (previousArtifact.inputHash != artifact.inputHash || previousArtifact.hash.empty()) {
+        return false;
+    }
+
+    //! NOTE Only a cheap check that the file is still the one that was written
+    RetVal<uint64_t> size = fileSystem()->fileSize(outDir + "/" + artifact.name.c_str());
+    return size.ret && size.val == previousArtifact.size;
+}
+
+std::vector<std::string> BackendApi::pageFingerprints(const INotationPtr notation)
+{
+    TRACEFUNC
+
+    std::vector<std::string> fingerprints;
+
+    const int pageCount = notation->painting()->pageCount();
+    for (int pageIndex = 0; pageIndex < pageCount; ++pageIndex) {
+        auto provider = std::make_shared<muse::draw::BufferedPaintProvider>();
+
+        {
+            muse::draw::Painter painter(provider, "fingerprint");
+
+            INotationPainting::Options opt;
+            opt.fromPage = pageIndex;
+            opt.toPage = pageIndex;
+            opt.deviceDpi = mu::engraving::DPI;
+            opt.printPageBackground = false;
+
+            notation->painting()->paintPrint(&painter, opt);
+            painter.endDraw();
+        }
+
+        const ByteArray json = muse::draw::DrawDataJson::toJson(provider->drawData(), false);
+        fingerprints.push_back(sha256({ json.toQByteArrayNoCopy() }));
+    }
+
+    return fingerprints;
+}
+
+Ret BackendApi::exportMediaPages(const std::string& writerName, const INotationPtr notation, const INotationWriter::Options& options,
+                                 const muse::io::path_t& outDir, const MediaManifest& previous, const PageInputHash& inputHash,
+                                 std::vector<MediaArtifact>& artifacts)
+{
+    TRACEFUNC
+
+    auto writer = writers()->writer(writerName);
+    if (!writer) {
+        LOGW() << "Not found writer " << writerName;
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    const size_t pageCount = pages(notation).size();
+
+    std::vector<MediaArtifact> pageArtifacts(pageCount);
+    std::vector<size_t> pageIndexes;
+
+    for (size_t pageIndex = 0; pageIndex < pageCount; ++pageIndex) {
+        MediaArtifact& artifact = pageArtifacts[pageIndex];
+        artifact.name = MEDIA_PAGES_DIR + "/" + std::to_string(pageIndex) + "." + writerName;
+        artifact.type = writerName;
+        artifact.page = static_cast<int>(pageIndex);
+        artifact.inputHash = inputHash(artifact.name, pageIndex);
+
+        if (isMediaArtifactUpToDate(previous, outDir, artifact)) {
+            artifact = previous.artifacts.at(artifact.name);
+        } else {
+            pageIndexes.push_back(pageIndex);
+        }
+    }
+
+    Ret ret = make_ret(Ret::Code::Ok);
+
+    if (!pageIndexes.empty()) {
+        //! NOTE Each page is written to its file as soon as it is painted
+        auto writePage = [&pageArtifacts, &outDir](size_t pageIndex, const ByteArray& data) {
+            MediaArtifact& artifact = pageArtifacts.at(pageIndex);
+
+            ArtifactWriteDevice device(outDir + "/" + artifact.name.c_str());
+            if (!device.open(IODevice::WriteOnly) || device.write(data) != data.size() || !device.commit()) {
+                return make_ret(Ret::Code::InternalError);
+            }
+
+            artifact.hash = device.hash();
+            artifact.size = device.written();
+
+            return make_ok();
+        };
+
+        ret = writer->writePages(notation, pageIndexes, writePage, options);
+        if (!ret) {
+            LOGW() << ret.toString();
+        }
+    }
+
+    // Pages which were not written (after an error) are left out, so they are written next time
+    for (const MediaArtifact& artifact : pageArtifacts) {
+        if (!artifact.hash.empty()) {
+            artifacts.push_back(artifact);
+        }
+    }
+
+    return ret;
+}
+
+Ret BackendApi::exportMediaArtifact(const std::string& name, const std::string& type, const std::string& inputHash,
+                                    const muse::io::path_t& outDir, const MediaManifest& previous, const WriteArtifact& write,
+                                    std::vector<MediaArtifact>& artifacts)
+{
+    TRACEFUNC
+
+    MediaArtifact artifact;
+    artifact.name = name;
+    artifact.type = type;
+    artifact.inputHash = inputHash;
+
+    if (isMediaArtifactUpToDate(previous, outDir, artifact)) {
+        artifacts.push_back(previous.artifacts.at(name));
+        return make_ret(Ret::Code::Ok);
+    }
+
+    ArtifactWriteDevice device(outDir + "/" + name.c_str());
+    if (!device.open(IODevice::WriteOnly)) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    Ret ret = write(device);
+    if (ret && !device.commit()) {
+        ret = make_ret(Ret::Code::InternalError);
+    }
+
+    if (!ret) {
+        LOGW() << "failed export " << name << ": " << ret.toString();
+        return ret;
+    }
+
+    artifact.hash = device.hash();
+    artifact.size = device.written();
+    artifacts.push_back(artifact);
+
+    return make_ret(Ret::Code::Ok);
+}
+
 RetVal<QByteArray> BackendApi::processWriter(const std::string& writerName, const INotationPtr notation)
 {
     auto writer = writers()->writer(writerName);
@@ -499,8 +892,8 @@ RetVal<QByteArray> BackendApi::processWriter(const std::string& writerName, cons
     return result;
 }
 
-RetVal<QByteArray> BackendApi::processWriter(const std::string& writerName, const INotationPtrList notations,
-                                             const INotationWriter::Options& options)
+Ret BackendApi::processWriter(const std::string& writerName, const INotationPtr notation, const INotationWriter::Options& options,
+                              IODevice& device)
 {
     auto writer = writers()->writer(writerName);
     if (!writer) {
@@ -508,23 +901,40 @@ RetVal<QByteArray> BackendApi::processWriter(const std::string& writerName, cons
         return make_ret(Ret::Code::InternalError);
     }
 
-    ByteArray data;
-    Buffer device(&data);
-    device.open(IODevice::ReadWrite);
+    Ret writeRet = writer->write(notation, device, options);
+    if (!writeRet) {
+        LOGW() << writeRet.toString();
+    }
+
+    return writeRet;
+}
 
-    Ret writeRet = writer->writeList(notations, device, options);
+Ret BackendApi::processWriter(const std::string& writerName, const INotationPtrList& notations, const INotationWriter::Options& options,
+                              const Base64WriteDevice::Sink& base64Sink)
+{
+    auto writer = writers()->writer(writerName);
+    if (!writer) {
+        LOGW() << "Not found writer " << writerName;
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    Base64WriteDevice device(base64Sink);
+    device.open(IODevice::WriteOnly);
+
+    const bool multiPart = muse::value(options, INotationWriter::OptionKey::UNIT_TYPE, Val(INotationWriter::UnitType::PER_PART))
+                           .toEnum<INotationWriter::UnitType>() == INotationWriter::UnitType::MULTI_PART;
+
+    Ret writeRet = multiPart ? writer->writeList(notations, device, options) : writer->write(notations.front(), device, options);
     if (!writeRet) {
         LOGW() << writeRet.toString();
         return writeRet;
     }
 
-    RetVal<QByteArray> result;
-    result.ret = make_ret(Ret::Code::Ok);
-    result.val = data.toQByteArrayNoCopy().toBase64();
-
-    device.close();
+    if (!device.finish()) {
+        return make_ret(Ret::Code::InternalError);
+    }
 
-    return result;
+    return make_ret(Ret::Code::Ok);
 }
 
 Ret BackendApi::doExportScoreParts(const IMasterNotationPtr masterNotation, QIODevice& destinationDevice)
@@ -572,15 +982,12 @@ Ret BackendApi::doExportScoreParts(const IMasterNotationPtr masterNotation, QIOD
 Ret BackendApi::doExportScorePartsPdfs(const IMasterNotationPtr masterNotation, QIODevice& destinationDevice,
                                        const std::string& scoreFileName)
 {
-    QJsonObject jsonForPdfs;
-    jsonForPdfs["score"] = QString::fromStdString(scoreFileName);
-    QByteArray scoreBin = processWriter(PDF_WRITER_NAME, masterNotation->notation()).val;
-    jsonForPdfs["scoreBin"] = QString::fromLatin1(scoreBin);
-
+    //! NOTE The PDFs are encoded and written to the device while they are painted,
+    //! so memory use doesn't depend on the number of pages and parts.
+    //! The keys are in the same order as QJsonDocument would write them
     INotationPtrList notations;
     notations.push_back(masterNotation->notation());
 
-    QJsonArray partsArray;
     QJsonArray partsNamesArray;
 
     ExcerptNotationList excerpts = allExcerpts(masterNotation);
@@ -589,27 +996,60 @@ Ret BackendApi::doExportScorePartsPdfs(const IMasterNotationPtr masterNotation,
         QJsonValue partNameVal(e->name());
         partsNamesArray.append(partNameVal);
 
-        QByteArray partBin = processWriter(PDF_WRITER_NAME, e->notation()).val;
-        QJsonValue partVal(QString::fromLatin1(partBin));
-        partsArray.append(partVal);
-
         notations.push_back(e->notation());
     }
 
-    jsonForPdfs["parts"] = partsNamesArray;
-    jsonForPdfs["partsBin"] = partsArray;
+    const INotationWriter::Options partOptions {
+        { INotationWriter::OptionKey::UNIT_TYPE, Val(INotationWriter::UnitType::PER_PART) },
+        { INotationWriter::OptionKey::STREAM_OUTPUT, Val(true) }
+    };
 
-    jsonForPdfs["scoreFullPostfix"] = QString("-Score_and_parts") + ".pdf";
+    const INotationWriter::Options fullScoreOptions {
+        { INotationWriter::OptionKey::UNIT_TYPE, Val(INotationWriter::UnitType::MULTI_PART) },
+        { INotationWriter::OptionKey::STREAM_OUTPUT, Val(true) }
+    };
 
-    INotationWriter::Options options {
-        { INotationWriter::OptionKey::UNIT_TYPE, Val(INotationWriter::UnitType::MULTI_PART) }
+    auto write = [&destinationDevice](const QByteArray& data) {
+        return destinationDevice.write(data) == data.size();
     };
 
-    QByteArray fullScoreData = processWriter(PDF_WRITER_NAME, notations, options).val;
-    jsonForPdfs["scoreFullBin"] = QString::fromLatin1(fullScoreData.toBase64());
+    const Base64WriteDevice::Sink sink = deviceSink(&destinationDevice);
+
+    bool ok = write("{\"parts\":") && write(QJsonDocument(partsNamesArray).toJson(QJsonDocument::Compact));
+
+    ok = ok && write(",\"partsBin\":[");
+    for (size_t i = 0; ok && i < excerpts.size(); ++i) {
+        ok = (i == 0 || write(","))
+             && write("\"")
+             && processWriter(PDF_WRITER_NAME, { excerpts.at(i)->notation() }, partOptions, sink)
+             && write("\"");
+    }
+    ok = ok && write("]");
+
+    ok = ok && write(",\"score\":") && write(jsonString(QString::fromStdString(scoreFileName)));
+
+    ok = ok && write(",\"scoreBin\":\"")
+         && processWriter(PDF_WRITER_NAME, { masterNotation->notation() }, partOptions, sink)
+         && write("\"");
+
+    //! NOTE The full score is encoded twice, as it always has been
+    if (ok) {
+        Base64WriteDevice encodedDevice(sink);
+        encodedDevice.open(IODevice::WriteOnly);
+
+        const Base64WriteDevice::Sink twiceEncodedSink = [&encodedDevice](const char* data, size_t len) {
+            return encodedDevice.write(reinterpret_cast<const uint8_t*>(data), len) == len;
+        };
+
+        ok = write(",\"scoreFullBin\":\"")
+             && processWriter(PDF_WRITER_NAME, notations, fullScoreOptions, twiceEncodedSink)
+             && encodedDevice.finish()
+             && write("\"");
+    }
+
+    ok = ok && write(",\"scoreFullPostfix\":") && write(jsonString(QString("-Score_and_parts") + ".pdf"));
 
-    QJsonDocument jsonDoc(jsonForPdfs);
-    bool ok = destinationDevice.write(QJsonDocument(jsonDoc).toJson(QJsonDocument::Compact)) != -1;
+    ok = ok && write("}");
 
     return ok;
 }
@@ -767,11 +1207,11 @@ void BackendApi::switchToPageView(IMasterNotationPtr masterNotation)
 void BackendApi::renderExcerptsContents(IMasterNotationPtr masterNotation)
 {
     //! NOTE: Due to optimization, only the master score is layouted
-    //!       Let's layout all the scores of the excerpts
+    //!       The scores of the excerpts are laid out when their pages are painted or requested
     for (IExcerptNotationPtr excerpt : masterNotation->excerpts()) {
         Score* score = excerpt->notation()->elements()->msScore();
         if (!score->autoLayoutEnabled()) {
-            score->doLayout();
+            score->setLayoutDeferred(true);
         }
     }
 }
@@ -22,6 +22,9 @@
 #ifndef MU_CONVERTER_BACKENDAPI_H
 #define MU_CONVERTER_BACKENDAPI_H
 
+#include <functional>
+#include <map>
+
 #include <QFile>
 
 #include "types/retval.h"
@@ -34,6 +37,8 @@
 #include "project/iprojectcreator.h"
 #include "project/inotationwritersregister.h"
 
+#include "base64writedevice.h"
+
 namespace mu::engraving {
 class Score;
 }
@@ -50,18 +55,42 @@ class BackendApi
 public:
     static muse::Ret exportScoreMedia(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& highlightConfigPath,
                                       const muse::io::path_t& stylePath = "", bool forceMode = false);
+    //! NOTE Writes the media as separate files with a manifest into outDir. Artifacts whose inputs
+    //! did not change since a previous export into the same directory are kept as they are
+    static muse::Ret exportScoreMediaDir(const muse::io::path_t& in, const muse::io::path_t& outDir,
+                                         const muse::io::path_t& highlightConfigPath, const muse::io::path_t& stylePath = "",
+                                         bool forceMode = false);
     static muse::Ret exportScoreMeta(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& stylePath,
                                      bool forceMode = false);
     static muse::Ret exportScoreParts(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& stylePath,
                                       bool forceMode = false);
     static muse::Ret exportScorePartsPdfs(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& stylePath,
                                           bool forceMode = false);
+    static muse::Ret exportScorePartsPdfs(const muse::io::path_t& in, QIODevice& destinationDevice, const muse::io::path_t& stylePath,
+                                          bool forceMode = false);
     static muse::Ret exportScoreTranspose(const muse::io::path_t& in, const muse::io::path_t& out, const std::string& optionsJson,
                                           const muse::io::path_t& stylePath, bool forceMode = false);
 
     static muse::Ret updateSource(const muse::io::path_t& in, const std::string& newSource, bool forceMode = false);
 
 private:
+    struct MediaArtifact {
+        std::string name; // relative to the output directory
+        std::string type;
+        int page = -1;
+        std::string inputHash;
+        std::string hash;
+        size_t size = 0;
+    };
+
+    struct MediaManifest {
+        std::string scoreInputHash;
+        std::map<std::string, MediaArtifact> artifacts;
+    };
+
+    using PageInputHash = std::function<std::string (const std::string& name, size_t pageIndex)>;
+    using WriteArtifact = std::function<muse::Ret (muse::io::IODevice& device)>;
+
     static muse::Ret openOutputFile(QFile& file, const muse::io::path_t& out);
 
     static muse::RetVal<project::INotationProjectPtr> openProject(const muse::io::path_t& path,
@@ -84,9 +113,24 @@ private:
     static muse::Ret exportScoreMetaData(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
     static muse::Ret devInfo(const notation::INotationPtr notation, BackendJsonWriter& jsonWriter, bool addSeparator = false);
 
+    static MediaManifest readMediaManifest(const muse::io::path_t& path);
+    static muse::Ret writeMediaManifest(const muse::io::path_t& path, const std::string& scoreInputHash, size_t pageCount,
+                                        const std::vector<MediaArtifact>& artifacts);
+    static bool isMediaArtifactUpToDate(const MediaManifest& previous, const muse::io::path_t& outDir, const MediaArtifact& artifact);
+    static std::vector<std::string> pageFingerprints(const notation::INotationPtr notation);
+    static muse::Ret exportMediaPages(const std::string& writerName, const notation::INotationPtr notation,
+                                      const project::INotationWriter::Options& options, const muse::io::path_t& outDir,
+                                      const MediaManifest& previous, const PageInputHash& inputHash, std::vector<MediaArtifact>& artifacts);
+    static muse::Ret exportMediaArtifact(const std::string& name, const std::string& type, const std::string& inputHash,
+                                         const muse::io::path_t& outDir, const MediaManifest& previous, const WriteArtifact& write,
+                                         std::vector<MediaArtifact>& artifacts);
+
     static muse::RetVal<QByteArray> processWriter(const std::string& writerName, const notation::INotationPtr notation);
-    static muse::RetVal<QByteArray> processWriter(const std::string& writerName, const notation::INotationPtrList notations,
-                                                  const project::INotationWriter::Options& options);
+    static muse::Ret processWriter(const std::string& writerName, const notation::INotationPtr notation,
+                                   const project::INotationWriter::Options& options, muse::io::IODevice& device);
+    //! NOTE Passes the output of the writer on to the sink as base64 while writing
+    static muse::Ret processWriter(const std::string& writerName, const notation::INotationPtrList& notations,
+                                   const project::INotationWriter::Options& options, const Base64WriteDevice::Sink& base64Sink);
 
     static muse::Ret doExportScoreParts(const notation::IMasterNotationPtr notation, QIODevice& destinationDevice);
     static muse::Ret doExportScorePartsPdfs(const notation::IMasterNotationPtr notation, QIODevice& destinationDevice,
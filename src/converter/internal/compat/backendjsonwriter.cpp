@@ -58,6 +58,18 @@ void BackendJsonWriter::addValue(const QByteArray& data, bool addSeparator, bool
     }
 }
 
+bool BackendJsonWriter::addStreamedValue(const std::function<bool(QIODevice* device)>& writeValue, bool addSeparator)
+{
+    m_destinationDevice->write("\"");
+    bool ok = writeValue(m_destinationDevice);
+    m_destinationDevice->write("\"");
+    if (addSeparator) {
+        m_destinationDevice->write(",\n");
+    }
+
+    return ok;
+}
+
 void BackendJsonWriter::openArray()
 {
     m_destinationDevice->write(" [");
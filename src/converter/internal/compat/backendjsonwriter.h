@@ -22,6 +22,10 @@
 #ifndef MU_CONVERTER_BACKENDJSONWRITER_H
 #define MU_CONVERTER_BACKENDJSONWRITER_H
 
+#include <functional>
+
+#include <QIODevice>
+
 #include "io/path.h"
 
 namespace mu::converter {
@@ -34,6 +38,9 @@ public:
     void addKey(const char* arrayName);
     void addValue(const QByteArray& data, bool addSeparator = false, bool isJson = false);
 
+    //! NOTE For large string values, which are written to the destination device directly
+    bool addStreamedValue(const std::function<bool (QIODevice* device)>& writeValue, bool addSeparator = false);
+
     void openArray();
     void closeArray(bool addSeparator = false);
 
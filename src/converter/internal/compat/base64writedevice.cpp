@@ -0,0 +1,103 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "base64writedevice.h"
+
+#include "log.h"
+
+using namespace mu::converter;
+using namespace muse;
+using namespace muse::io;
+
+static constexpr qsizetype ENCODED_CHUNK_SIZE = 256 * 1024;
+
+Base64WriteDevice::Base64WriteDevice(const Sink& sink)
+    : m_sink(sink)
+{
+}
+
+bool Base64WriteDevice::finish()
+{
+    if (!m_rest.isEmpty()) {
+        m_encoded.append(m_rest.toBase64());
+        m_rest.clear();
+    }
+
+    return flushEncoded();
+}
+
+bool Base64WriteDevice::doOpen(OpenMode m)
+{
+    return m == OpenMode::WriteOnly || m == OpenMode::Append;
+}
+
+size_t Base64WriteDevice::dataSize() const
+{
+    return m_size;
+}
+
+const uint8_t* Base64WriteDevice::rawData() const
+{
+    return nullptr;
+}
+
+bool Base64WriteDevice::resizeData(size_t size)
+{
+    m_size = size;
+    return true;
+}
+
+size_t Base64WriteDevice::writeData(const uint8_t* data, size_t len)
+{
+    IF_ASSERT_FAILED(pos() == m_written) {
+        return 0;
+    }
+
+    if (m_failed) {
+        return 0;
+    }
+
+    QByteArray input = m_rest;
+    input.append(reinterpret_cast<const char*>(data), static_cast<qsizetype>(len));
+
+    const qsizetype encodedSize = input.size() - input.size() % 3;
+    m_encoded.append(input.first(encodedSize).toBase64());
+    m_rest = input.sliced(encodedSize);
+
+    m_written += len;
+
+    if (m_encoded.size() >= ENCODED_CHUNK_SIZE && !flushEncoded()) {
+        return 0;
+    }
+
+    return len;
+}
+
+bool Base64WriteDevice::flushEncoded()
+{
+    if (!m_failed && !m_encoded.isEmpty()) {
+        m_failed = !m_sink(m_encoded.constData(), static_cast<size_t>(m_encoded.size()));
+    }
+
+    m_encoded.clear();
+
+    return !m_failed;
+}
@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_CONVERTER_BASE64WRITEDEVICE_H
+#define MU_CONVERTER_BASE64WRITEDEVICE_H
+
+#include <functional>
+
+#include <QByteArray>
+
+#include "io/iodevice.h"
+
+namespace mu::converter {
+//! NOTE Write only device, which encodes the written data as base64 and passes it on to the sink in chunks,
+//! so that large binaries (e.g. PDFs) are not kept in memory. Only sequential writes are supported
+class Base64WriteDevice : public muse::io::IODevice
+{
+public:
+    using Sink = std::function<bool (const char* data, size_t len)>;
+
+    explicit Base64WriteDevice(const Sink& sink);
+
+    // Encodes the rest of the data (with padding) and passes everything on to the sink
+    bool finish();
+
+protected:
+    bool doOpen(OpenMode m) override;
+    size_t dataSize() const override;
+    const uint8_t* rawData() const override;
+    bool resizeData(size_t size) override;
+    size_t writeData(const uint8_t* data, size_t len) override;
+
+private:
+    bool flushEncoded();
+
+    Sink m_sink;
+    size_t m_size = 0;
+    size_t m_written = 0;
+    QByteArray m_rest; // less than 3 bytes, which are not encoded yet
+    QByteArray m_encoded;
+    bool m_failed = false;
+};
+}
+
+#endif // MU_CONVERTER_BASE64WRITEDEVICE_H
@@ -21,10 +21,23 @@
  */
 #include "convertercontroller.h"
 
+#include <numeric>
+
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonParseError>
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QThread>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(Q_OS_UNIX)
+#include <sys/resource.h>
+#endif
 
 #include "global/io/file.h"
 #include "global/io/dir.h"
@@ -40,6 +53,7 @@ using namespace mu::project;
 using namespace mu::notation;
 using namespace muse;
 using namespace muse::io;
+using namespace muse::audio;
 
 static const std::string PDF_SUFFIX = "pdf";
 static const std::string PNG_SUFFIX = "png";
@@ -213,6 +227,45 @@ Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotationP
 {
     TRACEFUNC;
 
+    std::vector<size_t> pageIndexes(notation->elements()->pages().size());
+    std::iota(pageIndexes.begin(), pageIndexes.end(), 0);
+
+    //! NOTE The writer sets up the score once for all the pages, the files are written here in page order
+    auto writePage = [&out](size_t pageIndex, const ByteArray& data) -> Ret {
+        const String filePath = muse::io::path_t(io::dirpath(out) + "/"
+                                                 + io::completeBasename(out) + "-%1."
+                                                 + io::suffix(out)).toString().arg(pageIndex + 1);
+
+        File file(filePath);
+        if (!file.open(File::WriteOnly)) {
+            return make_ret(Err::OutFileFailedOpen);
+        }
+
+        if (file.write(data) != static_cast<size_t>(data.size())) {
+            LOGE() << "failed write, path: " << filePath;
+            return make_ret(Err::OutFileFailedWrite);
+        }
+
+        file.close();
+
+        return make_ret(Ret::Code::Ok);
+    };
+
+    Ret ret = writer->writePages(notation, pageIndexes, writePage);
+    if (ret.code() == static_cast<int>(Ret::Code::NotSupported)) {
+        return convertPageByPageSequentially(writer, notation, out);
+    }
+
+    if (!ret) {
+        LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
+        return ret.code() == static_cast<int>(Err::OutFileFailedOpen) ? ret : make_ret(Err::OutFileFailedWrite);
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
+Ret ConverterController::convertPageByPageSequentially(INotationWriterPtr writer, INotationPtr notation, const muse::io::path_t& out) const
+{
     for (size_t i = 0; i < notation->elements()->pages().size(); i++) {
         const String filePath = muse::io::path_t(io::dirpath(out) + "/"
                                                  + io::completeBasename(out) + "-%1."
@@ -329,6 +382,15 @@ Ret ConverterController::exportScoreMedia(const muse::io::path_t& in, const muse
     return BackendApi::exportScoreMedia(in, out, highlightConfigPath, stylePath, forceMode);
 }
 
+Ret ConverterController::exportScoreMediaDir(const muse::io::path_t& in, const muse::io::path_t& outDir,
+                                             const muse::io::path_t& highlightConfigPath,
+                                             const muse::io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    return BackendApi::exportScoreMediaDir(in, outDir, highlightConfigPath, stylePath, forceMode);
+}
+
 Ret ConverterController::exportScoreMeta(const muse::io::path_t& in, const muse::io::path_t& out, const muse::io::path_t& stylePath,
                                          bool forceMode)
 {
@@ -391,6 +453,266 @@ Ret ConverterController::exportScoreVideo(const muse::io::path_t& in, const muse
     return make_ret(Ret::Code::Ok);
 }
 
+Ret ConverterController::benchmarkAudioRender(const std::vector<muse::io::path_t>& in, const muse::io::path_t& out)
+{
+    TRACEFUNC;
+
+    if (!playback() || !playbackController()) {
+        return make_ret(Ret::Code::NotSupported);
+    }
+
+    QJsonArray scores;
+    StringList errors;
+
+    for (const muse::io::path_t& path : in) {
+        QJsonObject score;
+        score["path"] = path.toQString();
+
+        RetVal<AudioRenderBenchmarkResult> result = benchmarkAudioRender(path);
+        if (!result.ret) {
+            score["error"] = QString::fromStdString(result.ret.toString());
+            errors.emplace_back(String(u"failed benchmark, err: %1, in: %2")
+                                .arg(String::fromStdString(result.ret.toString())).arg(path.toString()));
+            scores.append(score);
+            continue;
+        }
+
+        const AudioRenderBenchmarkResult& r = result.val;
+
+        score["renderedSec"] = r.renderedDurationSecs;
+        score["wallTimeMs"] = r.wallTimeMsecs;
+        score["realTimeFactor"] = r.realTimeFactor;
+        score["blockSize"] = static_cast<qint64>(r.blockSize);
+        score["blockCount"] = static_cast<qint64>(r.blockCount);
+
+        QJsonObject blockTimeUs;
+        blockTimeUs["p50"] = r.blockTimeP50;
+        blockTimeUs["p90"] = r.blockTimeP90;
+        blockTimeUs["p99"] = r.blockTimeP99;
+        blockTimeUs["max"] = r.blockTimeMax;
+        score["blockTimeUs"] = blockTimeUs;
+
+        if (r.allocationsPerBlock >= 0.0) {
+            score["allocationsPerBlock"] = r.allocationsPerBlock;
+        }
+
+        QJsonArray tracks;
+        for (const auto& pair : r.trackCpuTimeMsecs) {
+            QJsonObject track;
+            track["trackId"] = pair.first;
+            track["cpuTimeMs"] = pair.second;
+            track["cpuShare"] = r.wallTimeMsecs > 0.0 ? pair.second / r.wallTimeMsecs : 0.0;
+            tracks.append(track);
+        }
+        score["tracks"] = tracks;
+
+        scores.append(score);
+    }
+
+    QJsonObject root;
+    root["scores"] = scores;
+
+    QFile outputFile;
+    bool ok = false;
+    if (!out.empty()) {
+        outputFile.setFileName(out.toQString());
+        ok = outputFile.open(QFile::WriteOnly);
+    } else {
+        ok = outputFile.open(stdout, QFile::WriteOnly);
+    }
+
+    if (!ok) {
+        return make_ret(Err::OutFileFailedOpen);
+    }
+
+    if (outputFile.write(QJsonDocument(root).toJson()) < 0) {
+        return make_ret(Err::OutFileFailedWrite);
+    }
+
+    if (!errors.empty()) {
+        return make_ret(Err::ConvertFailed, errors.join(u"\n").toStdString());
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
+namespace {
+//! NOTE Discards the written data, only counts it
+class CountingDevice : public QIODevice
+{
+public:
+    qint64 writtenBytes() const { return m_writtenBytes; }
+
+protected:
+    qint64 readData(char*, qint64) override { return -1; }
+
+    qint64 writeData(const char*, qint64 len) override
+    {
+        m_writtenBytes += len;
+        return len;
+    }
+
+private:
+    qint64 m_writtenBytes = 0;
+};
+}
+
+//! NOTE Peak resident memory of the process so far, or -1 if unknown
+static double peakMemoryMb()
+{
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<double>(counters.PeakWorkingSetSize) / (1024.0 * 1024.0);
+    }
+    return -1.0;
+#elif defined(Q_OS_UNIX)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1.0;
+    }
+#if defined(Q_OS_MACOS)
+    return static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0); // bytes
+#else
+    return static_cast<double>(usage.ru_maxrss) / 1024.0; // kilobytes
+#endif
+#else
+    return -1.0;
+#endif
+}
+
+Ret ConverterController::benchmarkScorePartsPdfs(const std::vector<muse::io::path_t>& in, const muse::io::path_t& out,
+                                                 const muse::io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    QJsonArray scores;
+    StringList errors;
+
+    for (const muse::io::path_t& path : in) {
+        QJsonObject score;
+        score["path"] = path.toQString();
+
+        const double peakMemoryBeforeMb = peakMemoryMb();
+
+        CountingDevice device;
+        device.open(QIODevice::WriteOnly);
+
+        QElapsedTimer timer;
+        timer.start();
+
+        Ret ret = BackendApi::exportScorePartsPdfs(path, device, stylePath, forceMode);
+
+        score["wallTimeMs"] = static_cast<double>(timer.nsecsElapsed()) / 1000000.0;
+        score["outputBytes"] = device.writtenBytes();
+
+        const double peakMemoryAfterMb = peakMemoryMb();
+        if (peakMemoryBeforeMb >= 0.0 && peakMemoryAfterMb >= 0.0) {
+            score["peakMemoryBeforeMb"] = peakMemoryBeforeMb;
+            score["peakMemoryAfterMb"] = peakMemoryAfterMb;
+        }
+
+        if (!ret) {
+            score["error"] = QString::fromStdString(ret.toString());
+            errors.emplace_back(String(u"failed benchmark, err: %1, in: %2")
+                                .arg(String::fromStdString(ret.toString())).arg(path.toString()));
+        }
+
+        scores.append(score);
+    }
+
+    QJsonObject root;
+    root["scores"] = scores;
+
+    QFile outputFile;
+    bool ok = false;
+    if (!out.empty()) {
+        outputFile.setFileName(out.toQString());
+        ok = outputFile.open(QFile::WriteOnly);
+    } else {
+        ok = outputFile.open(stdout, QFile::WriteOnly);
+    }
+
+    if (!ok) {
+        return make_ret(Err::OutFileFailedOpen);
+    }
+
+    if (outputFile.write(QJsonDocument(root).toJson()) < 0) {
+        return make_ret(Err::OutFileFailedWrite);
+    }
+
+    if (!errors.empty()) {
+        return make_ret(Err::ConvertFailed, errors.join(u"\n").toStdString());
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
+RetVal<AudioRenderBenchmarkResult> ConverterController::benchmarkAudioRender(const muse::io::path_t& in)
+{
+    TRACEFUNC;
+
+    LOGI() << "in: " << in;
+
+    RetVal<AudioRenderBenchmarkResult> result;
+
+    auto notationProject = notationCreator()->newProject(iocContext());
+    IF_ASSERT_FAILED(notationProject) {
+        result.ret = make_ret(Err::UnknownError);
+        return result;
+    }
+
+    Ret ret = notationProject->load(in);
+    if (!ret) {
+        LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << in;
+        result.ret = make_ret(Err::InFileFailedLoad);
+        return result;
+    }
+
+    globalContext()->setCurrentProject(notationProject);
+
+    //! NOTE The playback model, the sequencer and the tracks are set up exactly as for the audio export
+    playbackController()->setNotation(notationProject->masterNotation()->notation());
+    playbackController()->setIsExportingAudio(true);
+
+    bool isCompleted = false;
+
+    playback()->sequenceIdList()
+    .onResolve(this, [this, &result, &isCompleted](const TrackSequenceIdList& sequenceIdList) {
+        if (sequenceIdList.empty()) {
+            result.ret = make_ret(Ret::Code::InternalError, std::string("no track sequence"));
+            isCompleted = true;
+            return;
+        }
+
+        playback()->audioOutput()->renderBenchmark(sequenceIdList.front())
+        .onResolve(this, [&result, &isCompleted](const AudioRenderBenchmarkResult& benchmarkResult) {
+            result.val = benchmarkResult;
+            result.ret = muse::make_ok();
+            isCompleted = true;
+        })
+        .onReject(this, [&result, &isCompleted](int errorCode, const std::string& msg) {
+            result.ret = Ret(errorCode, msg);
+            isCompleted = true;
+        });
+    })
+    .onReject(this, [&result, &isCompleted](int errorCode, const std::string& msg) {
+        result.ret = Ret(errorCode, msg);
+        isCompleted = true;
+    });
+
+    while (!isCompleted) {
+        QApplication::instance()->processEvents();
+        QThread::yieldCurrentThread();
+    }
+
+    playbackController()->setIsExportingAudio(false);
+    playbackController()->setNotation(nullptr);
+    globalContext()->setCurrentProject(nullptr);
+
+    return result;
+}
+
 Ret ConverterController::updateSource(const muse::io::path_t& in, const std::string& newSource, bool forceMode)
 {
     TRACEFUNC;
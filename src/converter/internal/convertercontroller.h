@@ -27,6 +27,9 @@
 #include "../iconvertercontroller.h"
 
 #include "modularity/ioc.h"
+#include "async/asyncable.h"
+#include "audio/iplayback.h"
+#include "playback/iplaybackcontroller.h"
 #include "project/iprojectcreator.h"
 #include "project/inotationwritersregister.h"
 #include "project/iprojectrwregister.h"
@@ -35,12 +38,14 @@
 #include "types/retval.h"
 
 namespace mu::converter {
-class ConverterController : public IConverterController, public muse::Injectable
+class ConverterController : public IConverterController, public muse::Injectable, public muse::async::Asyncable
 {
     muse::Inject<project::IProjectCreator> notationCreator = { this };
     muse::Inject<project::INotationWritersRegister> writers = { this };
     muse::Inject<project::IProjectRWRegister> projectRW = { this };
     muse::Inject<context::IGlobalContext> globalContext = { this };
+    muse::Inject<muse::audio::IPlayback> playback = { this };
+    muse::Inject<playback::IPlaybackController> playbackController = { this };
 
 public:
     ConverterController(const muse::modularity::ContextPtr& iocCtx)
@@ -59,6 +64,9 @@ public:
     muse::Ret exportScoreMedia(const muse::io::path_t& in, const muse::io::path_t& out,
                                const muse::io::path_t& highlightConfigPath = muse::io::path_t(),
                                const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) override;
+    muse::Ret exportScoreMediaDir(const muse::io::path_t& in, const muse::io::path_t& outDir,
+                                  const muse::io::path_t& highlightConfigPath = muse::io::path_t(),
+                                  const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) override;
     muse::Ret exportScoreMeta(const muse::io::path_t& in, const muse::io::path_t& out,
                               const muse::io::path_t& stylePath = muse::io::path_t(), bool forceMode = false) override;
     muse::Ret exportScoreParts(const muse::io::path_t& in, const muse::io::path_t& out,
@@ -70,6 +78,10 @@ public:
 
     muse::Ret exportScoreVideo(const muse::io::path_t& in, const muse::io::path_t& out) override;
 
+    muse::Ret benchmarkAudioRender(const std::vector<muse::io::path_t>& in, const muse::io::path_t& out) override;
+    muse::Ret benchmarkScorePartsPdfs(const std::vector<muse::io::path_t>& in, const muse::io::path_t& out,
+                                      const muse::io::path_t& stylePath = "", bool forceMode = false) override;
+
     muse::Ret updateSource(const muse::io::path_t& in, const std::string& newSource, bool forceMode = false) override;
 
 private:
@@ -85,12 +97,16 @@ private:
 
     bool isConvertPageByPage(const std::string& suffix) const;
     muse::Ret convertPageByPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const muse::io::path_t& out) const;
+    muse::Ret convertPageByPageSequentially(project::INotationWriterPtr writer, notation::INotationPtr notation,
+                                            const muse::io::path_t& out) const;
     muse::Ret convertFullNotation(project::INotationWriterPtr writer, notation::INotationPtr notation, const muse::io::path_t& out) const;
 
     muse::Ret convertScorePartsToPdf(project::INotationWriterPtr writer, notation::IMasterNotationPtr masterNotation,
                                      const muse::io::path_t& out) const;
     muse::Ret convertScorePartsToPngs(project::INotationWriterPtr writer, notation::IMasterNotationPtr masterNotation,
                                       const muse::io::path_t& out) const;
+
+    muse::RetVal<muse::audio::AudioRenderBenchmarkResult> benchmarkAudioRender(const muse::io::path_t& in);
 };
 }
 
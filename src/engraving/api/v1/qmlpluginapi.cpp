@@ -143,8 +143,11 @@ PluginAPI::PluginAPI(QQuickItem* parent)
 
 apiv1::Score* PluginAPI::curScore() const
 {
-    if (currentScore()) {
-        return wrap<apiv1::Score>(currentScore(), Ownership::SCORE);
+    if (mu::engraving::Score* score = currentScore()) {
+        //! NOTE Plugins read the positions of all the elements,
+        //! so a score laid out progressively in the app is laid out completely first
+        score->ensureLayoutComplete();
+        return wrap<apiv1::Score>(score, Ownership::SCORE);
     }
 
     return nullptr;
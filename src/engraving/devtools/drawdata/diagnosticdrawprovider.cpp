@@ -95,3 +95,10 @@ Ret DiagnosticDrawProvider::drawDiffToPng(const muse::io::path_t& diffFile, cons
     DrawDataConverter c;
     return c.drawDiffToPng(diffFile, refFile, outFile);
 }
+
+Ret DiagnosticDrawProvider::profileLayout(const muse::io::path_t& scoreFile, const muse::io::path_t& outFile)
+{
+    LOGI() << "score: " << scoreFile << ", out: " << outFile;
+    DrawDataGenerator g(iocContext());
+    return g.profileLayout(scoreFile, outFile);
+}
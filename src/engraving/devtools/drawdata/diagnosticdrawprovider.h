@@ -38,6 +38,8 @@ public:
                               const ComOpt& opt = ComOpt()) override;
     muse::Ret drawDataToPng(const muse::io::path_t& dataFile, const muse::io::path_t& outFile) override;
     muse::Ret drawDiffToPng(const muse::io::path_t& diffFile, const muse::io::path_t& refFile, const muse::io::path_t& outFile) override;
+
+    muse::Ret profileLayout(const muse::io::path_t& scoreFile, const muse::io::path_t& outFile) override;
 };
 }
 
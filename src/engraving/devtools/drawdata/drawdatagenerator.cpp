@@ -31,6 +31,7 @@
 #include "engraving/infrastructure/localfileinfoprovider.h"
 #include "engraving/rw/mscloader.h"
 #include "engraving/dom/masterscore.h"
+#include "engraving/rendering/dev/layoutprofiler.h"
 
 // #ifdef MUE_BUILD_IMPORTEXPORT_MODULE
 // #include "importexport/guitarpro/internal/guitarproreader.h"
@@ -131,6 +132,7 @@ DrawDataPtr DrawDataGenerator::genDrawData(const muse::io::path_t& scorePath, co
         option.printPageBackground = true;
         option.isSetViewport = true;
         option.isPrinting = true;
+        option.useDisplayLists = false; // keep the per item structure
 
         scoreRenderer()->paintScore(&painter, score, option);
     }
@@ -141,6 +143,32 @@ DrawDataPtr DrawDataGenerator::genDrawData(const muse::io::path_t& scorePath, co
     return drawData;
 }
 
+Ret DrawDataGenerator::profileLayout(const muse::io::path_t& scorePath, const muse::io::path_t& outFile) const
+{
+    using namespace mu::engraving::rendering::dev;
+
+    MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle(nullptr);
+    if (!loadScore(score, scorePath)) {
+        LOGE() << "failed load score: " << scorePath;
+        delete score;
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    LayoutProfiler* profiler = LayoutProfiler::instance();
+    profiler->clear();
+    profiler->setEnabled(true);
+
+    score->doLayout();
+
+    profiler->setEnabled(false);
+
+    delete score;
+
+    LOGI() << "layout profile:\n" << profiler->statsDump();
+
+    return profiler->writeChromeTrace(outFile);
+}
+
 Pixmap DrawDataGenerator::genImage(const muse::io::path_t& scorePath) const
 {
     LOGD() << "try: " << scorePath;
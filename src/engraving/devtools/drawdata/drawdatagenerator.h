@@ -45,6 +45,8 @@ public:
     muse::draw::DrawDataPtr genDrawData(const muse::io::path_t& scorePath, const GenOpt& opt = GenOpt()) const;
     muse::draw::Pixmap genImage(const muse::io::path_t& scorePath) const;
 
+    muse::Ret profileLayout(const muse::io::path_t& scorePath, const muse::io::path_t& outFile) const;
+
 private:
     bool loadScore(engraving::MasterScore* score, const muse::io::path_t& path) const;
     void applyOptions(engraving::MasterScore* score, const GenOpt& opt) const;
@@ -40,6 +40,9 @@ public:
                                       const ComOpt& opt = ComOpt()) = 0;
     virtual muse::Ret drawDataToPng(const muse::io::path_t& dataFile, const muse::io::path_t& outFile) = 0;
     virtual muse::Ret drawDiffToPng(const muse::io::path_t& diffFile, const muse::io::path_t& refFile, const muse::io::path_t& outFile) = 0;
+
+    //! NOTE Lays out the score with the layout profiler enabled and writes a Chrome trace (json)
+    virtual muse::Ret profileLayout(const muse::io::path_t& scoreFile, const muse::io::path_t& outFile) = 0;
 };
 }
 
@@ -20,6 +20,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cmath>
 
 #include "bsp.h"
@@ -62,17 +63,18 @@ class FindItemBspTreeVisitor : public BspTreeVisitor
 {
     OBJECT_ALLOCATOR(engraving, FindItemBspTreeVisitor)
 public:
-    std::list<EngravingItem*> foundItems;
+    std::vector<EngravingItem*> foundItems;
 
     void visit(std::list<EngravingItem*>* items)
     {
-        for (auto it = items->begin(); it != items->end(); ++it) {
-            EngravingItem* item = *it;
-            if (!item->itemDiscovered) {
-                item->itemDiscovered = true;
-                foundItems.push_front(item);
-            }
-        }
+        foundItems.insert(foundItems.end(), items->begin(), items->end());
+    }
+
+    // an item is stored in every leaf it overlaps
+    void removeDuplicates()
+    {
+        std::sort(foundItems.begin(), foundItems.end());
+        foundItems.erase(std::unique(foundItems.begin(), foundItems.end()), foundItems.end());
     }
 };
 
@@ -152,9 +154,10 @@ std::vector<EngravingItem*> BspTree::items(const RectF& rec)
 {
     FindItemBspTreeVisitor findVisitor;
     climbTree(&findVisitor, rec);
+    findVisitor.removeDuplicates();
+
     std::vector<EngravingItem*> l;
     for (EngravingItem* e : findVisitor.foundItems) {
-        e->itemDiscovered = false;
         if (e->pageBoundingRect().intersects(rec)) {
             l.push_back(e);
         }
@@ -170,10 +173,10 @@ std::vector<EngravingItem*> BspTree::items(const PointF& pos)
 {
     FindItemBspTreeVisitor findVisitor;
     climbTree(&findVisitor, pos);
+    findVisitor.removeDuplicates();
 
     std::vector<EngravingItem*> l;
     for (EngravingItem* e : findVisitor.foundItems) {
-        e->itemDiscovered = false;
         if (e->contains(pos)) {
             l.push_back(e);
         }
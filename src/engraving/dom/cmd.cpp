@@ -481,7 +481,7 @@ void Score::update(bool resetCmdState, bool layoutAllParts)
 
         if (cs.layoutRange()) {
             for (Score* s : ms->scoreList()) {
-                if (s != this && !s->isOpen() && ms->scoreList().size() > 1 && !layoutAllParts) {
+                if (s != this && (!s->isOpen() || s->isLayoutDeferred()) && ms->scoreList().size() > 1 && !layoutAllParts) {
                     continue;
                 }
                 s->doLayoutRange(cs.startTick(), cs.endTick());
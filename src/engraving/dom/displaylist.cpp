@@ -0,0 +1,281 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "displaylist.h"
+
+#include <algorithm>
+
+#include "draw/bufferedpaintprovider.h"
+#include "draw/painter.h"
+#include "draw/utils/drawdatapaint.h"
+
+#include "engravingitem.h"
+#include "measurebase.h"
+#include "mscore.h"
+#include "page.h"
+#include "score.h"
+#include "system.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace muse::draw;
+
+static std::atomic<uint64_t> s_generation = 0;
+
+//---------------------------------------------------------
+//   PageDisplayList
+//---------------------------------------------------------
+
+PageDisplayList::PageDisplayList(const PageDisplayList&)
+{
+    // copies are recorded on the first paint
+}
+
+PageDisplayList& PageDisplayList::operator=(const PageDisplayList&)
+{
+    invalidate();
+    return *this;
+}
+
+//---------------------------------------------------------
+//   invalidate
+//---------------------------------------------------------
+
+void PageDisplayList::invalidate()
+{
+    for (Chunk& chunk : m_chunks) {
+        chunk.valid = false;
+    }
+
+    m_valid = false;
+}
+
+void PageDisplayList::invalidate(const System* system)
+{
+    for (Chunk& chunk : m_chunks) {
+        if (chunk.system == system) {
+            chunk.valid = false;
+        }
+    }
+
+    m_valid = false;
+}
+
+void PageDisplayList::invalidateAll()
+{
+    ++s_generation;
+}
+
+//---------------------------------------------------------
+//   currentKey
+//    the paint settings the recorded commands depend on
+//---------------------------------------------------------
+
+PageDisplayList::Key PageDisplayList::currentKey(const Page* page)
+{
+    Key key;
+    const Score* score = page->score();
+    key.printing = score->printing();
+    key.showInvisible = score->isShowInvisible();
+    key.showUnprintable = score->showUnprintable();
+    key.showFrames = score->showFrames();
+    key.markIrregularMeasures = score->markIrregularMeasures();
+    key.pixelRatio = MScore::pixelRatio;
+    key.generation = s_generation.load(std::memory_order_relaxed);
+    return key;
+}
+
+//---------------------------------------------------------
+//   zOrder
+//---------------------------------------------------------
+
+PageDisplayList::ZOrder PageDisplayList::zOrder(const EngravingItem* item)
+{
+    ZOrder order;
+    order.z = item->z();
+    order.selected = item->selected();
+    order.visible = item->visible();
+    order.track = item->track();
+    return order;
+}
+
+//---------------------------------------------------------
+//   record
+//---------------------------------------------------------
+
+static void collectItem(void* data, EngravingItem* item)
+{
+    static_cast<std::vector<EngravingItem*>*>(data)->push_back(item);
+}
+
+static RectF itemsBoundingRect(const std::vector<EngravingItem*>& items)
+{
+    RectF bbox;
+    for (const EngravingItem* item : items) {
+        bbox.unite(item->pageBoundingRect());
+    }
+
+    return bbox;
+}
+
+void PageDisplayList::record(Chunk& chunk, std::vector<EngravingItem*> items, const PaintItems& paintItems)
+{
+    std::sort(items.begin(), items.end(), elementLessThan);
+
+    chunk.bbox = itemsBoundingRect(items);
+    chunk.runs.clear();
+
+    std::shared_ptr<BufferedPaintProvider> provider = std::make_shared<BufferedPaintProvider>();
+    {
+        Painter painter(provider, "displaylist");
+
+        auto runBegin = items.begin();
+        while (runBegin != items.end()) {
+            const ZOrder order = zOrder(*runBegin);
+            auto runEnd = std::find_if(runBegin, items.end(), [&order](const EngravingItem* item) {
+                return zOrder(item) != order;
+            });
+
+            painter.beginObject("run");
+            paintItems(painter, std::vector<EngravingItem*>(runBegin, runEnd));
+            painter.endObject();
+
+            chunk.runs.push_back(order);
+            runBegin = runEnd;
+        }
+    }
+
+    chunk.data = provider->drawData();
+    chunk.valid = true;
+}
+
+//---------------------------------------------------------
+//   update
+//---------------------------------------------------------
+
+void PageDisplayList::update(Page* page, const PaintItems& paintItems)
+{
+    const Key key = currentKey(page);
+
+    if (m_valid.load(std::memory_order_acquire) && m_key == key) {
+        return;
+    }
+
+    std::lock_guard lock(m_updateMutex);
+
+    if (m_key != key) {
+        invalidate();
+        m_key = key;
+    }
+
+    if (m_valid.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    std::vector<Chunk> chunks;
+    chunks.reserve(page->systems().size() + 1);
+
+    // the page itself (header, footer) first
+    Chunk pageChunk;
+    auto pageIt = std::find_if(m_chunks.begin(), m_chunks.end(), [](const Chunk& chunk) {
+        return chunk.system == nullptr;
+    });
+
+    if (pageIt != m_chunks.end() && pageIt->valid) {
+        pageChunk = std::move(*pageIt);
+    } else {
+        record(pageChunk, { page }, paintItems);
+    }
+
+    chunks.push_back(std::move(pageChunk));
+
+    for (System* system : page->systems()) {
+        auto it = std::find_if(m_chunks.begin(), m_chunks.end(), [system](const Chunk& chunk) {
+            return chunk.system == system;
+        });
+
+        if (it != m_chunks.end() && it->valid) {
+            chunks.push_back(std::move(*it));
+            continue;
+        }
+
+        std::vector<EngravingItem*> items;
+        for (MeasureBase* mb : system->measures()) {
+            mb->scanElements(&items, collectItem, false);
+        }
+        system->scanElements(&items, collectItem, false);
+
+        // an item may be reached from more than one measure
+        std::sort(items.begin(), items.end());
+        items.erase(std::unique(items.begin(), items.end()), items.end());
+
+        Chunk chunk;
+        chunk.system = system;
+        record(chunk, std::move(items), paintItems);
+
+        chunks.push_back(std::move(chunk));
+    }
+
+    m_chunks = std::move(chunks);
+
+    m_valid.store(true, std::memory_order_release);
+}
+
+//---------------------------------------------------------
+//   paint
+//---------------------------------------------------------
+
+void PageDisplayList::paint(Painter& painter, const RectF& rect) const
+{
+    struct Run {
+        const ZOrder* order = nullptr;
+        const DrawDataPtr* data = nullptr;
+        const DrawData::Item* item = nullptr;
+    };
+
+    std::vector<Run> runs;
+    for (const Chunk& chunk : m_chunks) {
+        if (!chunk.data || !chunk.bbox.intersects(rect)) {
+            continue;
+        }
+
+        const std::vector<DrawData::Item>& items = chunk.data->item.chilren;
+        IF_ASSERT_FAILED(items.size() == chunk.runs.size()) {
+            continue;
+        }
+
+        for (size_t i = 0; i < items.size(); ++i) {
+            runs.push_back({ &chunk.runs.at(i), &chunk.data, &items.at(i) });
+        }
+    }
+
+    // the items of different systems may overlap, so the page is painted in the paint order, not system by system
+    std::stable_sort(runs.begin(), runs.end(), [](const Run& r1, const Run& r2) {
+        return *r1.order < *r2.order;
+    });
+
+    for (const Run& run : runs) {
+        DrawDataPaint::paint(&painter, *run.data, *run.item);
+    }
+}
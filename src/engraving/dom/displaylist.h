@@ -0,0 +1,135 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_DISPLAYLIST_H
+#define MU_ENGRAVING_DISPLAYLIST_H
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include "draw/types/drawdata.h"
+
+#include "../types/types.h"
+
+namespace muse::draw {
+class Painter;
+}
+
+namespace mu::engraving {
+class EngravingItem;
+class Page;
+class System;
+
+//---------------------------------------------------------
+//   PageDisplayList
+//    the recorded paint commands of a page, one chunk per
+//    system, so that painting replays them instead of
+//    walking the score; only invalidated systems are recorded again.
+//    The items are replayed in the same order as paintItems()
+//    would paint all the items of the page
+//---------------------------------------------------------
+
+class PageDisplayList
+{
+public:
+    using PaintItems = std::function<void (muse::draw::Painter& painter, const std::vector<EngravingItem*>& items)>;
+
+    PageDisplayList() = default;
+    PageDisplayList(const PageDisplayList&);
+    PageDisplayList& operator=(const PageDisplayList&);
+
+    void invalidate();
+    void invalidate(const System* system);
+
+    // Invalidate all display lists, e.g. when the colors have changed
+    static void invalidateAll();
+
+    // Record the invalidated chunks; thread safe
+    void update(Page* page, const PaintItems& paintItems);
+
+    // Replay the chunks intersecting rect (in page coordinates)
+    void paint(muse::draw::Painter& painter, const RectF& rect) const;
+
+private:
+    struct Key {
+        bool printing = false;
+        bool showInvisible = false;
+        bool showUnprintable = false;
+        bool showFrames = false;
+        bool markIrregularMeasures = false;
+        double pixelRatio = 0.0;
+        uint64_t generation = 0;
+
+        bool operator==(const Key& other) const
+        {
+            return std::tie(printing, showInvisible, showUnprintable, showFrames, markIrregularMeasures, pixelRatio, generation)
+                   == std::tie(other.printing, other.showInvisible, other.showUnprintable, other.showFrames, other.markIrregularMeasures,
+                               other.pixelRatio, other.generation);
+        }
+
+        bool operator!=(const Key& other) const { return !operator==(other); }
+    };
+
+    // the paint order of an item, as in elementLessThan
+    struct ZOrder {
+        int z = 0;
+        bool selected = false;
+        bool visible = false;
+        track_idx_t track = 0;
+
+        bool operator<(const ZOrder& other) const
+        {
+            return std::tie(z, selected, visible, track) < std::tie(other.z, other.selected, other.visible, other.track);
+        }
+
+        bool operator!=(const ZOrder& other) const
+        {
+            return std::tie(z, selected, visible, track) != std::tie(other.z, other.selected, other.visible, other.track);
+        }
+    };
+
+    // the items of a chunk are recorded in runs of the same paint order (one recorded object per run),
+    // so that the runs of all the chunks can be replayed in the paint order of the whole page
+    struct Chunk {
+        const System* system = nullptr; // nullptr for the page itself
+        RectF bbox;
+        muse::draw::DrawDataPtr data;
+        std::vector<ZOrder> runs;
+        bool valid = false;
+    };
+
+    static ZOrder zOrder(const EngravingItem* item);
+    static void record(Chunk& chunk, std::vector<EngravingItem*> items, const PaintItems& paintItems);
+
+    static Key currentKey(const Page* page);
+
+    std::vector<Chunk> m_chunks;
+    Key m_key;
+
+    std::atomic<bool> m_valid = false;
+    std::mutex m_updateMutex;
+};
+} // namespace mu::engraving
+#endif
@@ -80,6 +80,8 @@ set(DOM_SRC
     ${CMAKE_CURRENT_LIST_DIR}/deadslapped.h
     ${CMAKE_CURRENT_LIST_DIR}/drumset.cpp
     ${CMAKE_CURRENT_LIST_DIR}/drumset.h
+    ${CMAKE_CURRENT_LIST_DIR}/displaylist.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/displaylist.h
     ${CMAKE_CURRENT_LIST_DIR}/durationelement.cpp
     ${CMAKE_CURRENT_LIST_DIR}/durationelement.h
     ${CMAKE_CURRENT_LIST_DIR}/durationtype.cpp
@@ -277,6 +279,8 @@ set(DOM_SRC
     ${CMAKE_CURRENT_LIST_DIR}/spanner.h
     ${CMAKE_CURRENT_LIST_DIR}/spannermap.cpp
     ${CMAKE_CURRENT_LIST_DIR}/spannermap.h
+    ${CMAKE_CURRENT_LIST_DIR}/spatialindex.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/spatialindex.h
     ${CMAKE_CURRENT_LIST_DIR}/splitMeasure.cpp
     ${CMAKE_CURRENT_LIST_DIR}/staff.cpp
     ${CMAKE_CURRENT_LIST_DIR}/staff.h
@@ -334,6 +338,8 @@ set(DOM_SRC
     ${CMAKE_CURRENT_LIST_DIR}/textline.h
     ${CMAKE_CURRENT_LIST_DIR}/textlinebase.cpp
     ${CMAKE_CURRENT_LIST_DIR}/textlinebase.h
+    ${CMAKE_CURRENT_LIST_DIR}/textshapingcache.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/textshapingcache.h
     ${CMAKE_CURRENT_LIST_DIR}/tie.cpp
     ${CMAKE_CURRENT_LIST_DIR}/tie.h
     ${CMAKE_CURRENT_LIST_DIR}/tiemap.h
@@ -102,7 +102,6 @@ EngravingItem::EngravingItem(const EngravingItem& e)
     m_z          = e.m_z;
     m_color      = e.m_color;
     m_minDistance = e.m_minDistance;
-    itemDiscovered = false;
 
     m_accessibleEnabled = e.m_accessibleEnabled;
 }
@@ -2434,7 +2433,44 @@ bool EngravingItem::selected() const
 
 void EngravingItem::setSelected(bool f)
 {
+    if (selected() == f) {
+        return;
+    }
+
     setFlag(ElementFlag::SELECTED, f);
+
+    // selected items are painted in another color
+    invalidateDisplayList();
+}
+
+void EngravingItem::setDropTarget(bool v) const
+{
+    if (dropTarget() == v) {
+        return;
+    }
+
+    setFlag(ElementFlag::DROP_TARGET, v);
+
+    // drop targets are painted in the highlight color
+    invalidateDisplayList();
+}
+
+//---------------------------------------------------------
+//   invalidateDisplayList
+//    the item is painted differently without a relayout,
+//    so the recorded paint commands of its system are outdated
+//---------------------------------------------------------
+
+void EngravingItem::invalidateDisplayList() const
+{
+    EngravingItem* item = const_cast<EngravingItem*>(this);
+    if (System* system = toSystem(item->findAncestor(ElementType::SYSTEM))) {
+        if (system->page()) {
+            system->page()->displayList().invalidate(system);
+        }
+    } else if (Page* page = toPage(item->findAncestor(ElementType::PAGE))) {
+        page->displayList().invalidate();
+    }
 }
 
 #ifndef ENGRAVING_NO_ACCESSIBILITY
@@ -393,8 +393,6 @@ public:
  */
     virtual bool mousePress(EditData&) { return false; }
 
-    mutable bool itemDiscovered = false;       // helper flag for bsp
-
     void scanElements(void* data, void (* func)(void*, EngravingItem*), bool all=true) override;
 
     virtual void reset() override;           // reset all properties & position to default
@@ -418,7 +416,7 @@ public:
     void setSelectable(bool val) { setFlag(ElementFlag::NOT_SELECTABLE, !val); }
 
     bool dropTarget() const { return flag(ElementFlag::DROP_TARGET); }
-    void setDropTarget(bool v) const { setFlag(ElementFlag::DROP_TARGET, v); }
+    void setDropTarget(bool v) const;
 
     bool composition() const { return flag(ElementFlag::COMPOSITION); }
     void setComposition(bool v) const { setFlag(ElementFlag::COMPOSITION, v); }
@@ -696,6 +694,8 @@ protected:
     virtual const LayoutData* ldataInternal() const;
     virtual LayoutData* mutldataInternal();
 
+    void invalidateDisplayList() const;
+
     mutable int m_z = 0;
     Color m_color;                // element color attribute
 
@@ -354,6 +354,11 @@ public:
     // parameter, meaning it can't be any narrower than it currently is.
     void setWidthLocked(bool b) { m_isWidthLocked = b; }
 
+    bool isWidthEstimated() const { return m_isWidthEstimated; }
+    // In continuous view, a measure far from the viewport only gets an estimated width,
+    // its segments and elements are laid out when it is scrolled into view.
+    void setWidthEstimated(bool b) { m_isWidthEstimated = b; }
+
     double squeezableSpace() const { return m_squeezableSpace; }
     void setSqueezableSpace(double val) { m_squeezableSpace = val; }
 
@@ -402,6 +407,7 @@ private:
 
     double m_layoutStretch = 1.0;
     bool m_isWidthLocked = false;
+    bool m_isWidthEstimated = false;
 };
 } // namespace mu::engraving
 #endif
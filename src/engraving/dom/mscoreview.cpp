@@ -125,7 +125,6 @@ const std::vector<EngravingItem*> MuseScoreView::elementsNear(const PointF& pos)
         }
     }
     for (EngravingItem* e : el) {
-        e->itemDiscovered = 0;
         if (!e->selectable() || e->isPage()) {
             continue;
         }
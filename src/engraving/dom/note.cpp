@@ -685,6 +685,18 @@ Note::Note(const Note& n, bool link)
     setDropTarget(false);
 }
 
+void Note::setMark(bool v) const
+{
+    if (m_mark == v) {
+        return;
+    }
+
+    m_mark = v;
+
+    // marked notes are painted in the selection color
+    invalidateDisplayList();
+}
+
 void Note::setParent(Chord* ch)
 {
     EngravingItem::setParent(ch);
@@ -382,7 +382,7 @@ public:
     PropertyValue propertyDefault(Pid) const override;
 
     bool mark() const { return m_mark; }
-    void setMark(bool v) const { m_mark = v; }
+    void setMark(bool v) const;
     void setScore(Score* s) override;
     void setDotRelativeLine(int);
 
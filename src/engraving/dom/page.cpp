@@ -44,6 +44,8 @@ namespace mu::engraving {
 //extern String revision;
 static String revision;
 
+static std::atomic<uint64_t> s_lastLayoutRevision = 0;
+
 //---------------------------------------------------------
 //   Page
 //---------------------------------------------------------
@@ -51,7 +53,35 @@ static String revision;
 Page::Page(RootItem* parent)
     : EngravingItem(ElementType::PAGE, parent, ElementFlag::NOT_SELECTABLE), m_no(0)
 {
-    m_bspTreeValid = false;
+    m_layoutRevision = ++s_lastLayoutRevision;
+}
+
+//---------------------------------------------------------
+//   invalidateSpatialIndex
+//---------------------------------------------------------
+
+void Page::invalidateSpatialIndex()
+{
+    m_spatialIndex.invalidate();
+    m_displayList.invalidate();
+    m_layoutRevision = ++s_lastLayoutRevision;
+
+    for (System* s : m_systems) {
+        s->invalidateLayoutRevision();
+    }
+}
+
+void Page::invalidateSpatialIndex(const System* system)
+{
+    m_spatialIndex.invalidate(system);
+    m_displayList.invalidate(system);
+    m_layoutRevision = ++s_lastLayoutRevision;
+
+    for (System* s : m_systems) {
+        if (s == system) {
+            s->invalidateLayoutRevision();
+        }
+    }
 }
 
 //---------------------------------------------------------
@@ -60,18 +90,14 @@ Page::Page(RootItem* parent)
 
 std::vector<EngravingItem*> Page::items(const RectF& rect)
 {
-    if (!m_bspTreeValid) {
-        doRebuildBspTree();
-    }
-    return bspTree.items(rect);
+    m_spatialIndex.update(this);
+    return m_spatialIndex.items(rect);
 }
 
 std::vector<EngravingItem*> Page::items(const PointF& point)
 {
-    if (!m_bspTreeValid) {
-        doRebuildBspTree();
-    }
-    return bspTree.items(point);
+    m_spatialIndex.update(this);
+    return m_spatialIndex.items(point);
 }
 
 //---------------------------------------------------------
@@ -249,50 +275,6 @@ void Page::scanElements(void* data, void (* func)(void*, EngravingItem*), bool a
     func(data, this);
 }
 
-//---------------------------------------------------------
-//   bspInsert
-//---------------------------------------------------------
-
-static void bspInsert(void* bspTree, EngravingItem* e)
-{
-    ((BspTree*)bspTree)->insert(e);
-}
-
-static void countElements(void* data, EngravingItem* /*e*/)
-{
-    ++(*(int*)data);
-}
-
-//---------------------------------------------------------
-//   doRebuildBspTree
-//---------------------------------------------------------
-
-void Page::doRebuildBspTree()
-{
-    int n = 0;
-    scanElements(&n, countElements, false);
-
-    RectF r;
-    if (score()->linearMode()) {
-        double w = 0.0;
-        double h = 0.0;
-        if (!m_systems.empty()) {
-            h = m_systems.front()->height();
-            if (!m_systems.front()->measures().empty()) {
-                MeasureBase* mb = m_systems.front()->measures().back();
-                w = mb->x() + mb->width();
-            }
-        }
-        r = RectF(0.0, 0.0, w, h);
-    } else {
-        r = abbox();
-    }
-
-    bspTree.initialize(r, n);
-    scanElements(&bspTree, &bspInsert, false);
-    m_bspTreeValid = true;
-}
-
 //---------------------------------------------------------
 //   replaceTextMacros
 //   (keep in sync with toolTipHeaderFooter in EditStyle::EditStyle())
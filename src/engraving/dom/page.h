@@ -25,8 +25,9 @@
 
 #include <vector>
 
+#include "displaylist.h"
 #include "engravingitem.h"
-#include "bsp.h"
+#include "spatialindex.h"
 
 namespace mu::engraving {
 class RootItem;
@@ -75,7 +76,15 @@ public:
 
     std::vector<EngravingItem*> items(const RectF& r);
     std::vector<EngravingItem*> items(const PointF& p);
-    void invalidateBspTree() { m_bspTreeValid = false; }
+    // also invalidate the display list
+    void invalidateSpatialIndex();
+    void invalidateSpatialIndex(const System* system);
+
+    PageDisplayList& displayList() { return m_displayList; }
+
+    // changes whenever the page content is laid out again,
+    // unique across all pages (used by view caches)
+    uint64_t layoutRevision() const { return m_layoutRevision; }
     PointF pagePos() const override { return PointF(); }       ///< position in page coordinates
     std::vector<EngravingItem*> elements() const;              ///< list of visible elements
     RectF tbbox() const;                             // tight bounding box, excluding white space
@@ -92,14 +101,14 @@ private:
     friend class Factory;
     Page(RootItem* parent);
 
-    void doRebuildBspTree();
     String replaceTextMacros(const String&) const;
 
     std::vector<System*> m_systems;
     page_idx_t m_no = 0;                        // page number
 
-    BspTree bspTree;
-    bool m_bspTreeValid = false;
+    PageSpatialIndex m_spatialIndex;
+    PageDisplayList m_displayList;
+    uint64_t m_layoutRevision = 0;
 };
 } // namespace mu::engraving
 #endif
@@ -36,10 +36,12 @@
 #include "measure.h"
 #include "measurerepeat.h"
 #include "note.h"
+#include "page.h"
 #include "score.h"
 #include "segment.h"
 #include "staff.h"
 #include "stafftype.h"
+#include "system.h"
 #include "undo.h"
 
 #include "log.h"
@@ -158,7 +160,13 @@ RectF Rest::drag(EditData& ed)
 
     renderer()->layoutItem(this);
 
-    score()->rebuildBspTree();
+    // only the system of this rest has changed
+    System* system = measure() ? measure()->system() : nullptr;
+    if (system && system->page()) {
+        system->page()->invalidateSpatialIndex(system);
+    } else {
+        score()->invalidateSpatialIndex();
+    }
     return abbox().united(r);
 }
 
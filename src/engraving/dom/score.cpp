@@ -27,6 +27,7 @@
 
 #include "score.h"
 
+#include <algorithm>
 #include <cmath>
 #include <map>
 
@@ -173,6 +174,10 @@ Score::Score(const modularity::ContextPtr& iocCtx)
 
     m_shadowNote = new ShadowNote(this);
     m_shadowNote->setVisible(false);
+
+#ifdef MUE_ENABLE_ENGRAVING_PARALLEL_LAYOUT
+    m_layoutOptions.isParallelLayout = true;
+#endif
 }
 
 Score::Score(MasterScore* parent, bool forcePartStyle /* = true */)
@@ -699,10 +704,10 @@ void Score::dragPosition(const PointF& p, staff_idx_t* rst, Segment** seg, doubl
 void Score::setShowInvisible(bool v)
 {
     m_showInvisible = v;
-    // BSP tree does not include elements which are not
+    // The spatial index does not include elements which are not
     // displayed, so we need to refresh it to get
     // invisible elements displayed or properly hidden.
-    rebuildBspTree();
+    invalidateSpatialIndex();
 }
 
 //---------------------------------------------------------
@@ -5546,10 +5551,10 @@ ShadowNote* Score::shadowNote() const
     return m_shadowNote;
 }
 
-void Score::rebuildBspTree()
+void Score::invalidateSpatialIndex()
 {
     for (Page* page : pages()) {
-        page->invalidateBspTree();
+        page->invalidateSpatialIndex();
     }
 }
 
@@ -5684,6 +5689,15 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
 {
     TRACEFUNC;
 
+    if (m_layoutDeferred) {
+        // nothing has been laid out since the layout was deferred
+        m_layoutDeferred = false;
+        if (st != Fraction(0, 1) || et != Fraction(-1, 1)) {
+            doLayoutRange(Fraction(0, 1), Fraction(-1, 1));
+            return;
+        }
+    }
+
     Fraction start = st;
     Fraction end = et;
 
@@ -5708,6 +5722,9 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
 
     renderer()->layoutScore(this, start, end);
 
+    // the page limit applies to one layout only
+    m_layoutOptions.maxPages = 0;
+
     if (m_resetAutoplace) {
         m_resetAutoplace = false;
         resetAutoplace();
@@ -5719,6 +5736,140 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
     }
 }
 
+//---------------------------------------------------------
+//   lastLaidOutMeasure
+//---------------------------------------------------------
+
+static const MeasureBase* lastLaidOutMeasure(const Score* score)
+{
+    for (auto it = score->pages().crbegin(); it != score->pages().crend(); ++it) {
+        const std::vector<System*>& systems = (*it)->systems();
+        if (!systems.empty() && !systems.back()->measures().empty()) {
+            return systems.back()->measures().back();
+        }
+    }
+
+    return nullptr;
+}
+
+//---------------------------------------------------------
+//   isLayoutComplete
+//    false while a progressive layout has pages left
+//---------------------------------------------------------
+
+bool Score::isLayoutComplete() const
+{
+    if (m_layoutDeferred) {
+        return false;
+    }
+
+    if (!isLayoutMode(LayoutMode::PAGE) && !isLayoutMode(LayoutMode::FLOAT)) {
+        return true;
+    }
+
+    const MeasureBase* last = lastLaidOutMeasure(this);
+    if (!last) {
+        return !firstMeasure();
+    }
+
+    const MeasureBase* next = last->next();
+    while (next && next->isBox() && !m_layoutOptions.isShowVBox) {
+        next = next->next();
+    }
+
+    return !next;
+}
+
+//---------------------------------------------------------
+//   layoutNextPages
+//    continues a progressive layout from its last page,
+//    which is laid out again together with the next pageCount pages
+//    (all remaining pages if pageCount is 0)
+//---------------------------------------------------------
+
+bool Score::layoutNextPages(size_t pageCount)
+{
+    TRACEFUNC;
+
+    if (isLayoutComplete()) {
+        return true;
+    }
+
+    // the pages of a deferred layout are out of date
+    const MeasureBase* last = m_layoutDeferred ? nullptr : lastLaidOutMeasure(this);
+    const Fraction stick = last ? last->endTick() : Fraction(0, 1);
+
+    m_layoutOptions.maxPages = pageCount ? npages() + pageCount : 0;
+    doLayoutRange(stick, Fraction(-1, 1));
+
+    // no progress means nothing is left that can be laid out
+    return isLayoutComplete() || lastLaidOutMeasure(this) == last;
+}
+
+void Score::ensurePageLaidOut(page_idx_t pageIdx)
+{
+    static constexpr size_t PAGES_PER_STEP = 8;
+
+    while (m_layoutDeferred || npages() <= pageIdx) {
+        if (layoutNextPages(PAGES_PER_STEP)) {
+            break;
+        }
+    }
+}
+
+void Score::ensureLayoutComplete()
+{
+    layoutNextPages(0);
+}
+
+//---------------------------------------------------------
+//   setLayoutViewport
+//    lays out the measures with estimated widths
+//    that have been scrolled into view
+//---------------------------------------------------------
+
+bool Score::setLayoutViewport(double x, double width)
+{
+    m_layoutOptions.viewportX = x;
+    m_layoutOptions.viewportWidth = width;
+
+    if (!m_layoutOptions.isLinearMode() || !m_layoutOptions.hasViewport() || systems().empty()) {
+        return false;
+    }
+
+    const double left = m_layoutOptions.viewportLayoutLeft();
+    const double right = m_layoutOptions.viewportLayoutRight();
+
+    // the measures of the system are ordered by x, so only the ones in the layout range are visited
+    const System* system = systems().front();
+    const double systemX = system->canvasPos().x();
+    const std::vector<MeasureBase*>& measures = system->measures();
+    auto it = std::lower_bound(measures.begin(), measures.end(), left - systemX, [](const MeasureBase* mb, double x) {
+        return mb->x() + mb->width() < x;
+    });
+
+    const Measure* first = nullptr;
+    const Measure* last = nullptr;
+    for (; it != measures.end() && (*it)->x() <= right - systemX; ++it) {
+        const MeasureBase* mb = *it;
+        if (!mb->isMeasure() || !toMeasure(mb)->isWidthEstimated()) {
+            continue;
+        }
+        if (!first) {
+            first = toMeasure(mb);
+        }
+        last = toMeasure(mb);
+    }
+
+    if (!first) {
+        return false;
+    }
+
+    doLayoutRange(first->tick(), last->tick());
+
+    return true;
+}
+
 void Score::createPaddingTable()
 {
     m_paddingTable.createTable(style());
@@ -29,6 +29,7 @@
 */
 
 #include <set>
+#include <unordered_set>
 #include <memory>
 #include <optional>
 
@@ -308,7 +309,7 @@ public:
 
     muse::async::Channel<EngravingItem*> elementDestroyed();
 
-    void rebuildBspTree();
+    void invalidateSpatialIndex();
     bool noStaves() const { return m_staves.empty(); }
     void insertPart(Part*, size_t targetPartIdx);
     void appendPart(Part*);
@@ -814,6 +815,29 @@ public:
     void doLayout();
     void doLayoutRange(const Fraction& st, const Fraction& et);
 
+    // progressive layout: the next layout of the page view stops after pageCount pages,
+    // the remaining pages are laid out by layoutNextPages()
+    void setLayoutPageLimit(size_t pageCount) { m_layoutOptions.maxPages = pageCount; }
+    bool isLayoutComplete() const;
+    bool layoutNextPages(size_t pageCount);     // returns true when the layout is complete
+    void ensurePageLaidOut(page_idx_t pageIdx);
+    void ensureLayoutComplete();
+
+    // deferred layout: the score is not laid out by update() until its pages are needed
+    // (layoutNextPages(), ensurePageLaidOut(), ensureLayoutComplete() or an explicit layout),
+    // which then lays it out from the start. Used for the parts that are not shown yet
+    void setLayoutDeferred(bool deferred) { m_layoutDeferred = deferred; }
+    bool isLayoutDeferred() const { return m_layoutDeferred; }
+
+    // continuous view: only the measures near the viewport are laid out completely,
+    // the other ones get an estimated width until they are scrolled into view
+    bool setLayoutViewport(double x, double width);     // returns true if measures were laid out
+
+    // the segments whose shape arena is built, so the layout releases only these, see Segment::shapeArena()
+    void addBuiltShapeArena(Segment* s) { m_builtShapeArenas.insert(s); }
+    void removeBuiltShapeArena(Segment* s) { m_builtShapeArenas.erase(s); }
+    std::unordered_set<Segment*> takeBuiltShapeArenas() { return std::move(m_builtShapeArenas); }
+
     SynthesizerState& synthesizerState() { return m_synthesizerState; }
     void setSynthesizerState(const SynthesizerState& s);
 
@@ -851,6 +875,8 @@ public:
     void setShowVBox(bool v) { m_layoutOptions.isShowVBox = v; }
     double noteHeadWidth() const { return m_layoutOptions.noteHeadWidth; }
     void setNoteHeadWidth(double n) { m_layoutOptions.noteHeadWidth = n; }
+    void setParallelLayout(bool v) { m_layoutOptions.isParallelLayout = v; }
+    void setMeasureWidthCacheEnabled(bool v) { m_layoutOptions.isMeasureWidthCacheEnabled = v; }
 
     // temporary methods
     bool isLayoutMode(LayoutMode lm) const { return m_layoutOptions.isMode(lm); }
@@ -1122,6 +1148,8 @@ private:
     int m_mscVersion = Constants::MSC_VERSION;     // version of current loading *.msc file
 
     bool m_isOpen = false;
+    bool m_layoutDeferred = false;
+    std::unordered_set<Segment*> m_builtShapeArenas;
     bool m_needSetUpTempoMap = true;
 
     std::map<String, String> m_metaTags;
@@ -207,6 +207,9 @@ void Segment::setSegmentType(SegmentType t)
 
 void Segment::setScore(Score* score)
 {
+    // the built arena is recorded in the previous score
+    releaseShapeArena();
+
     EngravingItem::setScore(score);
     for (EngravingItem* e : m_elist) {
         if (e) {
@@ -220,6 +223,8 @@ void Segment::setScore(Score* score)
 
 Segment::~Segment()
 {
+    releaseShapeArena();
+
     for (EngravingItem* e : m_elist) {
         if (!e) {
             continue;
@@ -256,6 +261,7 @@ void Segment::init()
     m_elist.assign(tracks, 0);
     m_preAppendedItems.assign(tracks, 0);
     m_shapes.assign(staves, Shape());
+    ++m_shapesRevision;
 }
 
 //---------------------------------------------------------
@@ -618,6 +624,7 @@ void Segment::insertStaff(staff_idx_t staff)
         m_preAppendedItems.insert(m_preAppendedItems.begin() + track, 0);
     }
     m_shapes.insert(m_shapes.begin() + staff, Shape());
+    ++m_shapesRevision;
 
     for (EngravingItem* e : m_annotations) {
         if (moveDownWhenAddingStaves(e, staff)) {
@@ -637,6 +644,7 @@ void Segment::removeStaff(staff_idx_t staff)
     m_elist.erase(m_elist.begin() + track, m_elist.begin() + track + VOICES);
     m_preAppendedItems.erase(m_preAppendedItems.begin() + track, m_preAppendedItems.begin() + track + VOICES);
     m_shapes.erase(m_shapes.begin() + staff);
+    ++m_shapesRevision;
 
     for (EngravingItem* e : m_annotations) {
         staff_idx_t staffIdx = e->staffIdx();
@@ -2441,6 +2449,8 @@ void Segment::createShapes()
 
 void Segment::createShape(staff_idx_t staffIdx)
 {
+    ++m_shapesRevision;
+
     Shape& s = m_shapes[staffIdx];
     s.clear();
 
@@ -2542,6 +2552,8 @@ void Segment::createShape(staff_idx_t staffIdx)
 
 void Segment::addPreAppendedToShape()
 {
+    ++m_shapesRevision;
+
     track_idx_t tracks = score()->ntracks();
     for (unsigned track = 0; track < tracks; ++track) {
         if (!m_preAppendedItems[track]) {
@@ -2557,6 +2569,39 @@ void Segment::addPreAppendedToShape()
     }
 }
 
+//---------------------------------------------------------
+//   shapeArena
+//    not thread-safe: built on first use after the shapes have changed
+//---------------------------------------------------------
+
+const ShapeArena& Segment::shapeArena() const
+{
+    if (!m_shapeArenaValid || m_shapeArenaRevision != m_shapesRevision) {
+        m_shapeArena.build(m_shapes);
+        m_shapeArenaRevision = m_shapesRevision;
+        m_shapeArenaValid = true;
+        score()->addBuiltShapeArena(const_cast<Segment*>(this));
+    }
+    return m_shapeArena;
+}
+
+//---------------------------------------------------------
+//   releaseShapeArena
+//    the arena duplicates the shapes, it is only worth
+//    keeping while the segment is being spaced
+//---------------------------------------------------------
+
+void Segment::releaseShapeArena()
+{
+    if (!m_shapeArenaValid) {
+        return;
+    }
+
+    m_shapeArena.release();
+    m_shapeArenaValid = false;
+    score()->removeBuiltShapeArena(this);
+}
+
 //---------------------------------------------------------
 //   minRight
 //    calculate minimum distance needed to the right
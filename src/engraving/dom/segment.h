@@ -23,7 +23,10 @@
 #ifndef MU_ENGRAVING_SEGMENT_H
 #define MU_ENGRAVING_SEGMENT_H
 
+#include <atomic>
+
 #include "engravingitem.h"
+#include "../infrastructure/shapearena.h"
 
 #include "types.h"
 
@@ -249,9 +252,14 @@ public:
     std::vector<Shape> shapes() { return m_shapes; }
     const std::vector<Shape>& shapes() const { return m_shapes; }
     const Shape& staffShape(staff_idx_t staffIdx) const { return m_shapes[staffIdx]; }
-    Shape& staffShape(staff_idx_t staffIdx) { return m_shapes[staffIdx]; }
+    Shape& staffShape(staff_idx_t staffIdx) { ++m_shapesRevision; return m_shapes[staffIdx]; }
     void createShapes();
     void createShape(staff_idx_t staffIdx);
+    // changes whenever the shapes may have been modified
+    size_t shapesRevision() const { return m_shapesRevision; }
+    // the shapes in contiguous arrays for horizontal spacing, rebuilt when they have changed
+    const ShapeArena& shapeArena() const;
+    void releaseShapeArena();
     double minRight() const;
     double minLeft() const;
 
@@ -331,6 +339,10 @@ private:
     std::vector<EngravingItem*> m_elist;         // EngravingItem storage, size = staves * VOICES.
     std::vector<EngravingItem*> m_preAppendedItems; // Container for items appended to the left of this segment (example: grace notes), size = staves * VOICES.
     std::vector<Shape> m_shapes;           // size = staves
+    std::atomic<size_t> m_shapesRevision { 0 };   // bumped by the chords layout of concurrently laid out staves
+    mutable ShapeArena m_shapeArena;
+    mutable size_t m_shapeArenaRevision = 0;
+    mutable bool m_shapeArenaValid = false;
     double m_spacing = 0;
 
     CrossBeamType m_crossBeamType; // Will affect segment-to-segment horizontal spacing
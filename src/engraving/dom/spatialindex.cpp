@@ -0,0 +1,332 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "spatialindex.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "engravingitem.h"
+#include "measurebase.h"
+#include "page.h"
+#include "system.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+//---------------------------------------------------------
+//   build
+//---------------------------------------------------------
+
+void SpatialIndex::build(std::vector<Entry>&& entries)
+{
+    clear();
+
+    if (entries.empty()) {
+        return;
+    }
+
+    // Sort-Tile-Recursive: cut the entries into vertical slices by x,
+    // then sort every slice by y, so that consecutive entries are close
+    const size_t count = entries.size();
+    const size_t leafCount = (count + NODE_CAPACITY - 1) / NODE_CAPACITY;
+    const size_t sliceCount = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(leafCount))));
+    const size_t sliceSize = sliceCount * NODE_CAPACITY;
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& e1, const Entry& e2) {
+        return e1.rect.center().x() < e2.rect.center().x();
+    });
+
+    for (size_t sliceBegin = 0; sliceBegin < count; sliceBegin += sliceSize) {
+        auto begin = entries.begin() + sliceBegin;
+        auto end = entries.begin() + std::min(sliceBegin + sliceSize, count);
+        std::sort(begin, end, [](const Entry& e1, const Entry& e2) {
+            return e1.rect.center().y() < e2.rect.center().y();
+        });
+    }
+
+    size_t nodeCount = 0;
+    for (size_t levelSize = count; levelSize > 1;) {
+        levelSize = (levelSize + NODE_CAPACITY - 1) / NODE_CAPACITY;
+        nodeCount += levelSize;
+    }
+
+    m_boxes.reserve(count + nodeCount);
+    m_items.reserve(count);
+
+    for (const Entry& entry : entries) {
+        m_boxes.push_back({ entry.rect.left(), entry.rect.top(), entry.rect.right(), entry.rect.bottom() });
+        m_items.push_back(entry.item);
+    }
+
+    // Pack every NODE_CAPACITY boxes of a level into one box of the next level, up to the root
+    size_t levelBegin = 0;
+    size_t levelEnd = count;
+    m_levelBegins.push_back(levelBegin);
+
+    while (levelEnd - levelBegin > 1) {
+        for (size_t childIdx = levelBegin; childIdx < levelEnd; childIdx += NODE_CAPACITY) {
+            Box node = m_boxes[childIdx];
+            const size_t childEnd = std::min(childIdx + NODE_CAPACITY, levelEnd);
+
+            for (size_t i = childIdx + 1; i < childEnd; ++i) {
+                const Box& child = m_boxes[i];
+                node.left = std::min(node.left, child.left);
+                node.top = std::min(node.top, child.top);
+                node.right = std::max(node.right, child.right);
+                node.bottom = std::max(node.bottom, child.bottom);
+            }
+
+            m_boxes.push_back(node);
+        }
+
+        levelBegin = levelEnd;
+        levelEnd = m_boxes.size();
+        m_levelBegins.push_back(levelBegin);
+    }
+}
+
+//---------------------------------------------------------
+//   clear
+//---------------------------------------------------------
+
+void SpatialIndex::clear()
+{
+    m_boxes.clear();
+    m_levelBegins.clear();
+    m_items.clear();
+}
+
+//---------------------------------------------------------
+//   query
+//---------------------------------------------------------
+
+void SpatialIndex::query(const RectF& rect, std::vector<EngravingItem*>& result) const
+{
+    if (m_items.empty()) {
+        return;
+    }
+
+    const Box box { rect.left(), rect.top(), rect.right(), rect.bottom() };
+    query(box, m_levelBegins.size() - 1, 0, result);
+}
+
+void SpatialIndex::query(const PointF& pos, std::vector<EngravingItem*>& result) const
+{
+    if (m_items.empty()) {
+        return;
+    }
+
+    const Box box { pos.x(), pos.y(), pos.x(), pos.y() };
+    query(box, m_levelBegins.size() - 1, 0, result);
+}
+
+void SpatialIndex::query(const Box& box, size_t level, size_t nodeIdx, std::vector<EngravingItem*>& result) const
+{
+    const Box& node = m_boxes[m_levelBegins[level] + nodeIdx];
+    if (node.left > box.right || node.right < box.left || node.top > box.bottom || node.bottom < box.top) {
+        return;
+    }
+
+    if (level == 0) {
+        result.push_back(m_items[nodeIdx]);
+        return;
+    }
+
+    const size_t childLevelSize = m_levelBegins[level] - m_levelBegins[level - 1];
+    const size_t childBegin = nodeIdx * NODE_CAPACITY;
+    const size_t childEnd = std::min(childBegin + NODE_CAPACITY, childLevelSize);
+
+    for (size_t childIdx = childBegin; childIdx < childEnd; ++childIdx) {
+        query(box, level - 1, childIdx, result);
+    }
+}
+
+//---------------------------------------------------------
+//   PageSpatialIndex
+//---------------------------------------------------------
+
+PageSpatialIndex::PageSpatialIndex(const PageSpatialIndex&)
+{
+    // copies are built on the first query
+}
+
+PageSpatialIndex& PageSpatialIndex::operator=(const PageSpatialIndex&)
+{
+    invalidate();
+    return *this;
+}
+
+//---------------------------------------------------------
+//   invalidate
+//---------------------------------------------------------
+
+void PageSpatialIndex::invalidate()
+{
+    for (SystemIndex& systemIndex : m_systemIndexes) {
+        systemIndex.valid = false;
+    }
+
+    m_pageIndexValid = false;
+    m_valid = false;
+}
+
+void PageSpatialIndex::invalidate(const System* system)
+{
+    for (SystemIndex& systemIndex : m_systemIndexes) {
+        if (systemIndex.system == system) {
+            systemIndex.valid = false;
+        }
+    }
+
+    m_valid = false;
+}
+
+//---------------------------------------------------------
+//   collectEntry
+//---------------------------------------------------------
+
+struct CollectEntriesData {
+    std::vector<SpatialIndex::Entry> entries;
+    PointF origin;
+};
+
+static void collectEntry(void* data, EngravingItem* item)
+{
+    CollectEntriesData* collectData = static_cast<CollectEntriesData*>(data);
+    collectData->entries.push_back({ item->pageBoundingRect().translated(-collectData->origin), item });
+}
+
+//---------------------------------------------------------
+//   update
+//---------------------------------------------------------
+
+void PageSpatialIndex::update(Page* page)
+{
+    if (m_valid.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    std::lock_guard lock(m_updateMutex);
+
+    if (m_valid.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    std::vector<SystemIndex> systemIndexes;
+    systemIndexes.reserve(page->systems().size());
+
+    for (System* system : page->systems()) {
+        auto it = std::find_if(m_systemIndexes.begin(), m_systemIndexes.end(), [system](const SystemIndex& systemIndex) {
+            return systemIndex.system == system;
+        });
+
+        if (it != m_systemIndexes.end() && it->valid) {
+            systemIndexes.push_back(std::move(*it));
+            continue;
+        }
+
+        CollectEntriesData data;
+        data.origin = system->pagePos();
+
+        for (MeasureBase* mb : system->measures()) {
+            mb->scanElements(&data, collectEntry, false);
+        }
+        system->scanElements(&data, collectEntry, false);
+
+        SystemIndex systemIndex;
+        systemIndex.system = system;
+        systemIndex.origin = data.origin;
+        systemIndex.index.build(std::move(data.entries));
+        systemIndex.valid = true;
+
+        systemIndexes.push_back(std::move(systemIndex));
+    }
+
+    m_systemIndexes = std::move(systemIndexes);
+
+    if (!m_pageIndexValid) {
+        CollectEntriesData data;
+        collectEntry(&data, page);
+        m_pageIndex.build(std::move(data.entries));
+        m_pageIndexValid = true;
+    }
+
+    m_valid.store(true, std::memory_order_release);
+}
+
+//---------------------------------------------------------
+//   removeDuplicates
+//    an item may be reached from more than one system
+//---------------------------------------------------------
+
+static void removeDuplicates(std::vector<EngravingItem*>& items)
+{
+    std::sort(items.begin(), items.end());
+    items.erase(std::unique(items.begin(), items.end()), items.end());
+}
+
+//---------------------------------------------------------
+//   items
+//---------------------------------------------------------
+
+std::vector<EngravingItem*> PageSpatialIndex::items(const RectF& rect) const
+{
+    std::vector<EngravingItem*> candidates;
+
+    for (const SystemIndex& systemIndex : m_systemIndexes) {
+        const PointF offset = systemIndex.system->pagePos() - systemIndex.origin;
+        systemIndex.index.query(rect.translated(-offset), candidates);
+    }
+    m_pageIndex.query(rect, candidates);
+    removeDuplicates(candidates);
+
+    std::vector<EngravingItem*> result;
+    for (EngravingItem* item : candidates) {
+        if (item->pageBoundingRect().intersects(rect)) {
+            result.push_back(item);
+        }
+    }
+
+    return result;
+}
+
+std::vector<EngravingItem*> PageSpatialIndex::items(const PointF& pos) const
+{
+    std::vector<EngravingItem*> candidates;
+
+    for (const SystemIndex& systemIndex : m_systemIndexes) {
+        const PointF offset = systemIndex.system->pagePos() - systemIndex.origin;
+        systemIndex.index.query(pos - offset, candidates);
+    }
+    m_pageIndex.query(pos, candidates);
+    removeDuplicates(candidates);
+
+    std::vector<EngravingItem*> result;
+    for (EngravingItem* item : candidates) {
+        if (item->contains(pos)) {
+            result.push_back(item);
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,120 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_SPATIALINDEX_H
+#define MU_ENGRAVING_SPATIALINDEX_H
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "../types/types.h"
+
+namespace mu::engraving {
+class EngravingItem;
+class Page;
+class System;
+
+//---------------------------------------------------------
+//   SpatialIndex
+//    packed R-tree, bulk loaded with Sort-Tile-Recursive.
+//    The index is read-only after build() and queries
+//    don't touch the items, so it can be queried from
+//    several threads at once
+//---------------------------------------------------------
+
+class SpatialIndex
+{
+public:
+    struct Entry {
+        RectF rect;
+        EngravingItem* item = nullptr;
+    };
+
+    void build(std::vector<Entry>&& entries);
+    void clear();
+
+    bool empty() const { return m_items.empty(); }
+    size_t size() const { return m_items.size(); }
+
+    // Append the items whose indexed rects intersect rect / contain pos
+    void query(const RectF& rect, std::vector<EngravingItem*>& result) const;
+    void query(const PointF& pos, std::vector<EngravingItem*>& result) const;
+
+private:
+    static constexpr size_t NODE_CAPACITY = 16;
+
+    struct Box {
+        double left = 0.0;
+        double top = 0.0;
+        double right = 0.0;
+        double bottom = 0.0;
+    };
+
+    void query(const Box& box, size_t level, size_t nodeIdx, std::vector<EngravingItem*>& result) const;
+
+    // All levels in one array: the entries first, then the nodes of each level up to the root
+    std::vector<Box> m_boxes;
+    std::vector<size_t> m_levelBegins;
+    std::vector<EngravingItem*> m_items;
+};
+
+//---------------------------------------------------------
+//   PageSpatialIndex
+//    one SpatialIndex per system, stored relative to the
+//    system position, so that a moved system keeps its index
+//    and only invalidated systems are rebuilt
+//---------------------------------------------------------
+
+class PageSpatialIndex
+{
+public:
+    PageSpatialIndex() = default;
+    PageSpatialIndex(const PageSpatialIndex&);
+    PageSpatialIndex& operator=(const PageSpatialIndex&);
+
+    void invalidate();
+    void invalidate(const System* system);
+
+    // Rebuild the invalidated parts; thread safe
+    void update(Page* page);
+
+    std::vector<EngravingItem*> items(const RectF& rect) const;
+    std::vector<EngravingItem*> items(const PointF& pos) const;
+
+private:
+    struct SystemIndex {
+        const System* system = nullptr;
+        PointF origin;
+        SpatialIndex index;
+        bool valid = false;
+    };
+
+    std::vector<SystemIndex> m_systemIndexes;
+    SpatialIndex m_pageIndex;
+    bool m_pageIndexValid = false;
+
+    std::atomic<bool> m_valid = false;
+    std::mutex m_updateMutex;
+};
+} // namespace mu::engraving
+#endif
@@ -27,6 +27,8 @@
 
 #include "system.h"
 
+#include <atomic>
+
 #include "style/style.h"
 
 #include "beam.h"
@@ -104,9 +106,26 @@ void SysStaff::restoreLayout()
 //   System
 //---------------------------------------------------------
 
+static std::atomic<uint64_t> s_lastLayoutRevision = 0;
+
 System::System(Page* parent)
     : EngravingItem(ElementType::SYSTEM, parent)
 {
+    m_layoutRevision = ++s_lastLayoutRevision;
+}
+
+//---------------------------------------------------------
+//   invalidateLayoutRevision
+//---------------------------------------------------------
+
+void System::invalidateLayoutRevision()
+{
+    m_layoutRevision = ++s_lastLayoutRevision;
+}
+
+uint64_t System::lastLayoutRevision()
+{
+    return s_lastLayoutRevision;
 }
 
 //---------------------------------------------------------
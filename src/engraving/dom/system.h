@@ -205,6 +205,12 @@ public:
     void setBracketsXPosition(const double xOffset);
     size_t getBracketsColumnsCount();
 
+    // changes whenever the system or its page is laid out again;
+    // increasing across all systems, so it can be compared to lastLayoutRevision()
+    uint64_t layoutRevision() const { return m_layoutRevision; }
+    void invalidateLayoutRevision();
+    static uint64_t lastLayoutRevision();
+
 private:
     friend class Factory;
 
@@ -227,6 +233,7 @@ private:
     mutable bool m_fixedDownDistance = false;
     double m_distance = 0.0;        // temp. variable used during layout
     double m_systemHeight = 0.0;
+    uint64_t m_layoutRevision = 0;
 };
 
 typedef std::vector<System*>::iterator iSystem;
@@ -50,6 +50,7 @@
 #include "page.h"
 #include "score.h"
 #include "textedit.h"
+#include "textshapingcache.h"
 #include "undo.h"
 
 #include "log.h"
@@ -927,30 +928,8 @@ Font TextFragment::font(const TextBase* t) const
         // check if all symbols are available
         font.setFamily(family, fontType);
         font.setNoFontMerging(true);
-        FontMetrics fm(font);
 
-        bool fail = false;
-        for (size_t i = 0; i < text.size(); ++i) {
-            const Char& c = text.at(i);
-            if (c.isHighSurrogate()) {
-                if (i + 1 == text.size()) {
-                    ASSERT_X("bad string");
-                }
-                const Char& c2 = text.at(i + 1);
-                ++i;
-                char32_t v = Char::surrogateToUcs4(c, c2);
-                if (!fm.inFontUcs4(v)) {
-                    fail = true;
-                    break;
-                }
-            } else {
-                if (!fm.inFont(c)) {
-                    fail = true;
-                    break;
-                }
-            }
-        }
-        if (fail) {
+        if (!TextShapingCache::instance()->inFont(font, text)) {
             if (fontType == Font::Type::MusicSymbol) {
                 family = String::fromUtf8(FALLBACK_SYMBOL_FONT);
             } else {
@@ -1028,17 +1007,19 @@ void TextBlock::layout(const TextBase* t)
         }
     }
 
+    TextShapingCache* shapingCache = TextShapingCache::instance();
+
     if (m_fragments.empty()) {
-        FontMetrics fm = t->fontMetrics();
-        m_shape.add(RectF(0.0, -fm.ascent(), 1.0, fm.descent()), t);
-        m_lineSpacing = fm.lineSpacing();
+        const TextShapingCache::FontShape fm = shapingCache->fontShape(t->font());
+        m_shape.add(RectF(0.0, -fm.ascent, 1.0, fm.descent), t);
+        m_lineSpacing = fm.lineSpacing;
     } else if (m_fragments.size() == 1 && m_fragments.front().text.isEmpty()) {
         auto fi = m_fragments.begin();
         TextFragment& f = *fi;
         f.pos.setX(x);
-        FontMetrics fm(f.font(t));
+        const TextShapingCache::FontShape fm = shapingCache->fontShape(f.font(t));
         if (f.format.valign() != VerticalAlignment::AlignNormal) {
-            double voffset = fm.xHeight() / subScriptSize;   // use original height
+            double voffset = fm.xHeight / subScriptSize;   // use original height
             if (f.format.valign() == VerticalAlignment::AlignSubScript) {
                 voffset *= subScriptOffset;
             } else {
@@ -1050,17 +1031,18 @@ void TextBlock::layout(const TextBase* t)
             f.pos.setY(0.0);
         }
 
-        RectF temp(0.0, -fm.ascent(), 1.0, fm.descent());
+        RectF temp(0.0, -fm.ascent, 1.0, fm.descent);
         m_shape.add(temp, t);
-        m_lineSpacing = std::max(m_lineSpacing, fm.lineSpacing());
+        m_lineSpacing = std::max(m_lineSpacing, fm.lineSpacing);
     } else {
         const auto fiLast = --m_fragments.end();
         for (auto fi = m_fragments.begin(); fi != m_fragments.end(); ++fi) {
             TextFragment& f = *fi;
             f.pos.setX(x);
-            FontMetrics fm(f.font(t));
+            const Font font = f.font(t);
+            const TextShapingCache::FontShape fm = shapingCache->fontShape(font);
             if (f.format.valign() != VerticalAlignment::AlignNormal) {
-                double voffset = fm.xHeight() / subScriptSize;           // use original height
+                double voffset = fm.xHeight / subScriptSize;           // use original height
                 if (f.format.valign() == VerticalAlignment::AlignSubScript) {
                     voffset *= subScriptOffset;
                 } else {
@@ -1071,22 +1053,22 @@ void TextBlock::layout(const TextBase* t)
                 f.pos.setY(0.0);
             }
 
+            const TextShapingCache::TextShape shape = shapingCache->textShape(font, f.text);
+
             // Optimization: don't calculate character position
             // for the next fragment if there is no next fragment
             if (fi != fiLast) {
-                const double w  = fm.width(f.text);
-                x += w;
+                x += shape.width;
             }
 
-            m_shape.add(fm.tightBoundingRect(f.text).translated(f.pos), t);
-            Font font = f.font(t);
+            m_shape.add(shape.tightBoundingRect.translated(f.pos), t);
             if (font.type() == Font::Type::MusicSymbol || font.type() == Font::Type::MusicSymbolText) {
                 // SEMI-HACK: Music fonts can have huge linespacing because of tall symbols, so instead of using the
                 // font linespacing value we just use the height of the individual fragment with some added margin
 
                 m_lineSpacing = std::max(m_lineSpacing, 1.25 * m_shape.bbox().height());
             } else {
-                m_lineSpacing = std::max(m_lineSpacing, fm.lineSpacing());
+                m_lineSpacing = std::max(m_lineSpacing, fm.lineSpacing);
             }
         }
     }
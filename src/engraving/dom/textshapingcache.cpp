@@ -0,0 +1,235 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "textshapingcache.h"
+
+#include <functional>
+
+#include "draw/fontmetrics.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::draw;
+using namespace mu::engraving;
+
+static void hashCombine(size_t& seed, size_t value)
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+size_t TextShapingCache::KeyHash::operator()(const Key& key) const
+{
+    const Font& font = key.font;
+
+    size_t seed = key.text.hash();
+    hashCombine(seed, font.family().hash());
+    hashCombine(seed, std::hash<double> {}(font.pointSizeF()));
+    hashCombine(seed, std::hash<int> {}(font.pixelSize()));
+    hashCombine(seed, std::hash<int> {}(static_cast<int>(font.type())));
+    hashCombine(seed, std::hash<int> {}(static_cast<int>(font.weight())));
+
+    const int flags = (font.bold() ? 1 << 0 : 0)
+                      | (font.italic() ? 1 << 1 : 0)
+                      | (font.underline() ? 1 << 2 : 0)
+                      | (font.strike() ? 1 << 3 : 0)
+                      | (font.noFontMerging() ? 1 << 4 : 0)
+                      | (key.fontMergingDisabled ? 1 << 5 : 0);
+    hashCombine(seed, std::hash<int> {}(flags));
+
+    return seed;
+}
+
+TextShapingCache* TextShapingCache::instance()
+{
+    static TextShapingCache s_cache;
+    return &s_cache;
+}
+
+TextShapingCache::Key TextShapingCache::makeKey(const Font& font, const String& text)
+{
+    return Key { font, text, Font::g_disableFontMerging };
+}
+
+TextShapingCache::TextShapingCache(size_t capacity)
+    : m_capacity(capacity)
+{
+}
+
+//---------------------------------------------------------
+//   textShape
+//---------------------------------------------------------
+
+TextShapingCache::TextShape TextShapingCache::textShape(const Font& font, const String& text)
+{
+    Key key = makeKey(font, text);
+    if (std::optional<TextShape> shape = find(key, &Entry::textShape)) {
+        return *shape;
+    }
+
+    //! NOTE Measured outside of the lock, so that the threads laying out
+    //! different texts don't wait for each other
+    FontMetrics fm(font);
+    TextShape shape;
+    shape.width = fm.width(text);
+    shape.tightBoundingRect = fm.tightBoundingRect(text);
+
+    insert(key, &Entry::textShape, shape);
+    return shape;
+}
+
+//---------------------------------------------------------
+//   fontShape
+//---------------------------------------------------------
+
+TextShapingCache::FontShape TextShapingCache::fontShape(const Font& font)
+{
+    Key key = makeKey(font, String());
+    if (std::optional<FontShape> shape = find(key, &Entry::fontShape)) {
+        return *shape;
+    }
+
+    FontMetrics fm(font);
+    FontShape shape;
+    shape.ascent = fm.ascent();
+    shape.descent = fm.descent();
+    shape.xHeight = fm.xHeight();
+    shape.lineSpacing = fm.lineSpacing();
+
+    insert(key, &Entry::fontShape, shape);
+    return shape;
+}
+
+//---------------------------------------------------------
+//   inFont
+//---------------------------------------------------------
+
+bool TextShapingCache::inFont(const Font& font, const String& text)
+{
+    Key key = makeKey(font, text);
+    if (std::optional<bool> result = find(key, &Entry::inFont)) {
+        return *result;
+    }
+
+    FontMetrics fm(font);
+    bool result = true;
+    for (size_t i = 0; i < text.size(); ++i) {
+        const Char& c = text.at(i);
+        if (c.isHighSurrogate()) {
+            if (i + 1 == text.size()) {
+                ASSERT_X("bad string");
+            }
+            const Char& c2 = text.at(i + 1);
+            ++i;
+            char32_t v = Char::surrogateToUcs4(c, c2);
+            if (!fm.inFontUcs4(v)) {
+                result = false;
+                break;
+            }
+        } else {
+            if (!fm.inFont(c)) {
+                result = false;
+                break;
+            }
+        }
+    }
+
+    insert(key, &Entry::inFont, result);
+    return result;
+}
+
+size_t TextShapingCache::capacity() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+void TextShapingCache::setCapacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = capacity;
+    evictIfNeeded();
+}
+
+TextShapingCache::Stats TextShapingCache::stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Stats stats = m_stats;
+    stats.size = m_items.size();
+    return stats;
+}
+
+void TextShapingCache::resetStats()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats = Stats();
+}
+
+void TextShapingCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_items.clear();
+    m_lru.clear();
+}
+
+template<typename T>
+std::optional<T> TextShapingCache::find(const Key& key, std::optional<T> Entry::* field)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_items.find(key);
+    if (it == m_items.end() || !(it->second.entry.*field)) {
+        ++m_stats.misses;
+        return std::nullopt;
+    }
+
+    ++m_stats.hits;
+    m_lru.splice(m_lru.begin(), m_lru, it->second.lruIt);
+    return it->second.entry.*field;
+}
+
+template<typename T>
+void TextShapingCache::insert(const Key& key, std::optional<T> Entry::* field, const T& value)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_items.find(key);
+    if (it == m_items.end()) {
+        m_lru.push_front(key);
+        it = m_items.emplace(key, Item { Entry(), m_lru.begin() }).first;
+    } else {
+        m_lru.splice(m_lru.begin(), m_lru, it->second.lruIt);
+    }
+
+    it->second.entry.*field = value;
+
+    evictIfNeeded();
+}
+
+void TextShapingCache::evictIfNeeded()
+{
+    while (m_items.size() > m_capacity && !m_lru.empty()) {
+        m_items.erase(m_lru.back());
+        m_lru.pop_back();
+        ++m_stats.evictions;
+    }
+}
@@ -0,0 +1,137 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_TEXTSHAPINGCACHE_H
+#define MU_ENGRAVING_TEXTSHAPINGCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include "draw/types/font.h"
+#include "draw/types/geometry.h"
+
+#include "global/types/string.h"
+
+namespace mu::engraving {
+//---------------------------------------------------------
+//   TextShapingCache
+//    the measurements of text runs, shared by all scores;
+//    keyed by the resolved font (family, size, style flags)
+//    and the text, bounded (least recently used entries are
+//    dropped) and thread safe
+//---------------------------------------------------------
+
+class TextShapingCache
+{
+public:
+    struct TextShape {
+        double width = 0.0;
+        muse::RectF tightBoundingRect;
+    };
+
+    struct FontShape {
+        double ascent = 0.0;
+        double descent = 0.0;
+        double xHeight = 0.0;
+        double lineSpacing = 0.0;
+    };
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        size_t size = 0;
+
+        double hitRate() const { return hits + misses > 0 ? double(hits) / double(hits + misses) : 0.0; }
+    };
+
+    static constexpr size_t DEFAULT_CAPACITY = 16384;
+
+    static TextShapingCache* instance();
+
+    explicit TextShapingCache(size_t capacity = DEFAULT_CAPACITY);
+
+    TextShape textShape(const muse::draw::Font& font, const muse::String& text);
+    FontShape fontShape(const muse::draw::Font& font);
+
+    // Whether all characters of the text are present in the font itself
+    bool inFont(const muse::draw::Font& font, const muse::String& text);
+
+    size_t capacity() const;
+    void setCapacity(size_t capacity);
+
+    Stats stats() const;
+    void resetStats();
+    void clear();
+
+private:
+    struct Key {
+        muse::draw::Font font;
+        muse::String text;
+        bool fontMergingDisabled = false; // see Font::g_disableFontMerging
+
+        bool operator==(const Key& other) const
+        {
+            return font == other.font && text == other.text && fontMergingDisabled == other.fontMergingDisabled;
+        }
+    };
+
+    static Key makeKey(const muse::draw::Font& font, const muse::String& text);
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry {
+        std::optional<TextShape> textShape;
+        std::optional<FontShape> fontShape;
+        std::optional<bool> inFont;
+    };
+
+    using LruList = std::list<Key>;
+
+    struct Item {
+        Entry entry;
+        LruList::iterator lruIt;
+    };
+
+    template<typename T>
+    std::optional<T> find(const Key& key, std::optional<T> Entry::* field);
+
+    template<typename T>
+    void insert(const Key& key, std::optional<T> Entry::* field, const T& value);
+
+    void evictIfNeeded();
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<Key, Item, KeyHash> m_items;
+    LruList m_lru; // most recently used first
+    size_t m_capacity = DEFAULT_CAPACITY;
+    Stats m_stats;
+};
+}
+
+#endif // MU_ENGRAVING_TEXTSHAPINGCACHE_H
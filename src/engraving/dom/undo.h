@@ -227,6 +227,7 @@ public:
     bool canRedo() const { return curIdx < list.size(); }
     bool isClean() const { return cleanState == stateList[curIdx]; }
     size_t getCurIdx() const { return curIdx; }
+    int state() const { return stateList[curIdx]; }   // each new command gets a new state
     UndoMacro* current() const { return curCmd; }
     UndoMacro* last() const { return curIdx > 0 ? list[curIdx - 1] : 0; }
     UndoMacro* prev() const { return curIdx > 1 ? list[curIdx - 2] : 0; }
@@ -45,6 +45,7 @@
 #include "engraving/dom/masterscore.h"
 #include "engraving/dom/drumset.h"
 #include "engraving/dom/figuredbass.h"
+#include "engraving/dom/textshapingcache.h"
 
 #include "rendering/dev/scorerenderer.h"
 #include "rendering/stable/scorerenderer.h"
@@ -348,4 +349,8 @@ void EngravingModule::onDestroy()
 {
     delete gpaletteScore;
     gpaletteScore = nullptr;
+
+    const TextShapingCache::Stats shapingStats = TextShapingCache::instance()->stats();
+    LOGI() << "text shaping cache: hits: " << shapingStats.hits << ", misses: " << shapingStats.misses
+           << ", hit rate: " << shapingStats.hitRate() << ", evictions: " << shapingStats.evictions;
 }
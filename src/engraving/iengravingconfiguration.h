@@ -89,6 +89,7 @@ public:
         bool showSkylines = false;
         bool showSystemBoundingRects = false;
         bool showCorruptedMeasures = true;
+        bool recordLayoutProfile = false; // not painted, see rendering/dev/layoutprofiler.h
 
         bool anyEnabled() const
         {
@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "shapearena.h"
+
+#include "shape.h"
+
+#include "dom/engravingitem.h"
+
+using namespace mu::engraving;
+
+void ShapeArena::build(const std::vector<Shape>& shapes)
+{
+    clear();
+
+    size_t size = 0;
+    for (const Shape& shape : shapes) {
+        size += shape.size();
+    }
+
+    m_left.reserve(size);
+    m_right.reserve(size);
+    m_top.reserve(size);
+    m_bottom.reserve(size);
+    m_zeroWidth.reserve(size);
+    m_items.reserve(size);
+    m_staffOffsets.reserve(shapes.size() + 1);
+    m_staffSpatium.reserve(shapes.size());
+
+    m_staffOffsets.push_back(0);
+    for (const Shape& shape : shapes) {
+        double spatium = 0.0;
+        for (const ShapeElement& el : shape.elements()) {
+            if (el.item()) {
+                spatium = el.item()->spatium();
+                break;
+            }
+        }
+        m_staffSpatium.push_back(spatium);
+
+        for (const ShapeElement& el : shape.elements()) {
+            if (el.isNull()) {
+                continue;
+            }
+            m_left.push_back(el.left());
+            m_right.push_back(el.right());
+            m_top.push_back(el.top());
+            m_bottom.push_back(el.bottom());
+            m_zeroWidth.push_back(el.width() == 0 ? 1 : 0);
+            m_items.push_back(el.item());
+        }
+        m_staffOffsets.push_back(m_items.size());
+    }
+}
+
+void ShapeArena::clear()
+{
+    m_left.clear();
+    m_right.clear();
+    m_top.clear();
+    m_bottom.clear();
+    m_zeroWidth.clear();
+    m_items.clear();
+    m_staffOffsets.clear();
+    m_staffSpatium.clear();
+}
+
+void ShapeArena::release()
+{
+    std::vector<double>().swap(m_left);
+    std::vector<double>().swap(m_right);
+    std::vector<double>().swap(m_top);
+    std::vector<double>().swap(m_bottom);
+    std::vector<uint8_t>().swap(m_zeroWidth);
+    std::vector<const EngravingItem*>().swap(m_items);
+    std::vector<size_t>().swap(m_staffOffsets);
+    std::vector<double>().swap(m_staffSpatium);
+}
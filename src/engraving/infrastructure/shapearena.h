@@ -0,0 +1,81 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_SHAPEARENA_H
+#define MU_ENGRAVING_SHAPEARENA_H
+
+#include <cstdint>
+#include <vector>
+
+#include "engraving/types/types.h"
+
+namespace mu::engraving {
+class EngravingItem;
+class Shape;
+
+//---------------------------------------------------------
+//   ShapeArena
+//    a read-only copy of the staff shapes of a segment for horizontal spacing:
+//    the geometry of all staves one after another in contiguous arrays,
+//    the items in a parallel array. Null elements are left out,
+//    the distance functions skip them anyway.
+//    Only kept during a layout, see Segment::releaseShapeArena()
+//---------------------------------------------------------
+
+class ShapeArena
+{
+public:
+    void build(const std::vector<Shape>& shapes);
+    void clear();
+    // clears and gives the memory back
+    void release();
+
+    size_t staves() const { return m_staffSpatium.size(); }
+
+    // the elements of a staff are [staffBegin, staffEnd)
+    size_t staffBegin(staff_idx_t staffIdx) const { return m_staffOffsets[staffIdx]; }
+    size_t staffEnd(staff_idx_t staffIdx) const { return m_staffOffsets[staffIdx + 1]; }
+
+    // spatium of the first item of the staff shape, as HorizontalSpacing::shapeSpatium()
+    double staffSpatium(staff_idx_t staffIdx) const { return m_staffSpatium[staffIdx]; }
+
+    const double* left() const { return m_left.data(); }
+    const double* right() const { return m_right.data(); }
+    const double* top() const { return m_top.data(); }
+    const double* bottom() const { return m_bottom.data(); }
+    const uint8_t* zeroWidth() const { return m_zeroWidth.data(); }
+    const EngravingItem* const* items() const { return m_items.data(); }
+
+private:
+    std::vector<double> m_left;
+    std::vector<double> m_right;
+    std::vector<double> m_top;
+    std::vector<double> m_bottom;
+    std::vector<uint8_t> m_zeroWidth;
+    std::vector<const EngravingItem*> m_items;
+
+    std::vector<size_t> m_staffOffsets;     // size = staves + 1
+    std::vector<double> m_staffSpatium;     // size = staves
+};
+}
+
+#endif // MU_ENGRAVING_SHAPEARENA_H
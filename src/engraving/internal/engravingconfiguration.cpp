@@ -30,7 +30,9 @@
 
 #include "global/settings.h"
 #include "draw/types/color.h"
+#include "dom/displaylist.h"
 #include "dom/mscore.h"
+#include "rendering/dev/layoutprofiler.h"
 #include "translation.h"
 
 #include "log.h"
@@ -101,6 +103,21 @@ void EngravingConfiguration::init()
     VOICE_COLORS[ALL_VOICES_IDX] = VoiceColor { std::move(key), currentColor };
 
     settings()->setDefaultValue(DYNAMICS_APPLY_TO_ALL_VOICES, Val(true));
+
+    //! NOTE The recorded display lists contain the colors of the items
+    m_scoreInversionChanged.onNotify(this, []() {
+        PageDisplayList::invalidateAll();
+    });
+
+    m_voiceColorChanged.onReceive(this, [](voice_idx_t, Color) {
+        PageDisplayList::invalidateAll();
+    });
+
+    if (uiConfiguration()) {
+        uiConfiguration()->currentThemeChanged().onNotify(this, []() {
+            PageDisplayList::invalidateAll();
+        });
+    }
 }
 
 muse::io::path_t EngravingConfiguration::appDataPath() const
@@ -304,6 +321,7 @@ const IEngravingConfiguration::DebuggingOptions& EngravingConfiguration::debuggi
 
 void EngravingConfiguration::setDebuggingOptions(const DebuggingOptions& options)
 {
+    rendering::dev::LayoutProfiler::instance()->setEnabled(options.recordLayoutProfile);
     m_debuggingOptions.set(options);
 }
 
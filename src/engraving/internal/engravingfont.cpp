@@ -766,10 +766,11 @@ void EngravingFont::draw(SymId id, Painter* painter, const SizeF& mag, const Poi
     }
 
     painter->save();
-    double size = 20.0 * MScore::pixelRatio;
-    m_font.setPointSizeF(size);
+    //! NOTE A copy, so that symbols can be drawn from several threads
+    Font font = m_font;
+    font.setPointSizeF(20.0 * MScore::pixelRatio);
     painter->scale(mag.width(), mag.height());
-    painter->setFont(m_font);
+    painter->setFont(font);
     if (angle != 0) {
         const double _width = sym.bbox.width() / 2;
         const double _height = sym.bbox.height() / 2;
@@ -134,7 +134,7 @@ private:
 
     bool m_loaded = false;
     std::vector<Sym> m_symbols;
-    mutable muse::draw::Font m_font;
+    muse::draw::Font m_font;
 
     std::string m_name;
     std::string m_family;
@@ -1452,6 +1452,46 @@ void ChordLayout::layoutChords1(LayoutContext& ctx, Segment* segment, staff_idx_
     TRACEFUNC;
     LAYOUT_CALL() << LAYOUT_ITEM_INFO(segment);
 
+    if (!layoutChordsNotes(ctx, segment, staffIdx)) {
+        return;
+    }
+
+    layoutLedgerLines(staffChords(segment, staffIdx));
+    layoutChordsAccidentals(ctx, segment, staffIdx);
+}
+
+//---------------------------------------------------------
+//   staffChords
+//    the chords of the part laid out on the given staff
+//---------------------------------------------------------
+
+std::vector<Chord*> ChordLayout::staffChords(const Segment* segment, staff_idx_t staffIdx)
+{
+    std::vector<Chord*> chords;
+
+    const Part* part = segment->score()->staff(staffIdx)->part();
+    const track_idx_t partStartTrack = part ? part->startTrack() : staffIdx * VOICES;
+    const track_idx_t partEndTrack = part ? part->endTrack() : staffIdx * VOICES + VOICES;
+
+    for (track_idx_t track = partStartTrack; track < partEndTrack; ++track) {
+        EngravingItem* e = segment->element(track);
+        if (e && e->isChord() && toChord(e)->vStaffIdx() == staffIdx) {
+            chords.push_back(toChord(e));
+        }
+    }
+
+    return chords;
+}
+
+//---------------------------------------------------------
+//   layoutChordsNotes
+//    first step of layoutChords1: noteheads, offsets and dots
+//    returns false if the segment is already complete (tablature)
+//---------------------------------------------------------
+
+bool ChordLayout::layoutChordsNotes(LayoutContext& ctx, Segment* segment, staff_idx_t staffIdx)
+{
+
     const Staff* staff = ctx.dom().staff(staffIdx);
     const bool isTab = staff->isTabStaff(segment->tick());
     const track_idx_t startTrack = staffIdx * VOICES;
@@ -1470,7 +1510,7 @@ void ChordLayout::layoutChords1(LayoutContext& ctx, Segment* segment, staff_idx_
 
     if (staff && staff->isTabStaff(tick) && (!staff->staffType() || !staff->staffType()->stemThrough())) {
         layoutSegmentElements(segment, startTrack, endTrack, staffIdx, ctx);
-        return;
+        return false;
     }
 
     std::vector<Chord*> chords;
@@ -1997,7 +2037,23 @@ void ChordLayout::layoutChords1(LayoutContext& ctx, Segment* segment, staff_idx_
         layoutChords3(chords, notes, staff, ctx);
     }
 
-    layoutLedgerLines(chords);
+    return true;
+}
+
+//---------------------------------------------------------
+//   layoutChordsAccidentals
+//    last step of layoutChords1, after the ledger lines:
+//    accidentals and the elements of the segment
+//---------------------------------------------------------
+
+void ChordLayout::layoutChordsAccidentals(LayoutContext& ctx, Segment* segment, staff_idx_t staffIdx)
+{
+    const Part* part = ctx.dom().staff(staffIdx)->part();
+    const track_idx_t partStartTrack = part ? part->startTrack() : staffIdx * VOICES;
+    const track_idx_t partEndTrack = part ? part->endTrack() : staffIdx * VOICES + VOICES;
+
+    const std::vector<Chord*> chords = staffChords(segment, staffIdx);
+
     AccidentalsLayout::layoutAccidentals(chords, ctx);
     for (Chord* chord : chords) {
         for (Chord* grace : chord->graceNotes()) {
@@ -63,6 +63,10 @@ public:
     static bool isChordPosBelowBeam(Chord* item, Beam* beam);
 
     static void layoutChords1(LayoutContext& ctx, Segment* segment, staff_idx_t staffIdx);
+    // the steps of layoutChords1, the ledger lines in between are created on the calling thread
+    static bool layoutChordsNotes(LayoutContext& ctx, Segment* segment, staff_idx_t staffIdx);
+    static void layoutChordsAccidentals(LayoutContext& ctx, Segment* segment, staff_idx_t staffIdx);
+    static std::vector<Chord*> staffChords(const Segment* segment, staff_idx_t staffIdx);
     static double layoutChords2(std::vector<Note*>& notes, bool up, LayoutContext& ctx);
     static void layoutChords3(const std::vector<Chord*>&, const std::vector<Note*>&, const Staff*, LayoutContext& ctx);
     static void layoutLedgerLines(const std::vector<Chord*>& chords);
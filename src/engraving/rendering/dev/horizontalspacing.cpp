@@ -64,25 +64,85 @@ double HorizontalSpacing::minHorizontalDistance(const Shape& f, const Shape& s,
             double ay2 = r1.bottom();
             double verticalClearance = computeVerticalClearance(item1, item2, spatium) * squeezeFactor;
             bool intersection = mu::engraving::intersects(ay1, ay2, by1, by2, verticalClearance);
+            if (!isSpacingPair(item1, item2, intersection, r1.width() == 0 || r2.width() == 0)) {
+                continue;
+            }
             double padding = 0;
-            KerningType kerningType = KerningType::NON_KERNING;
             if (item1 && item2) {
                 padding = computePadding(item1, item2);
                 padding *= squeezeFactor;
                 padding = std::max(padding, absoluteMinPadding);
-                kerningType = computeKerning(item1, item2);
             }
-            if ((intersection && kerningType != KerningType::ALLOW_COLLISION)
-                || (r1.width() == 0 || r2.width() == 0)  // Temporary hack: shapes of zero-width are assumed to collide with everyghin
-                || (!item1 && item2 && item2->isLyrics())  // Temporary hack: avoids collision with melisma line
-                || kerningType == KerningType::NON_KERNING) {
-                dist = std::max(dist, r1.right() - r2.left() + padding);
+            dist = std::max(dist, r1.right() - r2.left() + padding);
+        }
+    }
+    return dist;
+}
+
+//-------------------------------------------------------------------
+//   minHorizontalDistance
+//    same as above for the staff shapes of two segments,
+//    read from their contiguous copies
+//-------------------------------------------------------------------
+
+double HorizontalSpacing::minHorizontalDistance(const ShapeArena& f, const ShapeArena& s, size_t staffIdx, double spatium,
+                                                double squeezeFactor)
+{
+    double dist = -DBL_MAX;        // min real
+    double absoluteMinPadding = 0.1 * spatium * squeezeFactor;
+
+    const size_t fBegin = f.staffBegin(staffIdx);
+    const size_t fEnd = f.staffEnd(staffIdx);
+    const double* fRight = f.right();
+    const double* fTop = f.top();
+    const double* fBottom = f.bottom();
+    const uint8_t* fZeroWidth = f.zeroWidth();
+    const EngravingItem* const* fItems = f.items();
+
+    const size_t sEnd = s.staffEnd(staffIdx);
+    for (size_t j = s.staffBegin(staffIdx); j < sEnd; ++j) {
+        const EngravingItem* item2 = s.items()[j];
+        const double bx1 = s.left()[j];
+        const double by1 = s.top()[j];
+        const double by2 = s.bottom()[j];
+        const bool zeroWidth2 = s.zeroWidth()[j];
+        for (size_t i = fBegin; i < fEnd; ++i) {
+            const EngravingItem* item1 = fItems[i];
+            double verticalClearance = computeVerticalClearance(item1, item2, spatium) * squeezeFactor;
+            bool intersection = mu::engraving::intersects(fTop[i], fBottom[i], by1, by2, verticalClearance);
+            if (!isSpacingPair(item1, item2, intersection, fZeroWidth[i] || zeroWidth2)) {
+                continue;
+            }
+            double padding = 0;
+            if (item1 && item2) {
+                padding = computePadding(item1, item2);
+                padding *= squeezeFactor;
+                padding = std::max(padding, absoluteMinPadding);
             }
+            dist = std::max(dist, fRight[i] - bx1 + padding);
         }
     }
     return dist;
 }
 
+//-------------------------------------------------------------------
+//   isSpacingPair
+//    whether two shape elements constrain the distance between their shapes,
+//    the padding is only needed for these
+//-------------------------------------------------------------------
+
+bool HorizontalSpacing::isSpacingPair(const EngravingItem* item1, const EngravingItem* item2, bool intersection, bool zeroWidth)
+{
+    KerningType kerningType = KerningType::NON_KERNING;
+    if (item1 && item2) {
+        kerningType = computeKerning(item1, item2);
+    }
+    return (intersection && kerningType != KerningType::ALLOW_COLLISION)
+           || zeroWidth  // Temporary hack: shapes of zero-width are assumed to collide with everyghin
+           || (!item1 && item2 && item2->isLyrics())  // Temporary hack: avoids collision with melisma line
+           || kerningType == KerningType::NON_KERNING;
+}
+
 // Logic moved from Shape
 double HorizontalSpacing::shapeSpatium(const Shape& s)
 {
@@ -109,14 +169,14 @@ double HorizontalSpacing::minHorizontalDistance(const Segment* f, const Segment*
     double ww = -DBL_MAX;          // can remain negative
     double d = 0.0;
     Score* score = f->score();
-    for (unsigned staffIdx = 0; staffIdx < f->shapes().size(); ++staffIdx) {
+    const ShapeArena& fshapes = f->shapeArena();
+    for (unsigned staffIdx = 0; staffIdx < fshapes.staves(); ++staffIdx) {
         if (score->staff(staffIdx) && !score->staff(staffIdx)->show()) {
             continue;
         }
 
-        const Shape& fshape = f->staffShape(staffIdx);
-        double sp = shapeSpatium(fshape);
-        d = ns ? minHorizontalDistance(fshape, ns->staffShape(staffIdx), sp, squeezeFactor) : 0.0;
+        double sp = fshapes.staffSpatium(staffIdx);
+        d = ns ? minHorizontalDistance(fshapes, ns->shapeArena(), staffIdx, sp, squeezeFactor) : 0.0;
         // first chordrest of a staff should clear the widest header for any staff
         // so make sure segment is as wide as it needs to be
         if (systemHeaderGap) {
@@ -211,14 +271,15 @@ double HorizontalSpacing::minHorizontalCollidingDistance(const Segment* f, const
 
     double w = -DBL_MAX; // This can remain negative in some cases (for instance, mid-system clefs)
     Score* score = f->score();
-    for (unsigned staffIdx = 0; staffIdx < f->shapes().size(); ++staffIdx) {
+    const ShapeArena& fshapes = f->shapeArena();
+    const ShapeArena& nsshapes = ns->shapeArena();
+    for (unsigned staffIdx = 0; staffIdx < fshapes.staves(); ++staffIdx) {
         if (score->staff(staffIdx) && !score->staff(staffIdx)->show()) {
             continue;
         }
 
-        const Shape& fshape = f->staffShape(staffIdx);
-        double sp = shapeSpatium(fshape);
-        double d = minHorizontalDistance(fshape, ns->staffShape(staffIdx), sp, squeezeFactor);
+        double sp = fshapes.staffSpatium(staffIdx);
+        double d = minHorizontalDistance(fshapes, nsshapes, staffIdx, sp, squeezeFactor);
         w = std::max(w, d);
     }
     return w;
@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_HORIZONTALSPACINGUTILS_DEV_H
 #define MU_ENGRAVING_HORIZONTALSPACINGUTILS_DEV_H
 
+#include <cstddef>
+
 namespace mu::engraving {
 class Chord;
 class EngravingItem;
@@ -29,6 +31,7 @@ class Lyrics;
 class Note;
 class Rest;
 class Shape;
+class ShapeArena;
 class StemSlash;
 class Segment;
 class Measure;
@@ -57,6 +60,9 @@ public:
     static double computeVerticalClearance(const EngravingItem* item1, const EngravingItem* item2, double spatium);
 
 private:
+    static double minHorizontalDistance(const ShapeArena& f, const ShapeArena& s, size_t staffIdx, double spatium, double squeezeFactor);
+    static bool isSpacingPair(const EngravingItem* item1, const EngravingItem* item2, bool intersection, bool zeroWidth);
+
     static bool isSpecialNotePaddingType(ElementType type);
     static void computeNotePadding(const Note* note, const EngravingItem* item2, double& padding, double scaling);
     static void computeLedgerRestPadding(const Rest* rest2, double& padding);
@@ -33,6 +33,7 @@
 #include "../../dom/mscore.h"
 
 #include "../layoutoptions.h"
+#include "measurewidthcache.h"
 
 #ifdef MUE_ENABLE_ENGRAVING_RENDER_DEBUG
 #include "log.h"
@@ -103,6 +104,12 @@ public:
 
     bool isShowVBox() const { return options().isShowVBox; }
     double noteHeadWidth() const { return options().noteHeadWidth; }
+    size_t maxPages() const { return options().maxPages; }
+    bool hasViewport() const { return options().hasViewport(); }
+    bool isParallelLayout() const { return options().isParallelLayout; }
+    bool isMeasureWidthCacheEnabled() const { return options().isMeasureWidthCacheEnabled; }
+    double viewportLayoutLeft() const { return options().viewportLayoutLeft(); }
+    double viewportLayoutRight() const { return options().viewportLayoutRight(); }
     bool isShowInvisible() const;
     int pageNumberOffset() const;
     bool isVerticalSpreadEnabled() const;
@@ -256,6 +263,7 @@ public:
 
     std::vector<System*>& systemList() { return m_systemList; }
     void setSystemList(const std::vector<System*>& l) { m_systemList = l; }
+    std::vector<System*>& absorbedSystems() { return m_absorbedSystems; }
     System* prevSystem() { return m_prevSystem; }
     void setPrevSystem(System* s) { m_prevSystem = s; }
     System* curSystem() { return m_curSystem; }
@@ -279,6 +287,12 @@ public:
 
     void setSegmentShapeSqueezeFactor(double val) { m_segmentShapeSqueezeFactor = val; }
 
+    MeasureWidthCache& measureWidthCache() { return m_measureWidthCache; }
+
+    // null if the measure spacing is not shared with the other scores of the master score
+    SharedMeasureSpacing* sharedMeasureSpacing() const { return m_sharedMeasureSpacing; }
+    void setSharedMeasureSpacing(SharedMeasureSpacing* shared) { m_sharedMeasureSpacing = shared; }
+
 private:
 
     bool m_firstSystem = true;
@@ -294,6 +308,7 @@ private:
     page_idx_t m_pageIdx = 0;               // index in Score->page()s
 
     std::vector<System*> m_systemList;      // reusable systems
+    std::vector<System*> m_absorbedSystems; // old systems whose measures went to other systems, deleted after layout
     System* m_prevSystem = nullptr;         // used during page layout
     System* m_curSystem = nullptr;
 
@@ -312,6 +327,8 @@ private:
 
     // cache
     double m_totalBracketsWidth = -1.0;
+    MeasureWidthCache m_measureWidthCache;
+    SharedMeasureSpacing* m_sharedMeasureSpacing = nullptr;
 };
 
 class LayoutDebug
@@ -0,0 +1,208 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "layoutprofiler.h"
+
+#include <iomanip>
+#include <sstream>
+
+#include "io/file.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace mu::engraving::rendering::dev;
+
+//! NOTE Keeps the memory bounded for long sessions, the statistics are still collected after the limit
+static constexpr size_t MAX_EVENTS = 2000000;
+
+LayoutProfiler* LayoutProfiler::instance()
+{
+    static LayoutProfiler p;
+    return &p;
+}
+
+void LayoutProfiler::setEnabled(bool enabled)
+{
+    if (enabled == isEnabled()) {
+        return;
+    }
+
+    if (enabled) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_events.empty()) {
+            m_origin = Clock::now();
+        }
+    }
+
+    m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void LayoutProfiler::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_origin = Clock::now();
+    m_events.clear();
+    m_stats.clear();
+    m_threads.clear();
+}
+
+size_t LayoutProfiler::threadIndex(std::thread::id id)
+{
+    for (size_t i = 0; i < m_threads.size(); ++i) {
+        if (m_threads.at(i) == id) {
+            return i;
+        }
+    }
+
+    m_threads.push_back(id);
+    return m_threads.size() - 1;
+}
+
+void LayoutProfiler::addEvent(std::string_view category, std::string_view name, std::string_view argName, int64_t arg,
+                              Clock::time_point begin, Clock::time_point end)
+{
+    using namespace std::chrono;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const int64_t durationUs = duration_cast<microseconds>(end - begin).count();
+
+    Stat& stat = m_stats[{ category, name }];
+    stat.count++;
+    stat.totalUs += durationUs;
+
+    if (m_events.size() >= MAX_EVENTS) {
+        return;
+    }
+
+    Event e;
+    e.category = category;
+    e.name = name;
+    e.argName = argName;
+    e.arg = arg;
+    e.beginUs = duration_cast<microseconds>(begin - m_origin).count();
+    e.durationUs = durationUs;
+    e.threadIdx = threadIndex(std::this_thread::get_id());
+    m_events.push_back(e);
+}
+
+std::map<std::string, LayoutProfiler::Stat> LayoutProfiler::stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::map<std::string, Stat> result;
+    for (const auto& [key, stat] : m_stats) {
+        std::string name;
+        name.append(key.first).append("/").append(key.second);
+        result[name] = stat;
+    }
+
+    return result;
+}
+
+std::string LayoutProfiler::statsDump() const
+{
+    std::stringstream ss;
+    ss << std::left << std::setw(40) << "name" << std::setw(12) << "calls" << "total ms\n";
+    for (const auto& [name, stat] : stats()) {
+        ss << std::setw(40) << name << std::setw(12) << stat.count << (stat.totalUs / 1000.0) << "\n";
+    }
+
+    return ss.str();
+}
+
+//---------------------------------------------------------
+//   toChromeTrace
+//    complete events ("ph":"X") in the Trace Event Format,
+//    the statistics are added as metadata
+//---------------------------------------------------------
+
+ByteArray LayoutProfiler::toChromeTrace() const
+{
+    auto writeName = [](std::stringstream& ss, std::string_view name) {
+        ss << '"';
+        for (char c : name) {
+            if (c == '"' || c == '\\') {
+                ss << '\\';
+            }
+            ss << c;
+        }
+        ss << '"';
+    };
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::stringstream ss;
+    ss << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+    for (const Event& e : m_events) {
+        if (!first) {
+            ss << ",";
+        }
+        first = false;
+
+        ss << "\n{\"name\":";
+        writeName(ss, e.name);
+        ss << ",\"cat\":";
+        writeName(ss, e.category);
+        ss << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.threadIdx
+           << ",\"ts\":" << e.beginUs << ",\"dur\":" << e.durationUs;
+        if (e.arg >= 0) {
+            ss << ",\"args\":{";
+            writeName(ss, e.argName);
+            ss << ":" << e.arg << "}";
+        }
+        ss << "}";
+    }
+
+    ss << "\n],\"metadata\":{\"layoutStats\":{";
+
+    first = true;
+    for (const auto& [key, stat] : m_stats) {
+        if (!first) {
+            ss << ",";
+        }
+        first = false;
+
+        std::string name;
+        name.append(key.first).append("/").append(key.second);
+        ss << "\n";
+        writeName(ss, name);
+        ss << ":{\"count\":" << stat.count << ",\"totalUs\":" << stat.totalUs << "}";
+    }
+
+    ss << "\n}}}\n";
+
+    std::string str = ss.str();
+    return ByteArray(str.c_str(), str.size());
+}
+
+Ret LayoutProfiler::writeChromeTrace(const io::path_t& filePath) const
+{
+    Ret ret = io::File::writeFile(filePath, toChromeTrace());
+    if (!ret) {
+        LOGE() << "failed write layout profile: " << filePath << ", err: " << ret.toString();
+    }
+
+    return ret;
+}
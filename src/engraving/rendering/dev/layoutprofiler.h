@@ -0,0 +1,149 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_LAYOUTPROFILER_DEV_H
+#define MU_ENGRAVING_LAYOUTPROFILER_DEV_H
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "types/bytearray.h"
+#include "types/ret.h"
+#include "io/path.h"
+
+#define LAYOUT_PROFILE(category, name) \
+    mu::engraving::rendering::dev::LayoutProfiler::Scope _lpscope(category, name)
+#define LAYOUT_PROFILE_ARG(category, name, arg) \
+    mu::engraving::rendering::dev::LayoutProfiler::Scope _lpscope(category, name, arg)
+// the name is only evaluated when the profiler is enabled
+#define LAYOUT_PROFILE_LAZY(category, name) \
+    mu::engraving::rendering::dev::LayoutProfiler::Scope _lpscope(category, \
+                                                                   mu::engraving::rendering::dev::LayoutProfiler::instance()->isEnabled() \
+                                                                   ? std::string_view(name) : std::string_view())
+// the value known only at the end of the scope, like an iteration count
+#define LAYOUT_PROFILE_SET_ARG(argName, arg) \
+    _lpscope.setArg(argName, arg)
+
+namespace mu::engraving::rendering::dev {
+//---------------------------------------------------------
+//   LayoutProfiler
+//    records the wall time and call count of the layout passes,
+//    of TLayout::layoutItem per element type, of each system
+//    and of the slur collision avoidance (with its iteration count).
+//    Disabled by default and enabled at runtime (diagnostic menu, --diagnostic-layout-profile),
+//    the records can be saved in the Chrome trace format (chrome://tracing, ui.perfetto.dev)
+//---------------------------------------------------------
+
+class LayoutProfiler
+{
+public:
+
+    static LayoutProfiler* instance();
+
+    bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+    void setEnabled(bool enabled);
+
+    void clear();
+
+    struct Stat {
+        size_t count = 0;
+        int64_t totalUs = 0;
+    };
+
+    // key is "category/name"
+    std::map<std::string, Stat> stats() const;
+    std::string statsDump() const;
+
+    muse::ByteArray toChromeTrace() const;
+    muse::Ret writeChromeTrace(const muse::io::path_t& filePath) const;
+
+    //! NOTE category and name must be static strings, they are stored as views
+    class Scope
+    {
+    public:
+        Scope(std::string_view category, std::string_view name, int64_t arg = -1)
+        {
+            if (LayoutProfiler::instance()->isEnabled()) {
+                m_category = category;
+                m_name = name;
+                m_arg = arg;
+                m_begin = Clock::now();
+                m_active = true;
+            }
+        }
+
+        ~Scope()
+        {
+            if (m_active) {
+                LayoutProfiler::instance()->addEvent(m_category, m_name, m_argName, m_arg, m_begin, Clock::now());
+            }
+        }
+
+        void setArg(std::string_view argName, int64_t arg)
+        {
+            m_argName = argName;
+            m_arg = arg;
+        }
+
+    private:
+        std::string_view m_category;
+        std::string_view m_name;
+        std::string_view m_argName = "index";
+        int64_t m_arg = -1;
+        std::chrono::steady_clock::time_point m_begin;
+        bool m_active = false;
+    };
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Event {
+        std::string_view category;
+        std::string_view name;
+        std::string_view argName;
+        int64_t arg = -1;
+        int64_t beginUs = 0;
+        int64_t durationUs = 0;
+        size_t threadIdx = 0;
+    };
+
+    void addEvent(std::string_view category, std::string_view name, std::string_view argName, int64_t arg, Clock::time_point begin,
+                  Clock::time_point end);
+    size_t threadIndex(std::thread::id id);
+
+    std::atomic<bool> m_enabled = false;
+    Clock::time_point m_origin;
+
+    mutable std::mutex m_mutex;
+    std::vector<Event> m_events;
+    std::map<std::pair<std::string_view, std::string_view>, Stat> m_stats;
+    std::vector<std::thread::id> m_threads;
+};
+}
+
+#endif // MU_ENGRAVING_LAYOUTPROFILER_DEV_H
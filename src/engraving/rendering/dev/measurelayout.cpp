@@ -20,9 +20,15 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 #include <cfloat>
+#include <functional>
+#include <future>
+#include <set>
+#include <thread>
 
 #include "measurelayout.h"
 
+#include "global/concurrency/taskscheduler.h"
+
 #include "infrastructure/rtti.h"
 
 #include "dom/ambitus.h"
@@ -33,6 +39,7 @@
 #include "dom/layoutbreak.h"
 #include "dom/lyrics.h"
 #include "dom/marker.h"
+#include "dom/masterscore.h"
 #include "dom/measure.h"
 #include "dom/measurenumber.h"
 #include "dom/measurerepeat.h"
@@ -62,6 +69,7 @@
 #include "tremololayout.h"
 #include "segmentlayout.h"
 #include "modifydom.h"
+#include "layoutprofiler.h"
 
 #include "log.h"
 
@@ -826,6 +834,213 @@ void MeasureLayout::checkStaffMoveValidity(Measure* measure, const LayoutContext
     }
 }
 
+static void layoutSegmentLyrics(Segment& segment, staff_idx_t staffIdx, LayoutContext& ctx)
+{
+    for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
+        ChordRest* cr = segment.cr(staffIdx * VOICES + voice);
+        if (cr) {
+            for (Lyrics* l : cr->lyrics()) {
+                if (l) {
+                    TLayout::layoutLyrics(l, ctx);
+                }
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   layoutStaffChords
+//    chords and rests of one staff: note positions, dots,
+//    accidentals and vertical rest conflicts
+//---------------------------------------------------------
+
+void MeasureLayout::layoutStaffChords(Measure* measure, staff_idx_t staffIdx, bool withLyrics, LayoutContext& ctx)
+{
+    for (Segment& segment : measure->segments()) {
+        if (segment.isChordRestType()) {
+            ChordLayout::layoutChords1(ctx, &segment, staffIdx);
+            ChordLayout::resolveVerticalRestConflicts(ctx, &segment, staffIdx);
+            if (withLyrics) {
+                layoutSegmentLyrics(segment, staffIdx, ctx);
+            }
+        }
+    }
+}
+
+static bool chordNeedsSerialLayout(const Chord* chord)
+{
+    // the notes of a cross-staff chord are laid out together with the other staff,
+    // a hook of a beamed chord, a leftover tablature duration and the cue note of an ornament change the DOM
+    if (chord->staffMove() != 0 || (chord->hook() && chord->beam()) || chord->tabDur()) {
+        return true;
+    }
+
+    Ornament* ornament = chord->findOrnament();
+    if (ornament && ornament->showCueNote()) {
+        return true;
+    }
+
+    for (const Chord* grace : chord->graceNotes()) {
+        if (chordNeedsSerialLayout(grace)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//---------------------------------------------------------
+//   collectStavesForChordsLayout
+//    splits the visible staves into the ones whose chords can be laid out concurrently
+//    and the ones of the parts that have to be laid out on the calling thread
+//---------------------------------------------------------
+
+void MeasureLayout::collectStavesForChordsLayout(const Measure* measure, const LayoutContext& ctx,
+                                                 std::vector<staff_idx_t>& parallelStaves, std::vector<staff_idx_t>& serialStaves)
+{
+    std::set<const Part*> serialParts;
+
+    for (const Segment& segment : measure->segments()) {
+        if (!segment.isChordRestType()) {
+            continue;
+        }
+
+        for (const EngravingItem* e : segment.elist()) {
+            if (!e || !e->isChordRest()) {
+                continue;
+            }
+
+            const ChordRest* cr = toChordRest(e);
+            if (cr->staffMove() != 0 || (cr->isChord() && chordNeedsSerialLayout(toChord(cr)))) {
+                serialParts.insert(cr->part());
+            }
+        }
+    }
+
+    for (staff_idx_t staffIdx = 0; staffIdx < ctx.dom().nstaves(); ++staffIdx) {
+        const Staff* staff = ctx.dom().staff(staffIdx);
+        if (!staff->show()) {
+            continue;
+        }
+
+        //! NOTE The tablature layout adds and removes stems
+        if (staff->isTabStaff(measure->tick()) || serialParts.count(staff->part()) > 0) {
+            serialStaves.push_back(staffIdx);
+        } else {
+            parallelStaves.push_back(staffIdx);
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   layoutStavesConcurrently
+//    splits the staves across the task scheduler threads,
+//    the calling thread takes the first chunk
+//---------------------------------------------------------
+
+static void layoutStavesConcurrently(muse::TaskScheduler* scheduler, const std::vector<staff_idx_t>& staves,
+                                     const std::function<void(staff_idx_t)>& layoutStaff)
+{
+    const size_t tasks = std::min(staves.size(), static_cast<size_t>(scheduler->threadPoolSize()) + 1);
+    const size_t stavesPerTask = (staves.size() + tasks - 1) / tasks;
+
+    auto layoutStaves = [&staves, &layoutStaff](size_t begin, size_t end) {
+        LAYOUT_PROFILE("pass", "staff chords");
+        for (size_t i = begin; i < end; ++i) {
+            layoutStaff(staves.at(i));
+        }
+    };
+
+    std::vector<std::future<void> > futures;
+    futures.reserve(tasks - 1);
+    for (size_t begin = stavesPerTask; begin < staves.size(); begin += stavesPerTask) {
+        futures.push_back(scheduler->submit(layoutStaves, begin, std::min(begin + stavesPerTask, staves.size())));
+    }
+
+    layoutStaves(0, std::min(stavesPerTask, staves.size()));
+
+    for (std::future<void>& future : futures) {
+        future.wait();
+    }
+}
+
+//---------------------------------------------------------
+//   layoutStavesChords
+//    The chords of a staff only depend on the chords of the same part,
+//    so the staves of parts without cross-staff notation are laid out concurrently
+//    when LayoutOptions::isParallelLayout is set.
+//    Everything that allocates or changes the DOM stays on the calling thread:
+//    the ledger lines are created between the notes and the accidentals steps
+//    and the lyrics are laid out afterwards.
+//---------------------------------------------------------
+
+void MeasureLayout::layoutStavesChords(Measure* measure, LayoutContext& ctx)
+{
+#if !defined(MUE_ENABLE_ENGRAVING_RENDER_DEBUG) && !defined(MUE_ENABLE_ENGRAVING_LD_ACCESS)
+    static constexpr size_t MIN_PARALLEL_STAVES = 8;
+
+    std::vector<staff_idx_t> parallelStaves;
+    std::vector<staff_idx_t> serialStaves;
+
+    muse::TaskScheduler* scheduler = muse::TaskScheduler::instance();
+    if (ctx.conf().isParallelLayout() && scheduler->threadPoolSize() > 0
+        && !scheduler->containsThread(std::this_thread::get_id())) {
+        collectStavesForChordsLayout(measure, ctx, parallelStaves, serialStaves);
+    }
+
+    if (parallelStaves.size() >= MIN_PARALLEL_STAVES) {
+        //! NOTE Tablature staves are in serialStaves, so the notes step never completes a segment here
+        layoutStavesConcurrently(scheduler, parallelStaves, [measure, &ctx](staff_idx_t staffIdx) {
+            for (Segment& segment : measure->segments()) {
+                if (segment.isChordRestType()) {
+                    ChordLayout::layoutChordsNotes(ctx, &segment, staffIdx);
+                }
+            }
+        });
+
+        for (staff_idx_t staffIdx : parallelStaves) {
+            for (Segment& segment : measure->segments()) {
+                if (segment.isChordRestType()) {
+                    ChordLayout::layoutLedgerLines(ChordLayout::staffChords(&segment, staffIdx));
+                }
+            }
+        }
+
+        layoutStavesConcurrently(scheduler, parallelStaves, [measure, &ctx](staff_idx_t staffIdx) {
+            for (Segment& segment : measure->segments()) {
+                if (segment.isChordRestType()) {
+                    ChordLayout::layoutChordsAccidentals(ctx, &segment, staffIdx);
+                    ChordLayout::resolveVerticalRestConflicts(ctx, &segment, staffIdx);
+                }
+            }
+        });
+
+        for (staff_idx_t staffIdx : serialStaves) {
+            layoutStaffChords(measure, staffIdx, false, ctx);
+        }
+
+        for (staff_idx_t staffIdx = 0; staffIdx < ctx.dom().nstaves(); ++staffIdx) {
+            if (!ctx.dom().staff(staffIdx)->show()) {
+                continue;
+            }
+            for (Segment& segment : measure->segments()) {
+                if (segment.isChordRestType()) {
+                    layoutSegmentLyrics(segment, staffIdx, ctx);
+                }
+            }
+        }
+
+        return;
+    }
+#endif
+
+    for (staff_idx_t staffIdx = 0; staffIdx < ctx.dom().nstaves(); ++staffIdx) {
+        if (ctx.dom().staff(staffIdx)->show()) {
+            layoutStaffChords(measure, staffIdx, true, ctx);
+        }
+    }
+}
+
 void MeasureLayout::layoutMeasure(MeasureBase* currentMB, LayoutContext& ctx)
 {
     IF_ASSERT_FAILED(currentMB == ctx.state().curMeasure()) {
@@ -926,29 +1141,7 @@ void MeasureLayout::layoutMeasure(MeasureBase* currentMB, LayoutContext& ctx)
         BeamLayout::layoutNonCrossBeams(&s, ctx);
     }
 
-    for (staff_idx_t staffIdx = 0; staffIdx < ctx.dom().nstaves(); ++staffIdx) {
-        const Staff* staff = ctx.dom().staff(staffIdx);
-        if (!staff->show()) {
-            continue;
-        }
-
-        for (Segment& segment : measure->segments()) {
-            if (segment.isChordRestType()) {
-                ChordLayout::layoutChords1(ctx, &segment, staffIdx);
-                ChordLayout::resolveVerticalRestConflicts(ctx, &segment, staffIdx);
-                for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
-                    ChordRest* cr = segment.cr(staffIdx * VOICES + voice);
-                    if (cr) {
-                        for (Lyrics* l : cr->lyrics()) {
-                            if (l) {
-                                TLayout::layoutLyrics(l, ctx);
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    }
+    layoutStavesChords(measure, ctx);
 
     for (Segment& segment : measure->segments()) {
         if (segment.isBreathType()) {
@@ -1002,6 +1195,7 @@ void MeasureLayout::getNextMeasure(LayoutContext& ctx)
 {
     TRACEFUNC;
     LAYOUT_CALL();
+    LAYOUT_PROFILE("pass", "measure");
 
     moveToNextMeasure(ctx);
 
@@ -2140,6 +2334,11 @@ void MeasureLayout::stretchMeasureInPracticeMode(Measure* m, double targetWidth,
 void MeasureLayout::computeWidth(Measure* m, LayoutContext& ctx, Fraction minTicks, Fraction maxTicks, double stretchCoeff,
                                  bool overrideMinMeasureWidth)
 {
+    // the width might have been only estimated by the continuous view, but page view lays out all measures
+    if (!ctx.conf().isLinearMode()) {
+        m->setWidthEstimated(false);
+    }
+
     Segment* s = nullptr;
 
     // skip disabled segment
@@ -2214,6 +2413,43 @@ void MeasureLayout::computeWidth(Measure* m, LayoutContext& ctx, Segment* s, dou
                                  Fraction maxTicks,
                                  double stretchCoeff,
                                  bool overrideMinMeasureWidth)
+{
+    // respacing from the middle of the measure continues from its current state, so it can't be reused;
+    // with the cache disabled, every measure is spaced again
+    if (!s->rtick().isZero() || !ctx.conf().isMeasureWidthCacheEnabled()) {
+        doComputeWidth(m, ctx, s, x, isSystemHeader, minTicks, maxTicks, stretchCoeff, overrideMinMeasureWidth);
+        return;
+    }
+
+    MeasureWidthCache& cache = ctx.mutState().measureWidthCache();
+    MeasureWidthCache::Key key = MeasureWidthCache::makeKey(m, s, x, isSystemHeader, minTicks, maxTicks, stretchCoeff,
+                                                            ctx.state().segmentShapeSqueezeFactor(), overrideMinMeasureWidth);
+    if (cache.restore(m, key)) {
+        return;
+    }
+
+    //! NOTE A score with parts may lay out the same measures several times,
+    //! e.g. two copies of a part, or a part and a single instrument score
+    SharedMeasureSpacing* shared = ctx.state().sharedMeasureSpacing();
+    SharedMeasureSpacing::Key sharedKey;
+    if (shared) {
+        sharedKey = cache.makeSharedKey(m, key, ctx.conf().style(), ctx.conf().noteHeadWidth(), *shared);
+        if (MeasureWidthCache::restoreShared(m, key, *shared, sharedKey)) {
+            cache.store(m, key);
+            return;
+        }
+    }
+
+    doComputeWidth(m, ctx, s, x, isSystemHeader, minTicks, maxTicks, stretchCoeff, overrideMinMeasureWidth);
+
+    cache.store(m, key);
+    if (shared) {
+        MeasureWidthCache::storeShared(m, key, *shared, sharedKey);
+    }
+}
+
+void MeasureLayout::doComputeWidth(Measure* m, LayoutContext& ctx, Segment* s, double x, bool isSystemHeader, Fraction minTicks,
+                                   Fraction maxTicks, double stretchCoeff, bool overrideMinMeasureWidth)
 {
     Segment* fs = m->firstEnabled();
     if (!fs->visible()) {           // first enabled could be a clef change on invisible staff
@@ -76,6 +76,8 @@ private:
 
     static void computeWidth(Measure* m, LayoutContext& ctx, Segment* s, double x, bool isSystemHeader, Fraction minTicks,
                              Fraction maxTicks, double stretchCoeff, bool overrideMinMeasureWidth = false);
+    static void doComputeWidth(Measure* m, LayoutContext& ctx, Segment* s, double x, bool isSystemHeader, Fraction minTicks,
+                               Fraction maxTicks, double stretchCoeff, bool overrideMinMeasureWidth);
 
     static double computeMinMeasureWidth(Measure* m, LayoutContext& ctx);
 
@@ -86,6 +88,11 @@ private:
     static void layoutMeasure(MeasureBase* currentMB, LayoutContext& ctx);
     static void checkStaffMoveValidity(Measure* measure, const LayoutContext& ctx);
 
+    static void layoutStavesChords(Measure* measure, LayoutContext& ctx);
+    static void layoutStaffChords(Measure* measure, staff_idx_t staffIdx, bool withLyrics, LayoutContext& ctx);
+    static void collectStavesForChordsLayout(const Measure* measure, const LayoutContext& ctx, std::vector<staff_idx_t>& parallelStaves,
+                                             std::vector<staff_idx_t>& serialStaves);
+
     static void createMultiMeasureRestsIfNeed(MeasureBase* currentMB, LayoutContext& ctx);
 };
 }
@@ -0,0 +1,384 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "measurewidthcache.h"
+
+#include <functional>
+
+#include "../../dom/chord.h"
+#include "../../dom/linkedobjects.h"
+#include "../../dom/lyrics.h"
+#include "../../dom/measure.h"
+#include "../../dom/note.h"
+#include "../../dom/score.h"
+#include "../../dom/segment.h"
+#include "../../dom/staff.h"
+#include "../../dom/stemslash.h"
+#include "../../dom/system.h"
+#include "../../infrastructure/shapearena.h"
+#include "../../style/style.h"
+
+using namespace mu::engraving;
+using namespace mu::engraving::rendering::dev;
+
+template<typename T>
+static void hashCombine(size_t& seed, const T& value)
+{
+    seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+//! NOTE Everything in the style that is a number, a flag or an enum; that includes the page format.
+//! Texts, fonts and colors affect the spacing only through the shapes, which are part of the content key
+static std::vector<double> styleValues(const MStyle& style)
+{
+    std::vector<double> values;
+    values.reserve(static_cast<size_t>(Sid::STYLES));
+    for (int i = 0; i < static_cast<int>(Sid::STYLES); ++i) {
+        const PropertyValue& value = style.value(static_cast<Sid>(i));
+        switch (value.type()) {
+        case P_TYPE::BOOL:
+        case P_TYPE::INT:
+            values.push_back(value.toInt());
+            break;
+        case P_TYPE::REAL:
+        case P_TYPE::SPATIUM:
+        case P_TYPE::MILLIMETRE:
+            values.push_back(value.toDouble());
+            break;
+        default:
+            values.push_back(value.isEnum() ? value.toInt() : 0);
+            break;
+        }
+    }
+
+    return values;
+}
+
+//! NOTE Items are identified by their link, so that the same note in two parts counts as the same.
+//! Items that are not linked (stems, ledger lines...) are identified by their closest linked parent;
+//! without one they belong to one score and are identified by pointer
+static void addItemId(std::vector<int64_t>& items, const EngravingItem* item)
+{
+    if (!item) {
+        items.push_back(0);
+        return;
+    }
+
+    int64_t depth = 0;
+    for (const EngravingItem* e = item; e; e = e->parentItem(), ++depth) {
+        if (e->links() && e->links()->lid() >= 0) {
+            items.push_back(1);
+            items.push_back(depth);
+            items.push_back(e->links()->lid());
+            return;
+        }
+        if (e->isSegment() || e->isMeasureBase() || e->isSystem()) {
+            break;
+        }
+    }
+
+    items.push_back(2);
+    items.push_back(static_cast<int64_t>(reinterpret_cast<uintptr_t>(item)));
+}
+
+//! NOTE What the kerning between the shapes reads from their items, besides the geometry
+//! (see HorizontalSpacing::computeKerningType)
+static void addKerningState(std::vector<int64_t>& items, const EngravingItem* item)
+{
+    if (item->isLyrics()) {
+        const Lyrics* lyrics = toLyrics(item);
+        const LyricsLine* separator = lyrics->separator();
+        items.push_back(lyrics->no());
+        items.push_back(static_cast<int64_t>(lyrics->syllabic()));
+        items.push_back(separator && separator->isEndMelisma());
+        items.push_back(separator ? separator->tick2().ticks() : -1);
+    } else if (item->isNote()) {
+        const Chord* chord = toNote(item)->chord();
+        if (chord) {
+            items.push_back(chord->up());
+            items.push_back(chord->isMelismaEnd());
+            items.push_back(chord->allowKerningAbove());
+            items.push_back(chord->allowKerningBelow());
+        }
+    }
+
+    // a stem slash may collide with the chords of its beam
+    const EngravingItem* parent = item->parentItem();
+    if (parent && parent->isNote()) {
+        parent = parent->parentItem();
+    }
+    if (item->isStemSlash() || (parent && parent->isChord())) {
+        const Chord* chord = item->isStemSlash() ? toStemSlash(item)->chord() : toChord(parent);
+        addItemId(items, chord ? chord->beam() : nullptr);
+    }
+}
+
+bool MeasureWidthCache::Key::operator==(const Key& other) const
+{
+    return firstSegment == other.firstSegment
+           && x == other.x
+           && isSystemHeader == other.isSystemHeader
+           && minTicks == other.minTicks
+           && maxTicks == other.maxTicks
+           && stretchCoeff == other.stretchCoeff
+           && squeezeFactor == other.squeezeFactor
+           && overrideMinMeasureWidth == other.overrideMinMeasureWidth
+           && isFirstInSystem == other.isFirstInSystem
+           && userStretch == other.userStretch
+           && systemWidth == other.systemWidth
+           && systemLeftMargin == other.systemLeftMargin
+           && segmentsSignature == other.segmentsSignature;
+}
+
+MeasureWidthCache::Key MeasureWidthCache::makeKey(const Measure* m, const Segment* s, double x, bool isSystemHeader,
+                                                  Fraction minTicks, Fraction maxTicks, double stretchCoeff, double squeezeFactor,
+                                                  bool overrideMinMeasureWidth)
+{
+    Key key;
+    key.firstSegment = s;
+    key.x = x;
+    key.isSystemHeader = isSystemHeader;
+    key.minTicks = minTicks;
+    key.maxTicks = maxTicks;
+    key.stretchCoeff = stretchCoeff;
+    key.squeezeFactor = squeezeFactor;
+    key.overrideMinMeasureWidth = overrideMinMeasureWidth;
+    key.isFirstInSystem = m->isFirstInSystem();
+    key.userStretch = m->userStretch();
+
+    if (const System* system = m->system()) {
+        key.systemWidth = system->width(LD_ACCESS::BAD);
+        key.systemLeftMargin = system->leftMargin();
+    }
+
+    //! NOTE Everything the spacing reads from the segments: which of them take part,
+    //! their durations and their shapes (any shape change bumps shapesRevision)
+    size_t signature = 0;
+    for (const Segment* seg = m->first(); seg; seg = seg->next()) {
+        hashCombine(signature, seg);
+        hashCombine(signature, static_cast<int>(seg->segmentType()));
+        hashCombine(signature, seg->enabled());
+        hashCombine(signature, seg->visible());
+        hashCombine(signature, seg->header());
+        hashCombine(signature, seg->allElementsInvisible());
+        hashCombine(signature, seg->ticks().ticks());
+        hashCombine(signature, seg->extraLeadingSpace().val());
+        hashCombine(signature, seg->shapesRevision());
+    }
+    key.segmentsSignature = signature;
+
+    return key;
+}
+
+bool MeasureWidthCache::restore(Measure* m, const Key& key) const
+{
+    auto it = m_entries.find(m);
+    if (it == m_entries.end()) {
+        return false;
+    }
+
+    for (const Entry& entry : it->second) {
+        if (!(entry.key == key)) {
+            continue;
+        }
+
+        for (const SegmentSpacing& spacing : entry.segments) {
+            spacing.segment->mutldata()->setPosX(spacing.x);
+            spacing.segment->setWidth(spacing.width);
+            spacing.segment->setWidthOffset(spacing.widthOffset);
+            spacing.segment->setStretch(spacing.stretch);
+        }
+
+        m->setSqueezableSpace(entry.squeezableSpace);
+        m->setLayoutStretch(entry.layoutStretch);
+        m->setWidth(entry.width);
+        m->setWidthLocked(entry.widthLocked);
+
+        return true;
+    }
+
+    return false;
+}
+
+void MeasureWidthCache::store(const Measure* m, const Key& key)
+{
+    Entry entry;
+    entry.key = key;
+    entry.width = m->width(LD_ACCESS::BAD);
+    entry.squeezableSpace = m->squeezableSpace();
+    entry.layoutStretch = m->layoutStretch();
+    entry.widthLocked = m->isWidthLocked();
+
+    bool spaced = false;
+    for (Segment* seg = m->first(); seg; seg = seg->next()) {
+        spaced = spaced || seg == key.firstSegment;
+        if (spaced) {
+            entry.segments.push_back({ seg, seg->x(), seg->width(LD_ACCESS::BAD), seg->widthOffset(), seg->stretch() });
+        }
+    }
+
+    std::vector<Entry>& entries = m_entries[m];
+    if (entries.size() >= MAX_ENTRIES_PER_MEASURE) {
+        entries.erase(entries.begin());
+    }
+
+    entries.push_back(std::move(entry));
+}
+
+SharedMeasureSpacing::Key MeasureWidthCache::makeSharedKey(const Measure* m, const Key& key, const MStyle& style, double noteHeadWidth,
+                                                            SharedMeasureSpacing& shared)
+{
+    if (!m_sharedStyleId) {
+        m_sharedStyleId = shared.styleId(styleValues(style));
+    }
+
+    SharedMeasureSpacing::Key sharedKey;
+    sharedKey.style = m_sharedStyleId.value();
+
+    sharedKey.params = {
+        key.x,
+        key.isSystemHeader ? 1.0 : 0.0,
+        key.minTicks.toDouble(),
+        key.maxTicks.toDouble(),
+        key.stretchCoeff,
+        key.squeezeFactor,
+        key.overrideMinMeasureWidth ? 1.0 : 0.0,
+        key.isFirstInSystem ? 1.0 : 0.0,
+        key.userStretch,
+        key.systemWidth,
+        key.systemLeftMargin,
+        noteHeadWidth
+    };
+
+    //! NOTE As the signature of the key, but without pointers: the shapes are compared by value
+    //! and the items by their link (see addItemId)
+    const Score* score = m->score();
+    std::vector<double>& geometry = sharedKey.geometry;
+    std::vector<int64_t>& items = sharedKey.items;
+    geometry.push_back(m->ticks().toDouble());
+    geometry.push_back(m->timesig().toDouble());
+    items.push_back(m->mmRestCount());
+
+    bool spaced = false;
+    for (const Segment* seg = m->first(); seg; seg = seg->next()) {
+        spaced = spaced || seg == key.firstSegment;
+        if (spaced) {
+            ++sharedKey.segments;
+        }
+
+        items.push_back(spaced);
+        items.push_back(static_cast<int64_t>(seg->segmentType()));
+        items.push_back(seg->enabled());
+        items.push_back(seg->visible());
+        items.push_back(seg->header());
+        items.push_back(seg->allElementsInvisible());
+        geometry.push_back(seg->rtick().toDouble());
+        geometry.push_back(seg->ticks().toDouble());
+        geometry.push_back(seg->extraLeadingSpace().val());
+
+        const ShapeArena& arena = seg->shapeArena();
+        items.push_back(static_cast<int64_t>(arena.staves()));
+        for (staff_idx_t staffIdx = 0; staffIdx < arena.staves(); ++staffIdx) {
+            const Staff* staff = score->staff(staffIdx);
+            items.push_back(staff && staff->show());
+            items.push_back(static_cast<int64_t>(arena.staffEnd(staffIdx) - arena.staffBegin(staffIdx)));
+            geometry.push_back(arena.staffSpatium(staffIdx));
+
+            for (size_t i = arena.staffBegin(staffIdx); i < arena.staffEnd(staffIdx); ++i) {
+                geometry.push_back(arena.left()[i]);
+                geometry.push_back(arena.right()[i]);
+                geometry.push_back(arena.top()[i]);
+                geometry.push_back(arena.bottom()[i]);
+                items.push_back(arena.zeroWidth()[i]);
+
+                const EngravingItem* item = arena.items()[i];
+                addItemId(items, item);
+                if (item) {
+                    items.push_back(static_cast<int64_t>(item->type()));
+                    addKerningState(items, item);
+                }
+            }
+        }
+    }
+
+    sharedKey.updateHash();
+
+    return sharedKey;
+}
+
+bool MeasureWidthCache::restoreShared(Measure* m, const Key& key, const SharedMeasureSpacing& shared,
+                                      const SharedMeasureSpacing::Key& sharedKey)
+{
+    SharedMeasureSpacing::Spacing spacing;
+    if (!shared.find(sharedKey, spacing) || spacing.segments.size() != sharedKey.segments) {
+        return false;
+    }
+
+    size_t idx = 0;
+    bool spaced = false;
+    for (Segment* seg = m->first(); seg; seg = seg->next()) {
+        spaced = spaced || seg == key.firstSegment;
+        if (!spaced) {
+            continue;
+        }
+
+        const SharedMeasureSpacing::SegmentSpacing& segSpacing = spacing.segments[idx++];
+        seg->mutldata()->setPosX(segSpacing.x);
+        seg->setWidth(segSpacing.width);
+        seg->setWidthOffset(segSpacing.widthOffset);
+        seg->setStretch(segSpacing.stretch);
+    }
+
+    m->setSqueezableSpace(spacing.squeezableSpace);
+    m->setLayoutStretch(spacing.layoutStretch);
+    m->setWidth(spacing.width);
+    m->setWidthLocked(spacing.widthLocked);
+
+    return true;
+}
+
+void MeasureWidthCache::storeShared(const Measure* m, const Key& key, SharedMeasureSpacing& shared,
+                                    const SharedMeasureSpacing::Key& sharedKey)
+{
+    SharedMeasureSpacing::Spacing spacing;
+    spacing.width = m->width(LD_ACCESS::BAD);
+    spacing.squeezableSpace = m->squeezableSpace();
+    spacing.layoutStretch = m->layoutStretch();
+    spacing.widthLocked = m->isWidthLocked();
+    spacing.segments.reserve(sharedKey.segments);
+
+    bool spaced = false;
+    for (const Segment* seg = m->first(); seg; seg = seg->next()) {
+        spaced = spaced || seg == key.firstSegment;
+        if (spaced) {
+            spacing.segments.push_back({ seg->x(), seg->width(LD_ACCESS::BAD), seg->widthOffset(), seg->stretch() });
+        }
+    }
+
+    shared.store(sharedKey, std::move(spacing));
+}
+
+void MeasureWidthCache::clear()
+{
+    m_entries.clear();
+    m_sharedStyleId.reset();
+}
@@ -0,0 +1,113 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_MEASUREWIDTHCACHE_DEV_H
+#define MU_ENGRAVING_MEASUREWIDTHCACHE_DEV_H
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "../../types/fraction.h"
+#include "sharedmeasurespacing.h"
+
+namespace mu::engraving {
+class Measure;
+class MStyle;
+class Segment;
+}
+
+namespace mu::engraving::rendering::dev {
+//---------------------------------------------------------
+//   MeasureWidthCache
+//    remembers the results of MeasureLayout::computeWidth
+//    during one layout, so that measures whose width is
+//    requested again with the same parameters (e.g. when the
+//    shortest note of the system goes back to a previous value,
+//    or a squeeze step is retried) are not respaced.
+//    Misses may be looked up by content in the spacing
+//    shared between the scores of the master score.
+//---------------------------------------------------------
+
+class MeasureWidthCache
+{
+public:
+    struct Key {
+        const Segment* firstSegment = nullptr;
+        double x = 0.0;
+        bool isSystemHeader = false;
+        Fraction minTicks;
+        Fraction maxTicks;
+        double stretchCoeff = 0.0;
+        double squeezeFactor = 0.0;
+        bool overrideMinMeasureWidth = false;
+        bool isFirstInSystem = false;
+        double userStretch = 0.0;
+        double systemWidth = 0.0;
+        double systemLeftMargin = 0.0;
+        size_t segmentsSignature = 0; // changes when the segments or their shapes change
+
+        bool operator==(const Key& other) const;
+    };
+
+    static Key makeKey(const Measure* m, const Segment* s, double x, bool isSystemHeader, Fraction minTicks, Fraction maxTicks,
+                       double stretchCoeff, double squeezeFactor, bool overrideMinMeasureWidth);
+
+    // applies the stored spacing of the measure, if any, and returns whether it did
+    bool restore(Measure* m, const Key& key) const;
+    void store(const Measure* m, const Key& key);
+
+    // the same measure in any score of the master score, with the same style, gives the same key
+    SharedMeasureSpacing::Key makeSharedKey(const Measure* m, const Key& key, const MStyle& style, double noteHeadWidth,
+                                            SharedMeasureSpacing& shared);
+
+    static bool restoreShared(Measure* m, const Key& key, const SharedMeasureSpacing& shared, const SharedMeasureSpacing::Key& sharedKey);
+    static void storeShared(const Measure* m, const Key& key, SharedMeasureSpacing& shared, const SharedMeasureSpacing::Key& sharedKey);
+
+    void clear();
+
+private:
+    struct SegmentSpacing {
+        Segment* segment = nullptr;
+        double x = 0.0;
+        double width = 0.0;
+        double widthOffset = 0.0;
+        double stretch = 0.0;
+    };
+
+    struct Entry {
+        Key key;
+        double width = 0.0;
+        double squeezableSpace = 0.0;
+        double layoutStretch = 0.0;
+        bool widthLocked = false;
+        std::vector<SegmentSpacing> segments;
+    };
+
+    static constexpr size_t MAX_ENTRIES_PER_MEASURE = 8;
+
+    std::unordered_map<const Measure*, std::vector<Entry> > m_entries;
+    std::optional<size_t> m_sharedStyleId; // the style doesn't change during a layout
+};
+}
+
+#endif // MU_ENGRAVING_MEASUREWIDTHCACHE_DEV_H
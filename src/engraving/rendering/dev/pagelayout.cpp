@@ -57,6 +57,7 @@
 #include "tlayout.h"
 #include "tupletlayout.h"
 #include "verticalgapdata.h"
+#include "layoutprofiler.h"
 
 #include "log.h"
 
@@ -117,6 +118,7 @@ void PageLayout::getNextPage(LayoutContext& ctx)
 void PageLayout::collectPage(LayoutContext& ctx)
 {
     TRACEFUNC;
+    LAYOUT_PROFILE_ARG("pass", "page", static_cast<int64_t>(ctx.state().pageIdx()));
 
     Page* page = ctx.mutState().page();
     const LayoutConfiguration& conf = ctx.conf();
@@ -438,7 +440,7 @@ void PageLayout::collectPage(LayoutContext& ctx)
         }
     }
 
-    page->invalidateBspTree();
+    page->invalidateSpatialIndex();
 }
 
 //---------------------------------------------------------
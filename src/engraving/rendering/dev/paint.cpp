@@ -21,6 +21,8 @@
  */
 #include "paint.h"
 
+#include <cmath>
+
 #include "draw/painter.h"
 #include "dom/score.h"
 #include "dom/page.h"
@@ -67,9 +69,25 @@ void Paint::paintScore(Painter* painter, Score* score, const IScoreRenderer::Pai
     }
 
     // Setup score draw system
-    mu::engraving::MScore::pixelRatio = mu::engraving::DPI / DEVICE_DPI;
-    score->setPrinting(opt.isPrinting);
-    mu::engraving::MScore::pdfPrinting = opt.isPrinting;
+    //! NOTE Only written when changed, the state may have been set up for several pages beforehand
+    const double pixelRatio = mu::engraving::DPI / DEVICE_DPI;
+    if (mu::engraving::MScore::pixelRatio != pixelRatio) {
+        mu::engraving::MScore::pixelRatio = pixelRatio;
+    }
+
+    if (score->printing() != opt.isPrinting) {
+        score->setPrinting(opt.isPrinting);
+    }
+
+    if (mu::engraving::MScore::pdfPrinting != opt.isPrinting) {
+        mu::engraving::MScore::pdfPrinting = opt.isPrinting;
+    }
+
+    //! NOTE The debug painting needs the painted elements
+    const bool useDisplayLists = opt.useDisplayLists
+                                 && (opt.isPrinting || !pages.front()->configuration()->debuggingOptions().anyEnabled());
+
+    const DetailLevel level = detailLevel(painter, score, opt);
 
     // Setup page counts
     int fromPage = opt.fromPage >= 0 ? opt.fromPage : 0;
@@ -138,8 +156,20 @@ void Paint::paintScore(Painter* painter, Score* score, const IScoreRenderer::Pai
                 disableClipping = true;
             }
 
-            std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
-            paintItems(*painter, elements);
+            std::vector<EngravingItem*> elements;
+            if (level != DetailLevel::Full) {
+                elements = page->items(drawRect.translated(-pagePos));
+                paintItemsSimplified(*painter, elements, level);
+            } else if (useDisplayLists) {
+                PageDisplayList& displayList = page->displayList();
+                displayList.update(page, [](Painter& p, const std::vector<EngravingItem*>& items) {
+                    paintItems(p, items);
+                });
+                displayList.paint(*painter, drawRect.translated(-pagePos));
+            } else {
+                elements = page->items(drawRect.translated(-pagePos));
+                paintItems(*painter, elements);
+            }
             //DebugPaint::paintPageTree(*painter, page);
 
             if (disableClipping) {
@@ -215,7 +245,6 @@ void Paint::paintItem(Painter& painter, const EngravingItem* item)
     if (item->ldata()->isSkipDraw()) {
         return;
     }
-    item->itemDiscovered = false;
     PointF itemPosition(item->pagePos());
 
     painter.translate(itemPosition);
@@ -238,3 +267,92 @@ void Paint::paintItems(Painter& painter, const std::vector<EngravingItem*>& item
         paintItem(painter, item);
     }
 }
+
+//---------------------------------------------------------
+//   detailLevel
+//    how much is painted, by the size of one spatium on the device
+//---------------------------------------------------------
+
+Paint::DetailLevel Paint::detailLevel(const Painter* painter, const Score* score, const IScoreRenderer::PaintOptions& opt)
+{
+    if (opt.simplifiedSpatiumSize <= 0.0 && opt.staffLinesOnlySpatiumSize <= 0.0) {
+        return DetailLevel::Full;
+    }
+
+    const double spatiumSize = score->style().spatium() * std::abs(painter->worldTransform().m11());
+
+    if (spatiumSize < opt.staffLinesOnlySpatiumSize) {
+        return DetailLevel::StaffLinesOnly;
+    }
+
+    if (spatiumSize < opt.simplifiedSpatiumSize) {
+        return DetailLevel::Simplified;
+    }
+
+    return DetailLevel::Full;
+}
+
+//---------------------------------------------------------
+//   paintItemsSimplified
+//    lines are painted as usual, they are as cheap as any simplified shape;
+//    glyphs become filled rects and text becomes bars
+//---------------------------------------------------------
+
+void Paint::paintItemsSimplified(Painter& painter, const std::vector<EngravingItem*>& items, DetailLevel level)
+{
+    TRACEFUNC;
+    std::vector<EngravingItem*> sortedItems(items.begin(), items.end());
+
+    std::sort(sortedItems.begin(), sortedItems.end(), mu::engraving::elementLessThan);
+
+    painter.save();
+    painter.setPen(PenStyle::NoPen);
+
+    for (const EngravingItem* item : sortedItems) {
+        if (!item->isInteractionAvailable() || item->ldata()->isSkipDraw()) {
+            continue;
+        }
+
+        if (item->isStaffLines()) {
+            paintItem(painter, item);
+            continue;
+        }
+
+        if (level == DetailLevel::StaffLinesOnly) {
+            continue;
+        }
+
+        RectF bbox = item->ldata()->bbox().translated(item->pagePos());
+
+        if (item->isTextBase()) {
+            painter.fillRect(RectF(bbox.x(), bbox.y() + bbox.height() * 0.25, bbox.width(), bbox.height() * 0.5), item->curColor());
+            continue;
+        }
+
+        switch (item->type()) {
+        case ElementType::NOTE:
+        case ElementType::REST:
+        case ElementType::MMREST:
+        case ElementType::MEASURE_REPEAT:
+        case ElementType::ACCIDENTAL:
+        case ElementType::NOTEDOT:
+        case ElementType::HOOK:
+        case ElementType::CLEF:
+        case ElementType::KEYSIG:
+        case ElementType::TIMESIG:
+        case ElementType::ARTICULATION:
+        case ElementType::ORNAMENT:
+        case ElementType::FERMATA:
+        case ElementType::BREATH:
+        case ElementType::ARPEGGIO:
+        case ElementType::TREMOLO_SINGLECHORD:
+            painter.fillRect(bbox, item->curColor());
+            break;
+        default:
+            paintItem(painter, item);
+            break;
+        }
+    }
+
+    painter.restore();
+}
@@ -21,9 +21,12 @@
  */
 #include "passbase.h"
 
+#include "layoutprofiler.h"
+
 using namespace mu::engraving::rendering::dev;
 
 void PassBase::run(Score* score, LayoutContext& ctx)
 {
+    LAYOUT_PROFILE("pass", name());
     doRun(score, ctx);
 }
@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_PASSBASE_DEV_H
 #define MU_ENGRAVING_PASSBASE_DEV_H
 
+#include <string_view>
+
 namespace mu::engraving {
 class Score;
 }
@@ -35,6 +37,9 @@ public:
 
     void run(Score* score, LayoutContext& ctx);
 
+    // used by the layout profiler
+    virtual std::string_view name() const = 0;
+
 private:
 
     virtual void doRun(Score* score, LayoutContext& ctx) = 0;
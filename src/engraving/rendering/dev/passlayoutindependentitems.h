@@ -33,6 +33,8 @@ class PassLayoutIndependentItems : public PassBase
 {
 public:
 
+    std::string_view name() const override { return "independent items"; }
+
 private:
 
     void doRun(Score* score, LayoutContext& ctx) override;
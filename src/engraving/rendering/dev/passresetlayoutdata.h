@@ -30,6 +30,8 @@ class PassResetLayoutData : public PassBase
 public:
     PassResetLayoutData() = default;
 
+    std::string_view name() const override { return "reset"; }
+
 private:
     void doRun(Score* score, LayoutContext& ctx) override;
 };
@@ -15,6 +15,8 @@ set(RENDERING_DEV_SRC
     ${CMAKE_CURRENT_LIST_DIR}/tlayout.h
     ${CMAKE_CURRENT_LIST_DIR}/layoutcontext.cpp
     ${CMAKE_CURRENT_LIST_DIR}/layoutcontext.h
+    ${CMAKE_CURRENT_LIST_DIR}/layoutprofiler.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/layoutprofiler.h
     ${CMAKE_CURRENT_LIST_DIR}/scorelayout.cpp
     ${CMAKE_CURRENT_LIST_DIR}/scorelayout.h
     ${CMAKE_CURRENT_LIST_DIR}/scorepageviewlayout.cpp
@@ -27,6 +29,10 @@ set(RENDERING_DEV_SRC
     ${CMAKE_CURRENT_LIST_DIR}/lyricslayout.h
     ${CMAKE_CURRENT_LIST_DIR}/measurelayout.cpp
     ${CMAKE_CURRENT_LIST_DIR}/measurelayout.h
+    ${CMAKE_CURRENT_LIST_DIR}/measurewidthcache.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/measurewidthcache.h
+    ${CMAKE_CURRENT_LIST_DIR}/sharedmeasurespacing.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/sharedmeasurespacing.h
     ${CMAKE_CURRENT_LIST_DIR}/beamlayout.cpp
     ${CMAKE_CURRENT_LIST_DIR}/beamlayout.h
     ${CMAKE_CURRENT_LIST_DIR}/beamtremololayout.cpp
@@ -49,6 +55,8 @@ set(RENDERING_DEV_SRC
     ${CMAKE_CURRENT_LIST_DIR}/pagelayout.h
     ${CMAKE_CURRENT_LIST_DIR}/slurtielayout.cpp
     ${CMAKE_CURRENT_LIST_DIR}/slurtielayout.h
+    ${CMAKE_CURRENT_LIST_DIR}/slurcollisionenvelope.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/slurcollisionenvelope.h
     ${CMAKE_CURRENT_LIST_DIR}/guitarbendlayout.cpp
     ${CMAKE_CURRENT_LIST_DIR}/guitarbendlayout.h
     ${CMAKE_CURRENT_LIST_DIR}/arpeggiolayout.cpp
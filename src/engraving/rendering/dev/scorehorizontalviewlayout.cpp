@@ -51,14 +51,21 @@
 #include "measurelayout.h"
 #include "horizontalspacing.h"
 #include "tremololayout.h"
+#include "layoutprofiler.h"
 
 #include "log.h"
 
 using namespace mu::engraving;
 using namespace mu::engraving::rendering::dev;
 
-void ScoreHorizontalViewLayout::layoutHorizontalView(Score* score, LayoutContext& ctx, const Fraction& stick, const Fraction& etick)
+void ScoreHorizontalViewLayout::layoutHorizontalView(Score* score, LayoutContext& ctx, const Fraction& st, const Fraction& et)
 {
+    Fraction stick = st;
+    Fraction etick = et;
+    if (ctx.conf().hasViewport()) {
+        restrictRangeToViewport(ctx, stick, etick);
+    }
+
     ctx.mutState().setEndTick(etick);
 
     //---------------------------------------------------
@@ -98,6 +105,89 @@ void ScoreHorizontalViewLayout::layoutHorizontalView(Score* score, LayoutContext
     layoutLinear(ctx, ctx.state().isLayoutAll());
 }
 
+//---------------------------------------------------------
+//   restrictRangeToViewport
+//    Only the requested measures near the viewport are laid out completely,
+//    together with the measures with estimated widths that have been scrolled into view.
+//    The other requested measures get an estimated width, so the cost of a layout
+//    does not depend on the length of the score.
+//---------------------------------------------------------
+
+void ScoreHorizontalViewLayout::restrictRangeToViewport(LayoutContext& ctx, Fraction& stick, Fraction& etick)
+{
+    const double left = ctx.conf().viewportLayoutLeft();
+    const double right = ctx.conf().viewportLayoutRight();
+
+    MeasureBase* mb = ctx.mutDom().first();
+    if (mb && mb->isMeasure() && ctx.conf().styleB(Sid::createMultiMeasureRests) && toMeasure(mb)->hasMMRest()) {
+        mb = toMeasure(mb)->mmRest();
+    }
+
+    // the positions of the previous layout, estimated where there was none
+    double x = ctx.dom().systems().empty() ? 0.0 : ctx.dom().systems().front()->x() + ctx.dom().systems().front()->leftMargin();
+
+    const Measure* firstInView = nullptr;
+    const Measure* lastInView = nullptr;
+    std::vector<Measure*> requestedOutOfView;
+
+    for (; mb; mb = mb->nextMM()) {
+        if (mb->isHBox()) {
+            x += mb->width();
+            continue;
+        }
+        if (!mb->isMeasure()) {
+            continue;
+        }
+
+        Measure* m = toMeasure(mb);
+        const double w = (m->isWidthEstimated() || m->width() <= 0.0) ? estimateMeasureWidth(m, ctx) : m->width();
+        const bool inView = x <= right && x + w >= left;
+        const bool requested = m->tick() >= stick && m->tick() <= etick;
+        x += w;
+
+        if (inView && (requested || m->isWidthEstimated())) {
+            if (!firstInView) {
+                firstInView = m;
+            }
+            lastInView = m;
+        } else if (requested) {
+            requestedOutOfView.push_back(m);
+        }
+    }
+
+    if (!firstInView) {
+        // the change is far from the viewport, lay it out as requested
+        return;
+    }
+
+    for (Measure* m : requestedOutOfView) {
+        m->setWidthEstimated(true);
+    }
+
+    stick = firstInView->tick();
+    etick = lastInView->tick();
+}
+
+//---------------------------------------------------------
+//   estimateMeasureWidth
+//    rough width of a measure which is not laid out,
+//    good enough for the measures far from the viewport
+//---------------------------------------------------------
+
+double ScoreHorizontalViewLayout::estimateMeasureWidth(const Measure* m, const LayoutContext& ctx)
+{
+    static constexpr double SEGMENT_WIDTH = 4.0;    // spatium
+    static constexpr double MEASURE_PADDING = 3.0;  // spatium
+
+    size_t segments = 0;
+    for (const Segment* s = m->first(SegmentType::ChordRest); s; s = s->next(SegmentType::ChordRest)) {
+        ++segments;
+    }
+
+    const double width = (SEGMENT_WIDTH * segments + MEASURE_PADDING) * ctx.conf().spatium();
+    return std::max(width, ctx.conf().styleMM(Sid::minMeasureWidth).val());
+}
+
 void ScoreHorizontalViewLayout::layoutLinear(LayoutContext& ctx, bool layoutAll)
 {
     resetSystems(ctx, layoutAll);
@@ -166,6 +256,9 @@ void ScoreHorizontalViewLayout::layoutLinear(LayoutContext& ctx)
             continue;
         }
         Measure* m = toMeasure(mb);
+        if (m->isWidthEstimated()) {
+            continue;
+        }
 
         for (size_t track = 0; track < ctx.dom().ntracks(); ++track) {
             for (Segment* segment = m->first(); segment; segment = segment->next()) {
@@ -237,12 +330,14 @@ void ScoreHorizontalViewLayout::layoutLinear(LayoutContext& ctx)
     system->setPos(lm, tm);
     ctx.mutState().page()->setWidth(lm + system->width() + rm);
     ctx.mutState().page()->setHeight(tm + system->height() + bm);
-    ctx.mutState().page()->invalidateBspTree();
+    ctx.mutState().page()->invalidateSpatialIndex();
 }
 
 // Append all measures to System. VBox is not included to System
 void ScoreHorizontalViewLayout::collectLinearSystem(LayoutContext& ctx)
 {
+    LAYOUT_PROFILE("pass", "system");
+
     std::vector<int> visibleParts;
     for (size_t partIdx = 0; partIdx < ctx.dom().parts().size(); partIdx++) {
         if (ctx.dom().parts().at(partIdx)->show()) {
@@ -302,6 +397,7 @@ void ScoreHorizontalViewLayout::collectLinearSystem(LayoutContext& ctx)
 
             if (m->tick() >= ctx.state().startTick() && m->tick() <= ctx.state().endTick()) {
                 // for measures in range, do full layout
+                m->setWidthEstimated(false);
                 if (ctx.conf().isMode(LayoutMode::HORIZONTAL_FIXED)) {
                     MeasureLayout::createEndBarLines(m, true, ctx);
                     layoutSegmentsWithDuration(m, visibleParts);
@@ -313,6 +409,10 @@ void ScoreHorizontalViewLayout::collectLinearSystem(LayoutContext& ctx)
                     ww = m->width();
                     MeasureLayout::layoutMeasureElements(m, ctx);
                 }
+            } else if (m->isWidthEstimated()) {
+                // far from the viewport, laid out when scrolled into view
+                ww = estimateMeasureWidth(m, ctx);
+                m->setWidth(ww);
             } else {
                 // for measures not in range, use existing layout
                 ww = m->width();
@@ -32,6 +32,9 @@ public:
     static void layoutHorizontalView(Score* score, LayoutContext& ctx, const Fraction& stick, const Fraction& etick);
 
 private:
+    static void restrictRangeToViewport(LayoutContext& ctx, Fraction& stick, Fraction& etick);
+    static double estimateMeasureWidth(const Measure* m, const LayoutContext& ctx);
+
     static void layoutLinear(LayoutContext& ctx, bool layoutAll);
     static void layoutLinear(LayoutContext& ctx);
     static void resetSystems(LayoutContext& ctx, bool layoutAll);
@@ -23,10 +23,14 @@
 
 #include "dom/score.h"
 #include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/segment.h"
 #include "dom/system.h"
 #include "dom/page.h"
+#include "dom/undo.h"
 
 #include "layoutcontext.h"
+#include "sharedmeasurespacing.h"
 
 #include "pagelayout.h"
 #include "scorepageviewlayout.h"
@@ -34,6 +38,7 @@
 #include "scoreverticalviewlayout.h"
 
 #include "dumplayoutdata.h"
+#include "layoutprofiler.h"
 
 using namespace mu::engraving;
 using namespace mu::engraving::rendering::dev;
@@ -47,9 +52,36 @@ public:
     ~CmdStateLocker() { m_score->cmdState().unlock(); }
 };
 
+//! NOTE After an edit, the master score and then its excerpts are laid out (see Score::update);
+//! the excerpts take the spacing of the measures with the same content from that pass.
+//! The edit is still an open command then, it tells the pass apart from the previous ones
+void ScoreLayout::initSharedMeasureSpacing(Score* score, LayoutContext& ctx)
+{
+    MasterScore* master = score->masterScore();
+    if (!master || master->excerpts().empty() || !master->undoStack()) {
+        return;
+    }
+
+    const UndoStack* undoStack = master->undoStack();
+    SharedMeasureSpacing* shared = SharedMeasureSpacing::instance();
+    shared->bind(master, undoStack->state(), undoStack->current(), score->isMaster());
+    ctx.mutState().setSharedMeasureSpacing(shared);
+}
+
+//! NOTE The arenas are copies of the segment shapes for horizontal spacing;
+//! they are built again on the next spacing, so they are not kept between layouts.
+//! Only the segments spaced since the last layout have one, the score records them
+void ScoreLayout::releaseShapeArenas(Score* score)
+{
+    for (Segment* s : score->takeBuiltShapeArenas()) {
+        s->releaseShapeArena();
+    }
+}
+
 void ScoreLayout::layoutRange(Score* score, const Fraction& st, const Fraction& et)
 {
     TRACEFUNC;
+    LAYOUT_PROFILE("layout", "layoutRange");
 
     CmdStateLocker cmdStateLocker(score);
     LayoutContext ctx(score);
@@ -79,6 +111,7 @@ void ScoreLayout::layoutRange(Score* score, const Fraction& st, const Fraction&
     }
 
     ctx.mutState().setIsLayoutAll(isLayoutAll);
+    initSharedMeasureSpacing(score, ctx);
 
     // Init context and layout
     switch (ctx.conf().viewMode()) {
@@ -95,5 +128,7 @@ void ScoreLayout::layoutRange(Score* score, const Fraction& st, const Fraction&
         break;
     }
 
+    releaseShapeArenas(score);
+
     //LOGDA() << DumpLayoutData::dump(score);
 }
@@ -29,11 +29,16 @@ class Score;
 }
 
 namespace mu::engraving::rendering::dev {
+class LayoutContext;
 class ScoreLayout
 {
 public:
 
     static void layoutRange(Score* score, const Fraction& st, const Fraction& et);
+
+private:
+    static void initSharedMeasureSpacing(Score* score, LayoutContext& ctx);
+    static void releaseShapeArenas(Score* score);
 };
 }
 
@@ -223,16 +223,53 @@ void ScorePageViewLayout::doLayout(LayoutContext& ctx)
         //    c) this page ends with the same measure as the previous layout
         //    pageOldMeasure will be last measure from previous layout if range was completed on or before this page
         //    it will be nullptr if this page was never laid out or if we collected a system for next page
-    } while (state.curSystem() && !(state.rangeDone() && lmb == state.pageOldMeasure()));
+        // or
+        // 3) a progressive layout has reached its page limit
+    } while (state.curSystem() && !(state.rangeDone() && lmb == state.pageOldMeasure()) && !isPageLimitReached(ctx));
     // && page->system(0)->measures().back()->tick() > endTick // FIXME: perhaps the first measure was meant? Or last system?
 }
 
+bool ScorePageViewLayout::isPageLimitReached(const LayoutContext& ctx)
+{
+    return ctx.conf().maxPages() > 0 && ctx.state().pageIdx() >= ctx.conf().maxPages();
+}
+
 void ScorePageViewLayout::layoutFinished(Score* score, LayoutContext& ctx)
 {
     LAYOUT_CALL();
 
     LayoutState& state = ctx.mutState();
 
+    // the old systems skipped when the line breaks re-converged
+    for (System* s : state.absorbedSystems()) {
+        Page* p = s->page();
+        if (p && muse::remove(p->systems(), s)) {
+            p->invalidateSpatialIndex();
+        }
+    }
+    muse::DeleteAll(state.absorbedSystems());
+    state.absorbedSystems().clear();
+
+    if (state.curSystem() && state.systemList().empty() && isPageLimitReached(ctx)) {
+        // Progressive layout stopped: the next system was collected, but is not placed on a page.
+        // It is collected again when the layout continues (see Score::layoutNextPages),
+        // until then the measures after the last page have no system
+        System* next = state.curSystem();
+        muse::remove(score->systems(), next);
+        if (Page* p = next->page()) {
+            muse::remove(p->systems(), next);
+        }
+        delete next;
+        state.setCurSystem(nullptr);
+
+        while (score->npages() > state.pageIdx()) {
+            Page* p = score->pages().back();
+            score->pages().pop_back();
+            delete p;
+        }
+        return;
+    }
+
     if (!state.curSystem()) {
         // The end of the score. The remaining systems are not needed...
         muse::DeleteAll(state.systemList());
@@ -245,9 +282,11 @@ void ScorePageViewLayout::layoutFinished(Score* score, LayoutContext& ctx)
             delete p;
         }
     } else {
+        // the next system was collected again, but not placed on the current page;
+        // the other systems of its page are unchanged
         Page* p = state.curSystem()->page();
         if (p && (p != state.page())) {
-            p->invalidateBspTree();
+            p->invalidateSpatialIndex(state.curSystem());
         }
     }
 
@@ -38,6 +38,7 @@ private:
 
     static void doLayout(LayoutContext& ctx);
 
+    static bool isPageLimitReached(const LayoutContext& ctx);
     static void layoutFinished(Score* score, LayoutContext& ctx);
 };
 }
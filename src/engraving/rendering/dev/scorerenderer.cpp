@@ -69,6 +69,11 @@ void ScoreRenderer::paintItem(Painter& painter, const EngravingItem* item) const
     Paint::paintItem(painter, item);
 }
 
+void ScoreRenderer::paintItems(Painter& painter, const std::vector<EngravingItem*>& items) const
+{
+    Paint::paintItems(painter, items);
+}
+
 void ScoreRenderer::doLayoutItem(EngravingItem* item)
 {
     LayoutContext ctx(item->score());
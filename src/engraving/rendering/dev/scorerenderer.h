@@ -40,6 +40,7 @@ public:
     SizeF pageSizeInch(const Score* score, const PaintOptions& opt) const override;
     void paintScore(muse::draw::Painter* painter, Score* score, const IScoreRenderer::PaintOptions& opt) const override;
     void paintItem(muse::draw::Painter& painter, const EngravingItem* item) const override;
+    void paintItems(muse::draw::Painter& painter, const std::vector<EngravingItem*>& items) const override;
 
     //! TODO Investigation is required, probably these functions or their calls should not be.
     // Other
@@ -193,7 +193,7 @@ void ScoreVerticalViewLayout::doLayout(LayoutContext& ctx)
     } else {
         Page* p = ctx.mutState().curSystem()->page();
         if (p && (p != ctx.state().page())) {
-            p->invalidateBspTree();
+            p->invalidateSpatialIndex();
         }
     }
     ctx.mutDom().systems().insert(ctx.mutDom().systems().end(), ctx.state().systemList().begin(), ctx.state().systemList().end());
@@ -0,0 +1,151 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "sharedmeasurespacing.h"
+
+#include <functional>
+
+using namespace mu::engraving;
+using namespace mu::engraving::rendering::dev;
+
+template<typename T>
+static void hashCombine(size_t& seed, const T& value)
+{
+    seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+void SharedMeasureSpacing::Key::updateHash()
+{
+    hash = 0;
+    hashCombine(hash, style);
+    hashCombine(hash, segments);
+    for (double v : params) {
+        hashCombine(hash, v);
+    }
+    for (double v : geometry) {
+        hashCombine(hash, v);
+    }
+    for (int64_t v : items) {
+        hashCombine(hash, v);
+    }
+}
+
+bool SharedMeasureSpacing::Key::operator==(const Key& other) const
+{
+    return hash == other.hash
+           && style == other.style
+           && segments == other.segments
+           && params == other.params
+           && geometry == other.geometry
+           && items == other.items;
+}
+
+SharedMeasureSpacing::SharedMeasureSpacing(size_t capacity)
+    : m_capacity(capacity)
+{
+}
+
+SharedMeasureSpacing* SharedMeasureSpacing::instance()
+{
+    static SharedMeasureSpacing s;
+    return &s;
+}
+
+void SharedMeasureSpacing::bind(const MasterScore* master, int undoState, const void* command, bool newPass)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (newPass || master != m_master || undoState != m_undoState || command != m_command) {
+        doClear();
+        m_master = master;
+        m_undoState = undoState;
+        m_command = command;
+    }
+}
+
+size_t SharedMeasureSpacing::styleId(const std::vector<double>& style)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (const auto& entry : m_styles) {
+        if (entry.second == style) {
+            return entry.first;
+        }
+    }
+
+    m_styles.emplace_back(m_nextStyleId, style);
+    return m_nextStyleId++;
+}
+
+bool SharedMeasureSpacing::find(const Key& key, Spacing& spacing) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        ++m_stats.misses;
+        return false;
+    }
+
+    ++m_stats.hits;
+    spacing = it->second;
+    return true;
+}
+
+void SharedMeasureSpacing::store(const Key& key, Spacing spacing)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    //! NOTE The entries only live for one layout pass, so they are not tracked by use;
+    //! when the capacity is reached they are all dropped
+    if (m_entries.size() >= m_capacity && m_entries.find(key) == m_entries.end()) {
+        m_entries.clear();
+    }
+
+    m_entries[key] = std::move(spacing);
+}
+
+SharedMeasureSpacing::Stats SharedMeasureSpacing::stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Stats stats = m_stats;
+    stats.size = m_entries.size();
+    return stats;
+}
+
+void SharedMeasureSpacing::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    doClear();
+    m_stats = Stats();
+}
+
+void SharedMeasureSpacing::doClear()
+{
+    m_entries.clear();
+    m_styles.clear();
+    m_master = nullptr;
+    m_undoState = 0;
+    m_command = nullptr;
+}
@@ -0,0 +1,128 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_SHAREDMEASURESPACING_DEV_H
+#define MU_ENGRAVING_SHAREDMEASURESPACING_DEV_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mu::engraving {
+class MasterScore;
+}
+
+namespace mu::engraving::rendering::dev {
+//---------------------------------------------------------
+//   SharedMeasureSpacing
+//    the horizontal spacing of measures, keyed by what the
+//    measures contain rather than by their pointers, so a
+//    part whose measures match the ones of another score of
+//    the same master score (e.g. a second copy of the same
+//    instrument) takes their spacing instead of computing it
+//    again. The scores are laid out one after the other after
+//    an edit: the store keeps the spacing of one layout pass
+//    of one master score and is cleared by the next one
+//    (see bind()). Bounded and thread safe.
+//---------------------------------------------------------
+
+class SharedMeasureSpacing
+{
+public:
+    struct Key {
+        size_t style = 0;               // see styleId()
+        size_t segments = 0;            // the number of spaced segments
+        std::vector<double> params;     // the spacing parameters: shortest notes, stretch, system width...
+        std::vector<double> geometry;   // the segment durations and the shapes
+        std::vector<int64_t> items;     // the segment flags, the items in the shapes and what their kerning depends on
+        size_t hash = 0;
+
+        void updateHash();
+        bool operator==(const Key& other) const;
+    };
+
+    struct SegmentSpacing {
+        double x = 0.0;
+        double width = 0.0;
+        double widthOffset = 0.0;
+        double stretch = 0.0;
+    };
+
+    struct Spacing {
+        double width = 0.0;
+        double squeezableSpace = 0.0;
+        double layoutStretch = 0.0;
+        bool widthLocked = false;
+        std::vector<SegmentSpacing> segments;
+    };
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        size_t size = 0;
+    };
+
+    static constexpr size_t DEFAULT_CAPACITY = 4096;
+
+    explicit SharedMeasureSpacing(size_t capacity = DEFAULT_CAPACITY);
+
+    // the store used by the layout
+    static SharedMeasureSpacing* instance();
+
+    // starts sharing the spacing of the given state of the master score (and command, while one is open),
+    // drops the entries of any other one; a new layout pass of the master score itself drops them too
+    void bind(const MasterScore* master, int undoState, const void* command, bool newPass);
+
+    // the same style values give the same id, as long as the store is bound to the same master score
+    size_t styleId(const std::vector<double>& style);
+
+    bool find(const Key& key, Spacing& spacing) const;
+    void store(const Key& key, Spacing spacing);
+
+    Stats stats() const;
+    void clear();
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key& key) const { return key.hash; }
+    };
+
+    void doClear();
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<Key, Spacing, KeyHash> m_entries;
+    size_t m_capacity = DEFAULT_CAPACITY;
+    mutable Stats m_stats;
+
+    const MasterScore* m_master = nullptr;
+    int m_undoState = 0;
+    const void* m_command = nullptr;
+
+    std::vector<std::pair<size_t, std::vector<double> > > m_styles;
+    size_t m_nextStyleId = 1; // never reused, so that an id taken before a clear doesn't match another style
+};
+}
+
+#endif // MU_ENGRAVING_SHAREDMEASURESPACING_DEV_H
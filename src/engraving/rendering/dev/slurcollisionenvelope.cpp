@@ -0,0 +1,83 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "slurcollisionenvelope.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../../infrastructure/shape.h"
+
+using namespace muse;
+using namespace mu::engraving;
+using namespace mu::engraving::rendering::dev;
+
+SlurCollisionEnvelope::SlurCollisionEnvelope(const std::vector<Shape>& shapes, bool up)
+    : m_up(up)
+{
+    for (const Shape& shape : shapes) {
+        for (const ShapeElement& el : shape.elements()) {
+            const double left = el.left();
+            const double right = el.right();
+            if (left == right) {
+                continue;
+            }
+            const double y = up ? std::min(el.top(), el.bottom()) : std::max(el.top(), el.bottom());
+            m_elements.push_back({ std::min(left, right), left, right, y });
+            m_maxWidth = std::max(m_maxWidth, std::abs(right - left));
+        }
+    }
+
+    std::sort(m_elements.begin(), m_elements.end(), [](const Element& a, const Element& b) {
+        return a.minX < b.minX;
+    });
+}
+
+bool SlurCollisionEnvelope::intersects(const RectF& rect) const
+{
+    const double left = rect.left();
+    const double right = rect.right();
+    if (left == right) {
+        return false;
+    }
+
+    // an element further left than its width can't reach the rect,
+    // the margin only makes the scan tolerant to rounding
+    static constexpr double MARGIN = 1.0;
+    const double minX = std::min(left, right) - m_maxWidth - MARGIN;
+    const double maxX = std::max(left, right);
+
+    auto it = std::lower_bound(m_elements.begin(), m_elements.end(), minX, [](const Element& el, double x) {
+        return el.minX < x;
+    });
+
+    const double rectY = m_up ? std::max(rect.top(), rect.bottom()) : std::min(rect.top(), rect.bottom());
+    for (; it != m_elements.end() && it->minX < maxX; ++it) {
+        if (!(it->right > left && it->left < right)) {
+            continue;
+        }
+        if (m_up ? it->y <= rectY : rectY <= it->y) {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,66 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_SLURCOLLISIONENVELOPE_DEV_H
+#define MU_ENGRAVING_SLURCOLLISIONENVELOPE_DEV_H
+
+#include <vector>
+
+#include "draw/types/geometry.h"
+
+namespace mu::engraving {
+class Shape;
+}
+
+namespace mu::engraving::rendering::dev {
+//---------------------------------------------------------
+//   SlurCollisionEnvelope
+//    the shape elements a slur segment has to avoid, gathered once
+//    before the adjustment iterations and sorted by their left edge.
+//    Each element keeps only its vertical edge on the side of the slur,
+//    which is all Shape::clearsVertically() looks at.
+//---------------------------------------------------------
+
+class SlurCollisionEnvelope
+{
+public:
+    SlurCollisionEnvelope(const std::vector<Shape>& shapes, bool up);
+
+    //! NOTE Same result as testing the rect against each of the gathered shapes
+    //! with Shape::clearsVertically(), without creating a shape per rect
+    bool intersects(const muse::RectF& rect) const;
+
+private:
+    struct Element {
+        double minX = 0.0;
+        double left = 0.0;
+        double right = 0.0;
+        double y = 0.0;
+    };
+
+    std::vector<Element> m_elements;
+    double m_maxWidth = 0.0;
+    bool m_up = false;
+};
+}
+
+#endif // MU_ENGRAVING_SLURCOLLISIONENVELOPE_DEV_H
@@ -21,6 +21,8 @@
  */
 #include "slurtielayout.h"
 
+#include <algorithm>
+
 #include "iengravingfont.h"
 
 #include "compat/dummyelement.h"
@@ -45,6 +47,8 @@
 #include "tlayout.h"
 #include "chordlayout.h"
 #include "tremololayout.h"
+#include "layoutprofiler.h"
+#include "slurcollisionenvelope.h"
 #include "../engraving/types/symnames.h"
 
 #include "draw/types/transform.h"
@@ -872,6 +876,7 @@ void SlurTieLayout::avoidCollisions(SlurSegment* slurSeg, PointF& pp1, PointF& p
                                     Transform& toSystemCoordinates, double& slurAngle)
 {
     TRACEFUNC;
+    LAYOUT_PROFILE("slur", "avoid collisions");
     Slur* slur = slurSeg->slur();
     ChordRest* startCR = slur->startCR();
     ChordRest* endCR = slur->endCR();
@@ -924,6 +929,7 @@ void SlurTieLayout::avoidCollisions(SlurSegment* slurSeg, PointF& pp1, PointF& p
     if (segShapes.empty()) {
         return;
     }
+    const SlurCollisionEnvelope envelope(segShapes, slur->up());
 
     // Collision clearance at the center of the slur
     double spatium = slurSeg->spatium();
@@ -974,6 +980,7 @@ void SlurTieLayout::avoidCollisions(SlurSegment* slurSeg, PointF& pp1, PointF& p
     }
     // Divide slur in several rectangles to localize collisions
     const unsigned npoints = 20;
+    std::vector<PointF> slurPoints(npoints);
     std::vector<RectF> slurRects;
     slurRects.reserve(npoints);
 
@@ -1004,36 +1011,32 @@ void SlurTieLayout::avoidCollisions(SlurSegment* slurSeg, PointF& pp1, PointF& p
         // Create rectangles
         slurRects.clear();
         CubicBezier clearanceBezier(PointF(0, 0), p3 + PointF(0.0, vertClearance), p4 + PointF(0.0, vertClearance), p2);
+        // Each sample point is shared by two neighbouring rectangles
+        for (unsigned i = 0; i < npoints; i++) {
+            slurPoints[i] = toSystemCoordinates.map(clearanceBezier.pointAtPercent(double(i) / double(npoints)));
+        }
         for (unsigned i = 0; i < npoints - 1; i++) {
-            PointF clearancePoint1 = clearanceBezier.pointAtPercent(double(i) / double(npoints));
-            PointF clearancePoint2 = clearanceBezier.pointAtPercent(double(i + 1) / double(npoints));
-            clearancePoint1 = toSystemCoordinates.map(clearancePoint1);
-            clearancePoint2 = toSystemCoordinates.map(clearancePoint2);
-            slurRects.push_back(RectF(clearancePoint1, clearancePoint2));
+            slurRects.push_back(RectF(slurPoints[i], slurPoints[i + 1]));
         }
         // Check collisions
-        for (Shape& segShape : segShapes) {
-            for (unsigned i=0; i < slurRects.size(); i++) {
-                bool leftSection = i < slurRects.size() / 3;
-                bool midSection = i >= slurRects.size() / 3 && i < 2 * slurRects.size() / 3;
-                bool rightSection = i >= 2 * slurRects.size() / 3;
-                if ((leftSection && collision.left)
-                    || (midSection && collision.mid)
-                    || (rightSection && collision.right)) {     // If a collision is already found in this section, no need to check again
-                    continue;
+        for (unsigned i=0; i < slurRects.size(); i++) {
+            bool leftSection = i < slurRects.size() / 3;
+            bool midSection = i >= slurRects.size() / 3 && i < 2 * slurRects.size() / 3;
+            bool rightSection = i >= 2 * slurRects.size() / 3;
+            if ((leftSection && collision.left)
+                || (midSection && collision.mid)
+                || (rightSection && collision.right)) {     // If a collision is already found in this section, no need to check again
+                continue;
+            }
+            if (envelope.intersects(slurRects[i])) {
+                if (leftSection) {
+                    collision.left = true;
                 }
-                bool intersection = slur->up() ? !Shape(slurRects[i]).clearsVertically(segShape)
-                                    : !segShape.clearsVertically(slurRects[i]);
-                if (intersection) {
-                    if (leftSection) {
-                        collision.left = true;
-                    }
-                    if (midSection) {
-                        collision.mid = true;
-                    }
-                    if (rightSection) {
-                        collision.right = true;
-                    }
+                if (midSection) {
+                    collision.mid = true;
+                }
+                if (rightSection) {
+                    collision.right = true;
                 }
             }
         }
@@ -1105,6 +1108,8 @@ void SlurTieLayout::avoidCollisions(SlurSegment* slurSeg, PointF& pp1, PointF& p
 
         ++iter;
     } while ((collision.left || collision.mid || collision.right) && iter < maxIter);
+
+    LAYOUT_PROFILE_SET_ARG("iterations", iter);
 }
 
 Shape SlurTieLayout::getSegmentShape(SlurSegment* slurSeg, Segment* seg, ChordRest* startCR, ChordRest* endCR)
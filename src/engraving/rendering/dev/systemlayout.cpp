@@ -72,6 +72,7 @@
 #include "tupletlayout.h"
 #include "slurtielayout.h"
 #include "horizontalspacing.h"
+#include "layoutprofiler.h"
 
 #include "log.h"
 
@@ -85,6 +86,7 @@ using namespace mu::engraving::rendering::dev;
 System* SystemLayout::collectSystem(LayoutContext& ctx)
 {
     TRACEFUNC;
+    LAYOUT_PROFILE_ARG("pass", "system", static_cast<int64_t>(ctx.dom().systems().size()));
 
     if (!ctx.state().curMeasure()) {
         return nullptr;
@@ -378,7 +380,8 @@ System* SystemLayout::collectSystem(LayoutContext& ctx)
     if (ctx.state().endTick() < ctx.state().prevMeasure()->tick()) {
         // we've processed the entire range
         // but we need to continue layout until we reach a system whose last measure is the same as previous layout
-        if (ctx.state().prevMeasure() == ctx.state().systemOldMeasure()) {
+        // or, if the line breaks have moved, until the next measure starts one of the old systems
+        if (ctx.state().prevMeasure() == ctx.state().systemOldMeasure() || skipAbsorbedSystems(ctx)) {
             // this system ends in the same place as the previous layout
             // ok to stop
             if (ctx.state().curMeasure() && ctx.state().curMeasure()->isMeasure()) {
@@ -587,7 +590,7 @@ System* SystemLayout::getNextSystem(LayoutContext& ctx)
 {
     bool isVBox = ctx.state().curMeasure()->isVBox();
     System* system = nullptr;
-    if (ctx.state().systemList().empty()) {
+    if (ctx.state().systemList().empty() || keepOldSystem(ctx)) {
         system = Factory::createSystem(ctx.mutDom().dummyParent()->page());
         ctx.mutState().setSystemOldMeasure(nullptr);
     } else {
@@ -606,6 +609,65 @@ System* SystemLayout::getNextSystem(LayoutContext& ctx)
     return system;
 }
 
+//---------------------------------------------------------
+//   keepOldSystem
+//    After an edit that adds a system, the next old system starts
+//    after the current measure. Taking it would clear it, and the
+//    line breaks could not re-converge with it in skipAbsorbedSystems.
+//---------------------------------------------------------
+
+bool SystemLayout::keepOldSystem(const LayoutContext& ctx)
+{
+    const MeasureBase* cur = ctx.state().curMeasure();
+    if (!cur->isMeasure()) {
+        return false;
+    }
+
+    const System* oldSystem = ctx.state().systemList().front();
+    if (oldSystem->measures().empty()) {
+        return false;
+    }
+
+    const MeasureBase* first = oldSystem->measures().front();
+    return first->isMeasure() && first->system() == oldSystem && first->tick() > cur->tick();
+}
+
+//---------------------------------------------------------
+//   skipAbsorbedSystems
+//    The line breaks after an edit often re-converge with the previous
+//    layout only after one system was added or absorbed, so that the
+//    old system at the current position never ends in the same place.
+//    If the next measure starts one of the old systems, the old systems
+//    before it are not needed anymore and the following ones can be taken
+//    unchanged (the header and trailer state of the next measure is
+//    restored by the caller).
+//---------------------------------------------------------
+
+bool SystemLayout::skipAbsorbedSystems(LayoutContext& ctx)
+{
+    MeasureBase* next = ctx.mutState().curMeasure();
+    if (!next || !next->isMeasure()) {
+        return false;
+    }
+
+    System* oldSystem = next->system();
+    if (!oldSystem || oldSystem->measures().empty() || oldSystem->measures().front() != next) {
+        return false;
+    }
+
+    std::vector<System*>& systems = ctx.mutState().systemList();
+    auto it = std::find(systems.begin(), systems.end(), oldSystem);
+    if (it == systems.end()) {
+        return false;
+    }
+
+    std::vector<System*>& absorbed = ctx.mutState().absorbedSystems();
+    absorbed.insert(absorbed.end(), systems.begin(), it);
+    systems.erase(systems.begin(), it);
+
+    return true;
+}
+
 void SystemLayout::hideEmptyStaves(System* system, LayoutContext& ctx, bool isFirstSystem)
 {
     size_t staves = ctx.dom().nstaves();
@@ -743,6 +805,10 @@ void SystemLayout::layoutSystemElements(System* system, LayoutContext& ctx)
             continue;
         }
         Measure* m = toMeasure(mb);
+        // in continuous view, the measures far from the viewport are laid out when scrolled into view
+        if (ctx.conf().isLinearMode() && m->isWidthEstimated()) {
+            continue;
+        }
         MeasureLayout::layoutMeasureNumber(m, ctx);
         MeasureLayout::layoutMMRestRange(m, ctx);
         MeasureLayout::layoutTimeTickAnchors(m, ctx);
@@ -914,9 +980,15 @@ void SystemLayout::layoutSystemElements(System* system, LayoutContext& ctx)
     // layout ties and guitar bends
     //-------------------------------------------------------------
 
-    bool useRange = false;    // TODO: lineMode();
-    Fraction stick = useRange ? ctx.state().startTick() : system->measures().front()->tick();
-    Fraction etick = useRange ? ctx.state().endTick() : system->measures().back()->endTick();
+    // in continuous view with a viewport, the measures out of range may only have an estimated width
+    bool useRange = ctx.conf().isLinearMode() && ctx.conf().hasViewport();
+    Fraction stick = system->measures().front()->tick();
+    Fraction etick = system->measures().back()->endTick();
+    if (useRange) {
+        const Measure* last = ctx.dom().tick2measure(ctx.state().endTick());
+        stick = std::max(stick, ctx.state().startTick());
+        etick = last ? std::min(etick, last->endTick()) : etick;
+    }
     auto spanners = ctx.dom().spannerMap().findOverlapping(stick.ticks(), etick.ticks());
 
     // ties
@@ -1398,6 +1470,9 @@ void SystemLayout::doLayoutTiesLinear(System* system, LayoutContext& ctx)
 {
     constexpr Fraction start = Fraction(0, 1);
     for (Measure* measure = system->firstMeasure(); measure; measure = measure->nextMeasure()) {
+        if (measure->isWidthEstimated()) {
+            continue;
+        }
         for (Segment* segment = measure->first(); segment; segment = segment->next()) {
             if (!segment->isChordRestType()) {
                 continue;
@@ -1459,6 +1534,8 @@ void SystemLayout::layoutGuitarBends(const std::vector<Segment*>& sl, LayoutCont
 
 void SystemLayout::processLines(System* system, LayoutContext& ctx, std::vector<Spanner*> lines, bool align)
 {
+    LAYOUT_PROFILE("pass", "spanners");
+
     std::vector<SpannerSegment*> segments;
     for (Spanner* sp : lines) {
         SpannerSegment* ss = TLayout::layoutSystem(sp, system, ctx);        // create/layout spanner segment for this system
@@ -65,6 +65,8 @@ public:
 
 private:
     static System* getNextSystem(LayoutContext& lc);
+    static bool keepOldSystem(const LayoutContext& ctx);
+    static bool skipAbsorbedSystems(LayoutContext& ctx);
     static void processLines(System* system, LayoutContext& ctx, std::vector<Spanner*> lines, bool align);
     static void layoutTies(Chord* ch, System* system, const Fraction& stick, LayoutContext& ctx);
     static void doLayoutTies(System* system, std::vector<Segment*> sl, const Fraction& stick, const Fraction& etick, LayoutContext& ctx);
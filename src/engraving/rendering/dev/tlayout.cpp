@@ -162,6 +162,7 @@
 #include "tremololayout.h"
 #include "tupletlayout.h"
 #include "horizontalspacing.h"
+#include "layoutprofiler.h"
 
 using namespace muse;
 using namespace muse::draw;
@@ -173,6 +174,8 @@ using namespace mu::engraving::rendering::dev;
 
 void TLayout::layoutItem(EngravingItem* item, LayoutContext& ctx)
 {
+    LAYOUT_PROFILE_LAZY("item", TConv::toXml(item->type()).ascii());
+
     //DO_ASSERT(!ctx.conf().isPaletteMode());
 
     EngravingItem::LayoutData* ldata = item->mutldata();
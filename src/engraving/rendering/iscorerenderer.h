@@ -23,6 +23,7 @@
 #define MU_ENGRAVING_ISCORERENDERER_H
 
 #include <variant>
+#include <vector>
 
 #include "modularity/imoduleinterface.h"
 #include "draw/types/geometry.h"
@@ -111,6 +112,13 @@ public:
         int copyCount = 1;
         int trimMarginPixelSize = -1;
         int deviceDpi = -1;
+        bool useDisplayLists = true; // replay the recorded paint commands of the pages
+
+        //! NOTE Level of detail, as the size of one spatium on the device (in device pixels):
+        //! below simplifiedSpatiumSize the items are painted as simplified shapes,
+        //! below staffLinesOnlySpatiumSize only the staff lines are painted; 0 disables
+        double simplifiedSpatiumSize = 0.0;
+        double staffLinesOnlySpatiumSize = 0.0;
 
         std::function<void(muse::draw::Painter* painter, const Page* page, const RectF& pageRect)> onPaintPageSheet;
         std::function<void()> onNewPage;
@@ -120,6 +128,7 @@ public:
     virtual SizeF pageSizeInch(const Score* score, const PaintOptions& opt) const = 0;
     virtual void paintScore(muse::draw::Painter* painter, Score* score, const IScoreRenderer::PaintOptions& opt) const = 0;
     virtual void paintItem(muse::draw::Painter& painter, const EngravingItem* item) const = 0;
+    virtual void paintItems(muse::draw::Painter& painter, const std::vector<EngravingItem*>& items) const = 0;
 
     // Temporary compatibility interface
     using Supported = std::variant<std::monostate,
@@ -41,9 +41,25 @@ struct LayoutOptions
 
     bool isShowVBox = true;
     double noteHeadWidth = 0.0;
+    size_t maxPages = 0; // page view: stop the layout after this many pages, 0 - no limit (see Score::layoutNextPages)
+
+    // continuous view: the visible horizontal range of the canvas, 0 width - no viewport (see Score::setLayoutViewport)
+    double viewportX = 0.0;
+    double viewportWidth = 0.0;
+
+    // lay out the chords of independent staves on the task scheduler threads (see MeasureLayout::layoutStavesChords)
+    bool isParallelLayout = false;
+
+    // reuse the measure widths computed earlier in the same layout (see MeasureWidthCache), off only to compare with
+    bool isMeasureWidthCacheEnabled = true;
 
     bool isMode(LayoutMode m) const { return mode == m; }
     bool isLinearMode() const { return mode == LayoutMode::LINE || mode == LayoutMode::HORIZONTAL_FIXED; }
+
+    // the measures in this range are laid out completely: the viewport and its width on both sides
+    bool hasViewport() const { return viewportWidth > 0.0; }
+    double viewportLayoutLeft() const { return viewportX - viewportWidth; }
+    double viewportLayoutRight() const { return viewportX + 2 * viewportWidth; }
 };
 }
 
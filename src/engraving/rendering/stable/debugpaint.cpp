@@ -266,7 +266,6 @@ void DebugPaint::paintTreeElement(Painter& painter, const EngravingItem* item)
 //    if (item->ldata()->isSkipDraw()) {
 //        return;
 //    }
-    item->itemDiscovered = false;
     PointF itemPosition(item->pagePos());
 
     painter.translate(itemPosition);
@@ -42,10 +42,19 @@ public:
     static void paintItem(muse::draw::Painter& painter, const EngravingItem* item);
     static void paintItems(muse::draw::Painter& painter, const std::vector<EngravingItem*>& items);
 
+    enum class DetailLevel {
+        Full,
+        Simplified,     // glyphs as filled rects, text as bars
+        StaffLinesOnly
+    };
+
+    static void paintItemsSimplified(muse::draw::Painter& painter, const std::vector<EngravingItem*>& items, DetailLevel level);
+
     static SizeF pageSizeInch(const Score* score);
     static SizeF pageSizeInch(const Score* score, const IScoreRenderer::PaintOptions& opt);
 
 private:
+    static DetailLevel detailLevel(const muse::draw::Painter* painter, const Score* score, const IScoreRenderer::PaintOptions& opt);
 };
 }
 
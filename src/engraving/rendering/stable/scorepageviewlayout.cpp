@@ -232,7 +232,7 @@ void ScorePageViewLayout::layoutFinished(Score* score, LayoutContext& ctx)
     } else {
         Page* p = state.curSystem()->page();
         if (p && (p != state.page())) {
-            p->invalidateBspTree();
+            p->invalidateSpatialIndex();
         }
     }
 
@@ -0,0 +1,210 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dom/excerpt.h"
+#include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/page.h"
+#include "dom/part.h"
+#include "dom/segment.h"
+#include "dom/system.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String PARTS_DATA_DIR("parts_data/");
+
+//---------------------------------------------------------
+//   DeferredLayoutTests
+//    A part whose layout is deferred is not laid out by the edits,
+//    it is laid out from the start once its pages are needed.
+//---------------------------------------------------------
+
+class Engraving_DeferredLayoutTests : public ::testing::Test
+{
+public:
+    //! NOTE A master score with an open part of its first instrument, both laid out
+    static MasterScore* createScoreWithPart()
+    {
+        MasterScore* score = ScoreRW::readScore(PARTS_DATA_DIR + u"part-all.mscx");
+        EXPECT_TRUE(score);
+        if (!score) {
+            return nullptr;
+        }
+
+        Score* nscore = score->createScore();
+        Excerpt* ex = new Excerpt(score);
+        ex->setExcerptScore(nscore);
+        ex->setParts({ score->parts().at(0) });
+        ex->setName(score->parts().at(0)->partName());
+        Excerpt::createExcerpt(ex);
+        score->excerpts().push_back(ex);
+        score->setExcerptsChanged(true);
+
+        // edits lay out the open parts only
+        nscore->setIsOpen(true);
+
+        score->doLayout();
+        nscore->doLayout();
+
+        return score;
+    }
+
+    static Score* part(MasterScore* score)
+    {
+        return score->excerpts().front()->excerptScore();
+    }
+
+    //! NOTE Where the systems start and how their measures are spaced
+    static std::vector<double> layoutValues(const Score* score)
+    {
+        std::vector<double> values;
+        for (const Page* page : score->pages()) {
+            values.push_back(static_cast<double>(page->systems().size()));
+            for (const System* system : page->systems()) {
+                values.push_back(system->measures().front()->tick().toDouble());
+                values.push_back(system->y());
+            }
+        }
+
+        for (const Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+            values.push_back(m->x());
+            values.push_back(m->width());
+            for (const Segment* s = m->first(); s; s = s->next()) {
+                values.push_back(s->x());
+                values.push_back(s->width());
+            }
+        }
+        return values;
+    }
+
+    //! NOTE Adds measures to the master score, the part gets them through the undo stack
+    static void appendMeasures(MasterScore* score, int count)
+    {
+        score->startCmd();
+        score->appendMeasures(count);
+        score->endCmd();
+    }
+
+    static void expectSkippedByEdit(MasterScore* score)
+    {
+        Score* partScore = part(score);
+        const size_t measures = partScore->nmeasures();
+
+        // [WHEN] The master score is edited while the part is deferred
+        appendMeasures(score, 8);
+
+        // [THEN] The part has the new measures, but they are not laid out
+        EXPECT_EQ(partScore->nmeasures(), measures + 8);
+        EXPECT_TRUE(partScore->isLayoutDeferred());
+        EXPECT_FALSE(partScore->isLayoutComplete());
+        EXPECT_FALSE(partScore->lastMeasure()->system());
+    }
+};
+
+TEST_F(Engraving_DeferredLayoutTests, editsLayOutOpenPart)
+{
+    MasterScore* score = createScoreWithPart();
+    ASSERT_TRUE(score);
+
+    // [WHEN] The master score is edited
+    appendMeasures(score, 8);
+
+    // [THEN] The open part is laid out with it
+    EXPECT_TRUE(part(score)->lastMeasure()->system());
+
+    delete score;
+}
+
+TEST_F(Engraving_DeferredLayoutTests, editsSkipDeferredPart)
+{
+    MasterScore* score = createScoreWithPart();
+    ASSERT_TRUE(score);
+
+    // [GIVEN] The layout of the part is deferred
+    part(score)->setLayoutDeferred(true);
+
+    // [THEN] Edits don't lay it out
+    expectSkippedByEdit(score);
+
+    // [THEN] The master score is laid out
+    EXPECT_TRUE(score->lastMeasure()->system());
+
+    delete score;
+}
+
+TEST_F(Engraving_DeferredLayoutTests, ensureLayoutCompleteLaysOutFromStart)
+{
+    MasterScore* score = createScoreWithPart();
+    ASSERT_TRUE(score);
+
+    Score* partScore = part(score);
+    partScore->setLayoutDeferred(true);
+    expectSkippedByEdit(score);
+
+    // [WHEN] The pages of the part are needed
+    partScore->ensureLayoutComplete();
+
+    // [THEN] It is laid out completely
+    EXPECT_FALSE(partScore->isLayoutDeferred());
+    EXPECT_TRUE(partScore->isLayoutComplete());
+    EXPECT_TRUE(partScore->lastMeasure()->system());
+
+    // [THEN] As an eager layout would do
+    const std::vector<double> deferred = layoutValues(partScore);
+    partScore->doLayout();
+    EXPECT_EQ(deferred, layoutValues(partScore));
+
+    delete score;
+}
+
+TEST_F(Engraving_DeferredLayoutTests, rangedLayoutLaysOutFromStart)
+{
+    MasterScore* score = createScoreWithPart();
+    ASSERT_TRUE(score);
+
+    Score* partScore = part(score);
+    partScore->setLayoutDeferred(true);
+    expectSkippedByEdit(score);
+
+    // [WHEN] Only the last measure of the part is laid out
+    const Measure* last = partScore->lastMeasure();
+    partScore->doLayoutRange(last->tick(), last->endTick());
+
+    // [THEN] The whole part is laid out, the measures edited while deferred too
+    EXPECT_FALSE(partScore->isLayoutDeferred());
+    EXPECT_TRUE(partScore->isLayoutComplete());
+    for (const Measure* m = partScore->firstMeasure(); m; m = m->nextMeasure()) {
+        EXPECT_TRUE(m->system());
+    }
+
+    // [THEN] As an eager layout would do
+    const std::vector<double> deferred = layoutValues(partScore);
+    partScore->doLayout();
+    EXPECT_EQ(deferred, layoutValues(partScore));
+
+    delete score;
+}
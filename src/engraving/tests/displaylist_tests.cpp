@@ -0,0 +1,302 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+
+#include "draw/bufferedpaintprovider.h"
+#include "draw/painter.h"
+
+#include "dom/chord.h"
+#include "dom/displaylist.h"
+#include "dom/measure.h"
+#include "dom/note.h"
+#include "dom/page.h"
+#include "dom/segment.h"
+#include "dom/system.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace muse::draw;
+
+static const String DISPLAYLIST_DATA_DIR(u"all_elements_data/");
+
+class Engraving_DisplayListTests : public ::testing::Test
+{
+public:
+    // Paints one rect per item and counts the painted items
+    PageDisplayList::PaintItems countingPaintItems()
+    {
+        return [this](Painter& painter, const std::vector<EngravingItem*>& items) {
+            for (const EngravingItem* item : items) {
+                painter.drawRect(RectF(item->pagePos(), SizeF(1.0, 1.0)));
+            }
+            m_paintedItems += items.size();
+        };
+    }
+
+    static size_t pathCount(const DrawData::Item& item)
+    {
+        size_t count = 0;
+        for (const DrawData::Data& data : item.datas) {
+            count += data.paths.size() + data.polygons.size();
+        }
+
+        for (const DrawData::Item& child : item.chilren) {
+            count += pathCount(child);
+        }
+
+        return count;
+    }
+
+    static size_t replayedCount(const PageDisplayList& displayList, const RectF& rect)
+    {
+        std::shared_ptr<BufferedPaintProvider> provider = std::make_shared<BufferedPaintProvider>();
+        {
+            Painter painter(provider, "test");
+            displayList.paint(painter, rect);
+        }
+
+        return pathCount(provider->drawData()->item);
+    }
+
+    // Paints the paint order of each item as text
+    static PageDisplayList::PaintItems zOrderPaintItems()
+    {
+        return [](Painter& painter, const std::vector<EngravingItem*>& items) {
+            for (const EngravingItem* item : items) {
+                painter.drawText(PointF(), String::number(item->z()));
+            }
+        };
+    }
+
+    static void collectTexts(const DrawData::Item& item, std::vector<int>& values)
+    {
+        for (const DrawData::Data& data : item.datas) {
+            for (const DrawText& text : data.texts) {
+                values.push_back(text.text.toInt());
+            }
+        }
+
+        for (const DrawData::Item& child : item.chilren) {
+            collectTexts(child, values);
+        }
+    }
+
+    size_t m_paintedItems = 0;
+};
+
+/**
+ * @brief Engraving_DisplayListTests_ReplayMatchesRecording
+ * @details Check that a display list replays everything that was recorded, and is not recorded again while valid
+ */
+TEST_F(Engraving_DisplayListTests, ReplayMatchesRecording)
+{
+    Score* score = ScoreRW::readScore(DISPLAYLIST_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = score->pages().front();
+    PageDisplayList& displayList = page->displayList();
+
+    // [WHEN] The display list is recorded
+    displayList.update(page, countingPaintItems());
+    const size_t recordedItems = m_paintedItems;
+    EXPECT_GT(recordedItems, page->systems().size());
+
+    // [THEN] Replaying the whole page paints every recorded item
+    EXPECT_EQ(replayedCount(displayList, page->pageBoundingRect()), recordedItems);
+
+    // [WHEN] The display list is updated again without changes
+    displayList.update(page, countingPaintItems());
+
+    // [THEN] Nothing is recorded again
+    EXPECT_EQ(m_paintedItems, recordedItems);
+
+    delete score;
+}
+
+/**
+ * @brief Engraving_DisplayListTests_InvalidateSystem
+ * @details Check that invalidating a system records only that system again
+ */
+TEST_F(Engraving_DisplayListTests, InvalidateSystem)
+{
+    Score* score = ScoreRW::readScore(DISPLAYLIST_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = score->pages().front();
+    ASSERT_GT(page->systems().size(), 1u);
+    PageDisplayList& displayList = page->displayList();
+
+    displayList.update(page, countingPaintItems());
+    const size_t recordedItems = m_paintedItems;
+    const size_t replayedItems = replayedCount(displayList, page->pageBoundingRect());
+
+    // [WHEN] One system is invalidated
+    m_paintedItems = 0;
+    displayList.invalidate(page->systems().front());
+    displayList.update(page, countingPaintItems());
+
+    // [THEN] Only its items are recorded again, and the page replays the same
+    EXPECT_GT(m_paintedItems, 0u);
+    EXPECT_LT(m_paintedItems, recordedItems);
+    EXPECT_EQ(replayedCount(displayList, page->pageBoundingRect()), replayedItems);
+
+    // [WHEN] The page is invalidated
+    m_paintedItems = 0;
+    page->invalidateSpatialIndex();
+    displayList.update(page, countingPaintItems());
+
+    // [THEN] Everything is recorded again
+    EXPECT_EQ(m_paintedItems, recordedItems);
+
+    delete score;
+}
+
+/**
+ * @brief Engraving_DisplayListTests_PaintOrderOfPage
+ * @details Check that the items of all the systems are replayed in the paint order of the whole page
+ */
+TEST_F(Engraving_DisplayListTests, PaintOrderOfPage)
+{
+    Score* score = ScoreRW::readScore(DISPLAYLIST_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = score->pages().front();
+    ASSERT_GT(page->systems().size(), 1u);
+    PageDisplayList& displayList = page->displayList();
+
+    // [WHEN] The page is recorded and replayed
+    displayList.update(page, zOrderPaintItems());
+
+    std::shared_ptr<BufferedPaintProvider> provider = std::make_shared<BufferedPaintProvider>();
+    {
+        Painter painter(provider, "test");
+        displayList.paint(painter, page->pageBoundingRect());
+    }
+
+    std::vector<int> zValues;
+    collectTexts(provider->drawData()->item, zValues);
+
+    // [THEN] Nothing of a lower layer is painted over a higher one, even from another system
+    EXPECT_GT(zValues.size(), page->systems().size());
+    EXPECT_TRUE(std::is_sorted(zValues.begin(), zValues.end()));
+
+    delete score;
+}
+
+/**
+ * @brief Engraving_DisplayListTests_InvalidateHighlightedSystem
+ * @details Check that highlighting a note as a drop target or marking it records its system again
+ */
+TEST_F(Engraving_DisplayListTests, InvalidateHighlightedSystem)
+{
+    Score* score = ScoreRW::readScore(DISPLAYLIST_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = score->pages().front();
+    PageDisplayList& displayList = page->displayList();
+
+    const Segment* segment = score->firstMeasure()->first(SegmentType::ChordRest);
+    const Chord* chord = nullptr;
+    for (const EngravingItem* item : segment->elist()) {
+        if (item && item->isChord()) {
+            chord = toChord(item);
+            break;
+        }
+    }
+    ASSERT_TRUE(chord);
+    const Note* note = chord->notes().front();
+
+    displayList.update(page, countingPaintItems());
+
+    // [WHEN] The note becomes a drop target
+    m_paintedItems = 0;
+    note->setDropTarget(true);
+    displayList.update(page, countingPaintItems());
+
+    // [THEN] Its system is recorded again
+    EXPECT_GT(m_paintedItems, 0u);
+
+    // [WHEN] The note is marked
+    m_paintedItems = 0;
+    note->setMark(true);
+    displayList.update(page, countingPaintItems());
+
+    // [THEN] Its system is recorded again
+    EXPECT_GT(m_paintedItems, 0u);
+
+    // [WHEN] The note is marked again
+    m_paintedItems = 0;
+    note->setMark(true);
+    displayList.update(page, countingPaintItems());
+
+    // [THEN] Nothing has changed
+    EXPECT_EQ(m_paintedItems, 0u);
+
+    delete score;
+}
+
+/**
+ * @brief Engraving_DisplayListTests_ShowSettingsRecordAgain
+ * @details Check that the display settings the items are painted with re-record the display list
+ */
+TEST_F(Engraving_DisplayListTests, ShowSettingsRecordAgain)
+{
+    Score* score = ScoreRW::readScore(DISPLAYLIST_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = score->pages().front();
+    PageDisplayList& displayList = page->displayList();
+    displayList.update(page, countingPaintItems());
+
+    const std::vector<std::function<void(bool)> > setters = {
+        [score](bool v) { score->setShowInvisible(v); },
+        [score](bool v) { score->setShowUnprintable(v); },
+        [score](bool v) { score->setShowFrames(v); },
+        [score](bool v) { score->setMarkIrregularMeasures(v); },
+    };
+
+    for (const std::function<void(bool)>& set : setters) {
+        // [WHEN] The setting is switched off
+        m_paintedItems = 0;
+        set(false);
+        displayList.update(page, countingPaintItems());
+
+        // [THEN] The page is recorded again
+        EXPECT_GT(m_paintedItems, 0u);
+
+        // [WHEN] It is switched on again
+        m_paintedItems = 0;
+        set(true);
+        displayList.update(page, countingPaintItems());
+
+        // [THEN] The page is recorded again
+        EXPECT_GT(m_paintedItems, 0u);
+    }
+
+    delete score;
+}
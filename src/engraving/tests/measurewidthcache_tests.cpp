@@ -0,0 +1,100 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/page.h"
+#include "dom/segment.h"
+#include "dom/system.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String MEASUREWIDTHCACHE_DATA_DIR(u"all_elements_data/");
+
+//---------------------------------------------------------
+//   MeasureWidthCacheTests
+//    The widths restored from the cache, while the systems are fitted
+//    and squeezed, must be the ones the measures are spaced with.
+//---------------------------------------------------------
+
+class Engraving_MeasureWidthCacheTests : public ::testing::Test
+{
+public:
+    //! NOTE Where the systems start and how their measures are spaced
+    static std::vector<double> spacing(const Score* score)
+    {
+        std::vector<double> values;
+        for (const System* system : score->systems()) {
+            values.push_back(system->measures().front()->tick().toDouble());
+        }
+
+        for (const Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+            values.push_back(m->x());
+            values.push_back(m->width());
+            for (const Segment* s = m->first(); s; s = s->next()) {
+                values.push_back(s->x());
+                values.push_back(s->width());
+                values.push_back(s->widthOffset());
+                values.push_back(s->stretch());
+            }
+        }
+        return values;
+    }
+
+    static void compareWithoutCache(const String& fileName, double measureSpacing)
+    {
+        MasterScore* score = ScoreRW::readScore(MEASUREWIDTHCACHE_DATA_DIR + fileName);
+        ASSERT_TRUE(score);
+
+        //! NOTE A wider spacing leaves more systems to squeeze
+        score->style().set(Sid::measureSpacing, measureSpacing);
+
+        score->setMeasureWidthCacheEnabled(true);
+        score->doLayout();
+        const std::vector<double> cached = spacing(score);
+
+        score->setMeasureWidthCacheEnabled(false);
+        score->doLayout();
+        const std::vector<double> computed = spacing(score);
+
+        ASSERT_EQ(cached.size(), computed.size()) << fileName.toStdString() << ", measure spacing " << measureSpacing;
+        for (size_t i = 0; i < cached.size(); ++i) {
+            EXPECT_DOUBLE_EQ(cached[i], computed[i]) << fileName.toStdString() << ", measure spacing " << measureSpacing
+                                                     << ", value " << i;
+        }
+
+        delete score;
+    }
+};
+
+TEST_F(Engraving_MeasureWidthCacheTests, sameSpacingWithoutCache)
+{
+    for (double measureSpacing : { 1.2, 1.6, 2.5 }) {
+        compareWithoutCache(u"moonlight.mscx", measureSpacing);
+        compareWithoutCache(u"layout_elements.mscx", measureSpacing);
+    }
+}
@@ -0,0 +1,139 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "global/concurrency/taskscheduler.h"
+
+#include "realfn.h"
+
+#include "dom/accidental.h"
+#include "dom/chord.h"
+#include "dom/ledgerline.h"
+#include "dom/masterscore.h"
+#include "dom/note.h"
+#include "dom/notedot.h"
+#include "dom/rest.h"
+#include "dom/segment.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String PARALLELLAYOUT_DATA_DIR("parallellayout_data/");
+
+//---------------------------------------------------------
+//   ParallelLayoutTests
+//    The chords of independent staves laid out on the task scheduler
+//    threads must end up exactly where the serial layout puts them.
+//---------------------------------------------------------
+
+class Engraving_ParallelLayoutTests : public ::testing::Test
+{
+public:
+    //! NOTE Positions of the noteheads, accidentals, dots, ledger lines and rests, in score order
+    static std::vector<double> chordsGeometry(const Score* score)
+    {
+        std::vector<double> values;
+        auto addItem = [&values](const EngravingItem* item) {
+            PointF pos = item->pagePos();
+            values.push_back(pos.x());
+            values.push_back(pos.y());
+            values.push_back(item->width());
+        };
+
+        for (const Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+            for (const EngravingItem* e : s->elist()) {
+                if (!e) {
+                    continue;
+                }
+
+                if (e->isRest()) {
+                    addItem(e);
+                    continue;
+                }
+
+                const Chord* chord = toChord(e);
+                addItem(chord);
+                for (const Note* note : chord->notes()) {
+                    addItem(note);
+                    if (note->accidental()) {
+                        addItem(note->accidental());
+                    }
+                    for (const NoteDot* dot : note->dots()) {
+                        addItem(dot);
+                    }
+                }
+
+                size_t ledgerLines = 0;
+                for (const LedgerLine* l = chord->ledgerLines(); l; l = l->next()) {
+                    addItem(l);
+                    ++ledgerLines;
+                }
+                values.push_back(static_cast<double>(ledgerLines));
+            }
+        }
+
+        return values;
+    }
+
+    static void expectSameGeometry(const std::vector<double>& serial, const std::vector<double>& parallel)
+    {
+        ASSERT_EQ(serial.size(), parallel.size());
+        for (size_t i = 0; i < serial.size(); ++i) {
+            EXPECT_TRUE(muse::RealIsEqual(serial.at(i), parallel.at(i))) << "value " << i;
+        }
+    }
+};
+
+TEST_F(Engraving_ParallelLayoutTests, sameAsSerialLayout)
+{
+    if (muse::TaskScheduler::instance()->threadPoolSize() == 0) {
+        GTEST_SKIP() << "no task scheduler threads";
+    }
+
+    // [GIVEN] Ten single staff parts with two voices, seconds, dots, accidentals, ledger lines and rests
+    MasterScore* score = ScoreRW::readScore(PARALLELLAYOUT_DATA_DIR + u"parallellayout.mscx");
+    ASSERT_TRUE(score);
+
+    // [WHEN] The score is laid out serially and then in parallel
+    score->setParallelLayout(false);
+    score->doLayout();
+    std::vector<double> serial = chordsGeometry(score);
+    EXPECT_FALSE(serial.empty());
+
+    score->setParallelLayout(true);
+    score->doLayout();
+    std::vector<double> parallel = chordsGeometry(score);
+
+    // [THEN] Both layouts are the same
+    expectSameGeometry(serial, parallel);
+
+    // [WHEN] It is laid out in parallel again, replacing the ledger lines created by the previous layout
+    score->doLayout();
+
+    // [THEN] It is still the same
+    expectSameGeometry(serial, chordsGeometry(score));
+
+    delete score;
+}
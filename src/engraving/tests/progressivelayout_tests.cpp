@@ -0,0 +1,175 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/page.h"
+#include "dom/system.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+//---------------------------------------------------------
+//   ProgressiveLayoutTests
+//    In page view, the layout can stop after the first pages
+//    and be continued later, page by page.
+//---------------------------------------------------------
+
+static constexpr int MEASURE_COUNT = 600;
+
+class Engraving_ProgressiveLayoutTests : public ::testing::Test
+{
+public:
+    struct SystemStart {
+        Fraction tick;
+        page_idx_t page = 0;
+
+        bool operator==(const SystemStart& other) const { return tick == other.tick && page == other.page; }
+    };
+
+    //! NOTE Lays out the whole score, so that the tests can compare with it
+    static MasterScore* createScore()
+    {
+        MasterScore* score = ScoreRW::readScore(u"test.mscx");
+        EXPECT_TRUE(score);
+        if (!score) {
+            return nullptr;
+        }
+
+        score->startCmd();
+        score->appendMeasures(MEASURE_COUNT - static_cast<int>(score->nmeasures()));
+        score->endCmd();
+
+        score->doLayout();
+
+        return score;
+    }
+
+    static std::vector<SystemStart> systemStarts(const Score* score)
+    {
+        std::vector<SystemStart> result;
+        for (const Page* page : score->pages()) {
+            for (const System* system : page->systems()) {
+                result.push_back({ system->measures().front()->tick(), page->no() });
+            }
+        }
+        return result;
+    }
+
+    static void layoutFirstPages(MasterScore* score, size_t pageCount)
+    {
+        score->setLayoutPageLimit(pageCount);
+        score->doLayout();
+    }
+};
+
+TEST_F(Engraving_ProgressiveLayoutTests, layoutsFirstPagesOnly)
+{
+    MasterScore* score = createScore();
+    ASSERT_TRUE(score);
+
+    const size_t pageCount = score->npages();
+    ASSERT_GT(pageCount, 6u);
+    EXPECT_TRUE(score->isLayoutComplete());
+
+    layoutFirstPages(score, 2);
+
+    EXPECT_EQ(score->npages(), 2u);
+    EXPECT_FALSE(score->isLayoutComplete());
+
+    delete score;
+}
+
+TEST_F(Engraving_ProgressiveLayoutTests, nextPagesContinueTheLayout)
+{
+    MasterScore* score = createScore();
+    ASSERT_TRUE(score);
+
+    const std::vector<SystemStart> full = systemStarts(score);
+
+    layoutFirstPages(score, 2);
+
+    // [WHEN] The layout is continued by two pages
+    EXPECT_FALSE(score->layoutNextPages(2));
+
+    // [THEN] It has more pages, but is not complete yet
+    EXPECT_GT(score->npages(), 2u);
+    EXPECT_LE(score->npages(), 4u);
+    EXPECT_FALSE(score->isLayoutComplete());
+
+    // [WHEN] It is continued until the end
+    static constexpr int MAX_STEPS = MEASURE_COUNT;
+    int steps = 0;
+    while (steps < MAX_STEPS && !score->layoutNextPages(2)) {
+        ++steps;
+    }
+
+    // [THEN] The pages are the same as if the score was laid out at once
+    EXPECT_LT(steps, MAX_STEPS);
+    EXPECT_TRUE(score->isLayoutComplete());
+    EXPECT_TRUE(systemStarts(score) == full);
+
+    delete score;
+}
+
+TEST_F(Engraving_ProgressiveLayoutTests, ensurePageLaidOut)
+{
+    MasterScore* score = createScore();
+    ASSERT_TRUE(score);
+
+    const size_t pageCount = score->npages();
+    ASSERT_GT(pageCount, 6u);
+
+    layoutFirstPages(score, 1);
+
+    // [WHEN] A page after the laid out ones is needed
+    score->ensurePageLaidOut(5);
+
+    // [THEN] It is laid out, the rest is still not
+    EXPECT_GT(score->npages(), 5u);
+    EXPECT_FALSE(score->isLayoutComplete());
+
+    delete score;
+}
+
+TEST_F(Engraving_ProgressiveLayoutTests, ensureLayoutComplete)
+{
+    MasterScore* score = createScore();
+    ASSERT_TRUE(score);
+
+    const std::vector<SystemStart> full = systemStarts(score);
+
+    layoutFirstPages(score, 1);
+
+    // [WHEN] The whole score is needed
+    score->ensureLayoutComplete();
+
+    // [THEN] All the pages are laid out as if the score was laid out at once
+    EXPECT_TRUE(score->isLayoutComplete());
+    EXPECT_TRUE(systemStarts(score) == full);
+
+    delete score;
+}
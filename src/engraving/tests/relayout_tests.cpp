@@ -0,0 +1,239 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "realfn.h"
+
+#include "dom/editdata.h"
+#include "dom/factory.h"
+#include "dom/layoutbreak.h"
+#include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/page.h"
+#include "dom/system.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+//---------------------------------------------------------
+//   RelayoutTests
+//    An edit lays out the systems from the edited one until the line
+//    breaks re-converge with the previous layout, the later systems
+//    are taken unchanged.
+//---------------------------------------------------------
+
+static constexpr int MEASURES_PER_SYSTEM = 4;
+static constexpr int SYSTEM_COUNT = 6;
+
+class Engraving_RelayoutTests : public ::testing::Test
+{
+public:
+    struct SystemGeometry {
+        Fraction firstTick;
+        Fraction lastTick;
+        page_idx_t page = 0;
+        double y = 0.0;
+        std::vector<double> measureX;
+
+        bool operator==(const SystemGeometry& other) const
+        {
+            if (firstTick != other.firstTick || lastTick != other.lastTick || page != other.page
+                || !muse::RealIsEqual(y, other.y) || measureX.size() != other.measureX.size()) {
+                return false;
+            }
+
+            for (size_t i = 0; i < measureX.size(); ++i) {
+                if (!muse::RealIsEqual(measureX.at(i), other.measureX.at(i))) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    //! NOTE Systems of MEASURES_PER_SYSTEM measures each, ended by line breaks
+    static MasterScore* createScore()
+    {
+        MasterScore* score = ScoreRW::readScore(u"test.mscx");
+        EXPECT_TRUE(score);
+        if (!score) {
+            return nullptr;
+        }
+
+        score->startCmd();
+        score->appendMeasures(MEASURES_PER_SYSTEM * SYSTEM_COUNT - static_cast<int>(score->nmeasures()));
+        score->endCmd();
+
+        score->startCmd();
+        int no = 1;
+        for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure(), ++no) {
+            if (no % MEASURES_PER_SYSTEM == 0) {
+                addLineBreak(score, m);
+            }
+        }
+        score->endCmd();
+
+        score->doLayout();
+        EXPECT_EQ(score->systems().size(), size_t(SYSTEM_COUNT));
+
+        return score;
+    }
+
+    static void addLineBreak(Score* score, Measure* m)
+    {
+        LayoutBreak* lb = Factory::createLayoutBreak(m);
+        lb->setLayoutBreakType(LayoutBreakType::LINE);
+        lb->setTrack(muse::nidx);
+        lb->setParent(m);
+        score->undoAddElement(lb);
+    }
+
+    static Measure* measure(Score* score, int index)
+    {
+        Measure* m = score->firstMeasure();
+        for (int i = 0; i < index && m; ++i) {
+            m = m->nextMeasure();
+        }
+        return m;
+    }
+
+    static std::vector<SystemGeometry> geometry(const Score* score)
+    {
+        std::vector<SystemGeometry> result;
+        for (const System* system : score->systems()) {
+            SystemGeometry g;
+            g.firstTick = system->measures().front()->tick();
+            g.lastTick = system->measures().back()->tick();
+            g.page = system->page() ? system->page()->no() : muse::nidx;
+            g.y = system->pagePos().y();
+            for (const MeasureBase* mb : system->measures()) {
+                g.measureX.push_back(mb->x());
+            }
+            result.push_back(std::move(g));
+        }
+        return result;
+    }
+
+    //! NOTE Relayouts the whole score and checks that nothing moves
+    static void checkMatchesFullLayout(MasterScore* score)
+    {
+        std::vector<SystemGeometry> incremental = geometry(score);
+
+        score->doLayout();
+
+        std::vector<SystemGeometry> full = geometry(score);
+        ASSERT_EQ(incremental.size(), full.size());
+        for (size_t i = 0; i < full.size(); ++i) {
+            EXPECT_TRUE(incremental.at(i) == full.at(i)) << "system " << i;
+        }
+    }
+};
+
+//---------------------------------------------------------
+//   addSystem
+//    A line break in the middle of the second system adds a system,
+//    the systems after it are kept.
+//---------------------------------------------------------
+
+TEST_F(Engraving_RelayoutTests, addSystem)
+{
+    MasterScore* score = createScore();
+    ASSERT_TRUE(score);
+
+    std::vector<System*> before = score->systems();
+
+    score->startCmd();
+    addLineBreak(score, measure(score, MEASURES_PER_SYSTEM + 1));
+    score->endCmd();
+
+    ASSERT_EQ(score->systems().size(), before.size() + 1);
+    for (size_t i = 2; i < before.size(); ++i) {
+        EXPECT_EQ(score->systems().at(i + 1), before.at(i)) << "system " << i;
+    }
+
+    checkMatchesFullLayout(score);
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   absorbSystem
+//    Deleting the measures of the second system absorbs it,
+//    the systems after it are kept.
+//---------------------------------------------------------
+
+TEST_F(Engraving_RelayoutTests, absorbSystem)
+{
+    MasterScore* score = createScore();
+    ASSERT_TRUE(score);
+
+    std::vector<System*> before = score->systems();
+
+    score->startCmd();
+    score->deleteMeasures(measure(score, MEASURES_PER_SYSTEM), measure(score, 2 * MEASURES_PER_SYSTEM - 1));
+    score->endCmd();
+
+    ASSERT_EQ(score->systems().size(), before.size() - 1);
+    for (size_t i = 3; i < before.size(); ++i) {
+        EXPECT_EQ(score->systems().at(i - 1), before.at(i)) << "system " << i;
+    }
+
+    checkMatchesFullLayout(score);
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   undoAddedSystem
+//    Undoing the line break absorbs the added system again.
+//---------------------------------------------------------
+
+TEST_F(Engraving_RelayoutTests, undoAddedSystem)
+{
+    MasterScore* score = createScore();
+    ASSERT_TRUE(score);
+
+    std::vector<SystemGeometry> original = geometry(score);
+
+    score->startCmd();
+    addLineBreak(score, measure(score, MEASURES_PER_SYSTEM + 1));
+    score->endCmd();
+
+    std::vector<System*> added = score->systems();
+
+    EditData ed;
+    score->undoRedo(true, &ed);
+
+    ASSERT_EQ(score->systems().size(), added.size() - 1);
+    for (size_t i = 3; i < added.size(); ++i) {
+        EXPECT_EQ(score->systems().at(i - 1), added.at(i)) << "system " << i;
+    }
+
+    EXPECT_TRUE(geometry(score) == original);
+    checkMatchesFullLayout(score);
+
+    delete score;
+}
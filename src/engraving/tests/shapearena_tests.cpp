@@ -0,0 +1,125 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cfloat>
+
+#include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/segment.h"
+#include "dom/staff.h"
+
+#include "rendering/dev/horizontalspacing.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::engraving::rendering::dev;
+
+static const String SHAPEARENA_DATA_DIR(u"all_elements_data/");
+
+//---------------------------------------------------------
+//   ShapeArenaTests
+//    The distances read from the segment arenas must be
+//    the ones of the staff shapes they are copied from.
+//---------------------------------------------------------
+
+class Engraving_ShapeArenaTests : public ::testing::Test
+{
+public:
+    //! NOTE Same as HorizontalSpacing::minHorizontalCollidingDistance(), on the staff shapes
+    static double shapesCollidingDistance(const Segment* f, const Segment* ns, double squeezeFactor)
+    {
+        if (f->isBeginBarLineType() && ns->isStartRepeatBarLineType()) {
+            return 0.0;
+        }
+
+        double w = -DBL_MAX;
+        const Score* score = f->score();
+        for (staff_idx_t staffIdx = 0; staffIdx < f->shapes().size(); ++staffIdx) {
+            if (score->staff(staffIdx) && !score->staff(staffIdx)->show()) {
+                continue;
+            }
+
+            const Shape& fshape = f->staffShape(staffIdx);
+            double sp = HorizontalSpacing::shapeSpatium(fshape);
+            double d = HorizontalSpacing::minHorizontalDistance(fshape, ns->staffShape(staffIdx), sp, squeezeFactor);
+            w = std::max(w, d);
+        }
+        return w;
+    }
+
+    static void checkDistances(const String& fileName)
+    {
+        MasterScore* score = ScoreRW::readScore(SHAPEARENA_DATA_DIR + fileName);
+        ASSERT_TRUE(score);
+
+        size_t pairs = 0;
+        for (const Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+            for (const Segment* s = m->first(); s && s->next(); s = s->next()) {
+                const Segment* ns = s->next();
+                for (double squeezeFactor : { 1.0, 0.7 }) {
+                    EXPECT_DOUBLE_EQ(HorizontalSpacing::minHorizontalCollidingDistance(s, ns, squeezeFactor),
+                                     shapesCollidingDistance(s, ns, squeezeFactor))
+                        << fileName.toStdString() << ", measure at " << m->tick().toString().toStdString()
+                        << ", segment at " << s->tick().toString().toStdString() << ", squeeze " << squeezeFactor;
+                }
+                ++pairs;
+            }
+        }
+
+        EXPECT_GT(pairs, 0);
+
+        delete score;
+    }
+};
+
+TEST_F(Engraving_ShapeArenaTests, distancesMatchShapes)
+{
+    checkDistances(u"layout_elements.mscx");
+    checkDistances(u"layout_elements_tab.mscx");
+    checkDistances(u"cross_staff_arp.mscx");
+}
+
+TEST_F(Engraving_ShapeArenaTests, layoutReleasesBuiltArenas)
+{
+    MasterScore* score = ScoreRW::readScore(SHAPEARENA_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    //! [GIVEN] The layout has released the arenas it has built
+    EXPECT_TRUE(score->takeBuiltShapeArenas().empty());
+
+    //! [GIVEN] Arenas built outside of a layout
+    Measure* measure = score->firstMeasure();
+    ASSERT_TRUE(measure && measure->first() && measure->first()->next());
+    HorizontalSpacing::minHorizontalCollidingDistance(measure->first(), measure->first()->next(), 1.0);
+
+    //! [WHEN] The score is laid out again
+    score->doLayout();
+
+    //! [THEN] They are released too
+    EXPECT_TRUE(score->takeBuiltShapeArenas().empty());
+
+    delete score;
+}
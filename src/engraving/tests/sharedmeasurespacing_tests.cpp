@@ -0,0 +1,326 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dom/chord.h"
+#include "dom/editdata.h"
+#include "dom/excerpt.h"
+#include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/note.h"
+#include "dom/part.h"
+#include "dom/segment.h"
+
+#include "rendering/dev/sharedmeasurespacing.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::engraving::rendering::dev;
+
+static const String PARTS_DATA_DIR("parts_data/");
+
+class Engraving_SharedMeasureSpacingTests : public ::testing::Test
+{
+public:
+    static SharedMeasureSpacing::Key key(int64_t content)
+    {
+        SharedMeasureSpacing::Key key;
+        key.style = 3;
+        key.segments = 2;
+        key.params = { 2.0 };
+        key.geometry = { 0.0, 1.0, 2.0, 3.0 };
+        key.items = { content };
+        key.updateHash();
+        return key;
+    }
+
+    static SharedMeasureSpacing::Spacing spacing(double width)
+    {
+        SharedMeasureSpacing::Spacing spacing;
+        spacing.width = width;
+        spacing.squeezableSpace = 1.5;
+        spacing.layoutStretch = 0.5;
+        spacing.segments = { { 0.0, 10.0, 0.0, 1.0 }, { 10.0, width - 10.0, 0.0, 2.0 } };
+        return spacing;
+    }
+
+    //! NOTE A master score with two parts made of its first instrument, so they have the same content
+    static MasterScore* createScoreWithIdenticalParts()
+    {
+        MasterScore* score = ScoreRW::readScore(PARTS_DATA_DIR + u"part-all.mscx");
+        EXPECT_TRUE(score);
+        if (!score) {
+            return nullptr;
+        }
+
+        for (int i = 0; i < 2; ++i) {
+            Score* nscore = score->createScore();
+            Excerpt* ex = new Excerpt(score);
+            ex->setExcerptScore(nscore);
+            ex->setParts({ score->parts().at(0) });
+            ex->setName(score->parts().at(0)->partName());
+            Excerpt::createExcerpt(ex);
+            score->excerpts().push_back(ex);
+        }
+        score->setExcerptsChanged(true);
+
+        return score;
+    }
+
+    static std::vector<double> measureSpacing(const Score* score)
+    {
+        std::vector<double> values;
+        for (const Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+            values.push_back(m->width());
+            for (const Segment* s = m->first(); s; s = s->next()) {
+                values.push_back(s->x());
+                values.push_back(s->width());
+            }
+        }
+        return values;
+    }
+
+    //! NOTE As an edit does: the master score first, then its parts
+    static void layoutAll(MasterScore* score)
+    {
+        score->doLayout();
+        for (Excerpt* ex : score->excerpts()) {
+            ex->excerptScore()->doLayout();
+        }
+    }
+
+    //! NOTE The spacing of the score laid out on its own, with nothing to take from the other scores
+    static std::vector<double> ownMeasureSpacing(Score* score)
+    {
+        SharedMeasureSpacing::instance()->clear();
+        score->doLayout();
+        return measureSpacing(score);
+    }
+};
+
+TEST_F(Engraving_SharedMeasureSpacingTests, FindsStoredSpacing)
+{
+    SharedMeasureSpacing shared;
+
+    SharedMeasureSpacing::Spacing found;
+    EXPECT_FALSE(shared.find(key(1), found));
+
+    shared.store(key(1), spacing(40.0));
+    ASSERT_TRUE(shared.find(key(1), found));
+    EXPECT_DOUBLE_EQ(found.width, 40.0);
+    EXPECT_DOUBLE_EQ(found.squeezableSpace, 1.5);
+    EXPECT_DOUBLE_EQ(found.layoutStretch, 0.5);
+    ASSERT_EQ(found.segments.size(), 2u);
+    EXPECT_DOUBLE_EQ(found.segments[1].x, 10.0);
+    EXPECT_DOUBLE_EQ(found.segments[1].width, 30.0);
+    EXPECT_DOUBLE_EQ(found.segments[1].stretch, 2.0);
+
+    SharedMeasureSpacing::Stats stats = shared.stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.size, 1u);
+}
+
+TEST_F(Engraving_SharedMeasureSpacingTests, EveryPartOfTheKeyCounts)
+{
+    SharedMeasureSpacing shared;
+    shared.store(key(1), spacing(40.0));
+
+    SharedMeasureSpacing::Spacing found;
+    SharedMeasureSpacing::Key other = key(1);
+    other.params = { 20.0 };
+    other.updateHash();
+    EXPECT_FALSE(shared.find(other, found));
+
+    other = key(1);
+    other.style = 30;
+    other.updateHash();
+    EXPECT_FALSE(shared.find(other, found));
+
+    other = key(1);
+    other.segments = 3;
+    other.updateHash();
+    EXPECT_FALSE(shared.find(other, found));
+
+    other = key(1);
+    other.geometry.back() = 4.0;
+    other.updateHash();
+    EXPECT_FALSE(shared.find(other, found));
+
+    EXPECT_FALSE(shared.find(key(10), found));
+}
+
+TEST_F(Engraving_SharedMeasureSpacingTests, SameHashIsNotEnough)
+{
+    SharedMeasureSpacing shared;
+    shared.store(key(1), spacing(40.0));
+
+    // [GIVEN] A key with the hash of a stored one but different content
+    SharedMeasureSpacing::Key other = key(2);
+    other.hash = key(1).hash;
+
+    // [THEN] It doesn't match
+    SharedMeasureSpacing::Spacing found;
+    EXPECT_FALSE(shared.find(other, found));
+}
+
+TEST_F(Engraving_SharedMeasureSpacingTests, DropsEntriesAtCapacity)
+{
+    SharedMeasureSpacing shared(2);
+    shared.store(key(1), spacing(40.0));
+    shared.store(key(2), spacing(50.0));
+
+    // replacing an entry doesn't drop the others
+    shared.store(key(2), spacing(60.0));
+    EXPECT_EQ(shared.stats().size, 2u);
+
+    shared.store(key(3), spacing(70.0));
+    EXPECT_EQ(shared.stats().size, 1u);
+
+    SharedMeasureSpacing::Spacing found;
+    EXPECT_FALSE(shared.find(key(1), found));
+    ASSERT_TRUE(shared.find(key(3), found));
+    EXPECT_DOUBLE_EQ(found.width, 70.0);
+
+    shared.clear();
+    EXPECT_EQ(shared.stats().size, 0u);
+    EXPECT_EQ(shared.stats().hits, 0u);
+}
+
+TEST_F(Engraving_SharedMeasureSpacingTests, KeepsEntriesOfOneLayoutPass)
+{
+    MasterScore* master = ScoreRW::readScore(PARTS_DATA_DIR + u"part-all.mscx");
+    ASSERT_TRUE(master);
+
+    SharedMeasureSpacing shared;
+    shared.bind(master, 1, nullptr, true);
+    shared.store(key(1), spacing(40.0));
+
+    // [WHEN] The excerpts of the same state are laid out
+    shared.bind(master, 1, nullptr, false);
+
+    // [THEN] The entries are kept
+    EXPECT_EQ(shared.stats().size, 1u);
+
+    // [WHEN] Another state is laid out
+    shared.bind(master, 2, nullptr, false);
+
+    // [THEN] They are dropped
+    EXPECT_EQ(shared.stats().size, 0u);
+
+    // [WHEN] A command is opened in the same state
+    shared.store(key(1), spacing(40.0));
+    const int command = 0;
+    shared.bind(master, 2, &command, false);
+
+    // [THEN] They are dropped
+    EXPECT_EQ(shared.stats().size, 0u);
+
+    // [WHEN] The master score is laid out again for the same command
+    shared.store(key(1), spacing(40.0));
+    shared.bind(master, 2, &command, true);
+
+    // [THEN] They are dropped too
+    EXPECT_EQ(shared.stats().size, 0u);
+
+    // [WHEN] The style values are interned again after the entries were dropped
+    const size_t styleId = shared.styleId({ 1.0, 2.0 });
+    shared.bind(master, 3, nullptr, false);
+
+    // [THEN] The old id doesn't match anymore
+    EXPECT_NE(shared.styleId({ 1.0, 2.0 }), styleId);
+
+    delete master;
+}
+
+TEST_F(Engraving_SharedMeasureSpacingTests, SharesSpacingBetweenIdenticalParts)
+{
+    // [GIVEN] A score with two parts of the same instrument
+    MasterScore* score = createScoreWithIdenticalParts();
+    ASSERT_TRUE(score);
+    Score* part1 = score->excerpts().at(0)->excerptScore();
+    Score* part2 = score->excerpts().at(1)->excerptScore();
+
+    // [WHEN] The scores are laid out as after an edit
+    SharedMeasureSpacing::instance()->clear();
+    layoutAll(score);
+
+    // [THEN] The second part takes the spacing of the first one
+    EXPECT_GT(SharedMeasureSpacing::instance()->stats().hits, 0u);
+
+    std::vector<double> shared = measureSpacing(part2);
+    EXPECT_EQ(shared, measureSpacing(part1));
+
+    // [THEN] And it is the spacing the part gets on its own
+    EXPECT_EQ(shared, ownMeasureSpacing(part2));
+
+    delete score;
+}
+
+TEST_F(Engraving_SharedMeasureSpacingTests, EditDropsSharedSpacing)
+{
+    // [GIVEN] A score with two parts of the same instrument, laid out
+    MasterScore* score = createScoreWithIdenticalParts();
+    ASSERT_TRUE(score);
+    Score* part2 = score->excerpts().at(1)->excerptScore();
+
+    SharedMeasureSpacing::instance()->clear();
+    layoutAll(score);
+
+    // [WHEN] A note of the instrument gets higher, which changes the accidentals and the spacing
+    Note* note = nullptr;
+    for (Segment* s = score->firstSegment(SegmentType::ChordRest); s && !note; s = s->next1(SegmentType::ChordRest)) {
+        EngravingItem* e = s->element(0);
+        if (e && e->isChord()) {
+            note = toChord(e)->upNote();
+        }
+    }
+    ASSERT_TRUE(note);
+
+    score->startCmd();
+    note->undoChangeProperty(Pid::PITCH, note->pitch() + 1);
+    note->undoChangeProperty(Pid::TPC1, note->tpc1() + 7);
+    note->undoChangeProperty(Pid::TPC2, note->tpc2() + 7);
+    score->endCmd();
+
+    for (Excerpt* ex : score->excerpts()) {
+        ex->excerptScore()->doLayout();
+    }
+
+    // [THEN] The parts are spaced for the new content
+    EXPECT_EQ(measureSpacing(part2), ownMeasureSpacing(part2));
+
+    // [WHEN] The edit is undone
+    EditData ed;
+    score->undoRedo(true, &ed);
+    for (Excerpt* ex : score->excerpts()) {
+        ex->excerptScore()->doLayout();
+    }
+
+    // [THEN] They are spaced for the previous content again
+    EXPECT_EQ(measureSpacing(part2), ownMeasureSpacing(part2));
+
+    delete score;
+}
@@ -0,0 +1,114 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "infrastructure/shape.h"
+
+#include "rendering/dev/slurcollisionenvelope.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::engraving::rendering::dev;
+
+//---------------------------------------------------------
+//   SlurCollisionEnvelopeTests
+//    The envelope must find the same collisions as testing
+//    each slur rect against the segment shapes one by one.
+//---------------------------------------------------------
+
+class Engraving_SlurCollisionEnvelopeTests : public ::testing::Test
+{
+public:
+    //! NOTE Mostly ordinary rects, some of them of zero or negative width or height, as found in the shapes
+    static RectF randomRect(std::mt19937& generator)
+    {
+        std::uniform_real_distribution<double> xDistribution(0.0, 200.0);
+        std::uniform_real_distribution<double> yDistribution(-40.0, 40.0);
+        std::uniform_real_distribution<double> sizeDistribution(-2.0, 20.0);
+        std::uniform_int_distribution<int> zeroWidthDistribution(0, 20);
+
+        const double width = zeroWidthDistribution(generator) == 0 ? 0.0 : sizeDistribution(generator);
+        return RectF(xDistribution(generator), yDistribution(generator), width, sizeDistribution(generator));
+    }
+
+    //! NOTE As the stable layout tests the slur rects against the segment shapes
+    static bool shapesIntersect(const std::vector<Shape>& shapes, const RectF& rect, bool up)
+    {
+        for (const Shape& shape : shapes) {
+            const bool intersection = up ? !Shape(rect).clearsVertically(shape) : !shape.clearsVertically(Shape(rect));
+            if (intersection) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+TEST_F(Engraving_SlurCollisionEnvelopeTests, sameAsClearsVertically)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> shapeCountDistribution(1, 12);
+    std::uniform_int_distribution<int> elementCountDistribution(0, 8);
+
+    size_t intersections = 0;
+    size_t checks = 0;
+
+    for (int round = 0; round < 200; ++round) {
+        std::vector<Shape> shapes(shapeCountDistribution(generator));
+        for (Shape& shape : shapes) {
+            const int elementCount = elementCountDistribution(generator);
+            for (int i = 0; i < elementCount; ++i) {
+                shape.add(randomRect(generator));
+            }
+        }
+
+        for (bool up : { true, false }) {
+            const SlurCollisionEnvelope envelope(shapes, up);
+
+            for (int i = 0; i < 50; ++i) {
+                const RectF rect = randomRect(generator);
+                const bool expected = shapesIntersect(shapes, rect, up);
+                EXPECT_EQ(envelope.intersects(rect), expected) << "round " << round << ", up " << up << ", rect " << rect.x() << " "
+                                                               << rect.y() << " " << rect.width() << " " << rect.height();
+                intersections += expected ? 1 : 0;
+                ++checks;
+            }
+        }
+    }
+
+    // both outcomes are covered
+    EXPECT_GT(intersections, 0u);
+    EXPECT_LT(intersections, checks);
+}
+
+TEST_F(Engraving_SlurCollisionEnvelopeTests, emptyShapes)
+{
+    const std::vector<Shape> shapes(3);
+
+    for (bool up : { true, false }) {
+        const SlurCollisionEnvelope envelope(shapes, up);
+        EXPECT_FALSE(envelope.intersects(RectF(0.0, 0.0, 10.0, 10.0)));
+    }
+}
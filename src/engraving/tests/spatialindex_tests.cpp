@@ -0,0 +1,288 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <set>
+
+#include "containers.h"
+
+#include "dom/bsp.h"
+#include "dom/measure.h"
+#include "dom/page.h"
+#include "dom/spatialindex.h"
+#include "dom/system.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String SPATIALINDEX_DATA_DIR(u"all_elements_data/");
+
+class Engraving_SpatialIndexTests : public ::testing::Test
+{
+public:
+    // Random rects on a page of the given size; the items are fake and are never dereferenced
+    static std::vector<SpatialIndex::Entry> randomEntries(size_t count, double width, double height)
+    {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<double> xDistribution(0.0, width);
+        std::uniform_real_distribution<double> yDistribution(0.0, height);
+        std::uniform_real_distribution<double> sizeDistribution(0.0, 50.0);
+
+        std::vector<SpatialIndex::Entry> entries;
+        for (size_t i = 0; i < count; ++i) {
+            RectF rect(xDistribution(generator), yDistribution(generator), sizeDistribution(generator), sizeDistribution(generator));
+            entries.push_back({ rect, reinterpret_cast<EngravingItem*>(i + 1) });
+        }
+
+        return entries;
+    }
+
+    static std::set<EngravingItem*> sorted(const std::vector<EngravingItem*>& items)
+    {
+        return std::set<EngravingItem*>(items.begin(), items.end());
+    }
+};
+
+/**
+ * @brief Engraving_SpatialIndexTests_QueryMatchesLinearSearch
+ * @details Check that SpatialIndex returns exactly the entries a linear search finds
+ */
+TEST_F(Engraving_SpatialIndexTests, QueryMatchesLinearSearch)
+{
+    // [GIVEN] An index of random rects
+    const std::vector<SpatialIndex::Entry> entries = randomEntries(5000, 2000.0, 3000.0);
+
+    SpatialIndex index;
+    index.build(std::vector<SpatialIndex::Entry>(entries));
+    EXPECT_EQ(index.size(), entries.size());
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> distribution(0.0, 2000.0);
+
+    for (int i = 0; i < 200; ++i) {
+        // [WHEN] Querying a rect and a point
+        RectF rect(distribution(generator), distribution(generator), 100.0, 60.0);
+        PointF pos(distribution(generator), distribution(generator));
+
+        std::vector<EngravingItem*> rectItems;
+        index.query(rect, rectItems);
+
+        std::vector<EngravingItem*> posItems;
+        index.query(pos, posItems);
+
+        // [THEN] The results match a linear search
+        std::set<EngravingItem*> expectedRectItems;
+        std::set<EngravingItem*> expectedPosItems;
+        for (const SpatialIndex::Entry& entry : entries) {
+            const RectF& r = entry.rect;
+            if (r.left() <= rect.right() && r.right() >= rect.left() && r.top() <= rect.bottom() && r.bottom() >= rect.top()) {
+                expectedRectItems.insert(entry.item);
+            }
+            if (r.left() <= pos.x() && r.right() >= pos.x() && r.top() <= pos.y() && r.bottom() >= pos.y()) {
+                expectedPosItems.insert(entry.item);
+            }
+        }
+
+        EXPECT_EQ(rectItems.size(), expectedRectItems.size());
+        EXPECT_EQ(sorted(rectItems), expectedRectItems);
+        EXPECT_EQ(sorted(posItems), expectedPosItems);
+    }
+}
+
+/**
+ * @brief Engraving_SpatialIndexTests_PageItems
+ * @details Check that Page::items finds the same elements as a linear search over the page elements
+ */
+TEST_F(Engraving_SpatialIndexTests, PageItems)
+{
+    Score* score = ScoreRW::readScore(SPATIALINDEX_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    for (Page* page : score->pages()) {
+        // [GIVEN] The visible elements of the page
+        std::vector<EngravingItem*> elements = page->elements();
+        EXPECT_FALSE(elements.empty());
+
+        RectF pageRect = page->pageBoundingRect();
+        const double step = pageRect.width() / 8;
+
+        for (double y = 0.0; y < pageRect.height(); y += step) {
+            for (double x = 0.0; x < pageRect.width(); x += step) {
+                // [WHEN] Querying a part of the page
+                RectF rect(x, y, step, step);
+                std::vector<EngravingItem*> items = page->items(rect);
+
+                // [THEN] The result is the same as a linear search
+                std::set<EngravingItem*> expected;
+                for (EngravingItem* e : elements) {
+                    if (e->pageBoundingRect().intersects(rect)) {
+                        expected.insert(e);
+                    }
+                }
+
+                EXPECT_EQ(items.size(), expected.size());
+                EXPECT_EQ(sorted(items), expected);
+            }
+        }
+    }
+
+    delete score;
+}
+
+/**
+ * @brief Engraving_SpatialIndexTests_InvalidateSystem
+ * @details Check that a moved system keeps its index, and that an invalidated system is rebuilt
+ */
+TEST_F(Engraving_SpatialIndexTests, InvalidateSystem)
+{
+    Score* score = ScoreRW::readScore(SPATIALINDEX_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    Page* page = score->pages().front();
+    ASSERT_FALSE(page->systems().empty());
+    System* system = page->systems().front();
+
+    Measure* measure = system->firstMeasure();
+    ASSERT_TRUE(measure);
+
+    RectF measureRect(measure->pageBoundingRect().center(), SizeF(1.0, 1.0));
+    std::vector<EngravingItem*> items = page->items(measureRect);
+    EXPECT_TRUE(muse::contains(items, static_cast<EngravingItem*>(measure)));
+
+    // [WHEN] The system is moved
+    const PointF delta(0.0, 10.0);
+    system->setPos(system->pos() + delta);
+
+    // [THEN] Its items are found at the new position without invalidating the index
+    items = page->items(measureRect.translated(delta));
+    EXPECT_TRUE(muse::contains(items, static_cast<EngravingItem*>(measure)));
+
+    system->setPos(system->pos() - delta);
+
+    // [WHEN] The system is invalidated
+    page->invalidateSpatialIndex(system);
+
+    // [THEN] The index is rebuilt
+    items = page->items(measureRect);
+    EXPECT_TRUE(muse::contains(items, static_cast<EngravingItem*>(measure)));
+
+    delete score;
+}
+
+/**
+ * @brief Engraving_SpatialIndexTests_Benchmark
+ * @details Compare the build and the query time of SpatialIndex and BspTree on large pages.
+ *          Run with --gtest_also_run_disabled_tests
+ */
+TEST_F(Engraving_SpatialIndexTests, DISABLED_Benchmark)
+{
+    using Clock = std::chrono::steady_clock;
+
+    auto msecs = [](Clock::duration duration) {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    };
+
+    // [GIVEN] Large synthetic pages
+    for (size_t count : { 10000u, 100000u, 500000u }) {
+        const std::vector<SpatialIndex::Entry> entries = randomEntries(count, 2000.0, 3000.0);
+
+        SpatialIndex index;
+        Clock::time_point start = Clock::now();
+        index.build(std::vector<SpatialIndex::Entry>(entries));
+        const double buildTime = msecs(Clock::now() - start);
+
+        std::mt19937 generator(7);
+        std::uniform_real_distribution<double> distribution(0.0, 2000.0);
+        std::vector<EngravingItem*> result;
+        size_t found = 0;
+
+        start = Clock::now();
+        for (int i = 0; i < 10000; ++i) {
+            result.clear();
+            index.query(RectF(distribution(generator), distribution(generator), 40.0, 40.0), result);
+            found += result.size();
+        }
+        const double queryTime = msecs(Clock::now() - start);
+
+        std::cout << "SpatialIndex, " << count << " items: build " << buildTime << " ms, 10000 queries "
+                  << queryTime << " ms (" << found << " found)" << std::endl;
+    }
+
+    // [GIVEN] A real score
+    Score* score = ScoreRW::readScore(SPATIALINDEX_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    for (Page* page : score->pages()) {
+        const std::vector<EngravingItem*> elements = page->elements();
+        const RectF pageRect = page->pageBoundingRect();
+        const PointF center = pageRect.center();
+
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < 100; ++i) {
+            page->invalidateSpatialIndex();
+            page->items(center);
+        }
+        const double indexBuildTime = msecs(Clock::now() - start) / 100;
+
+        start = Clock::now();
+        for (int i = 0; i < 100; ++i) {
+            BspTree bsp;
+            bsp.initialize(pageRect, static_cast<int>(elements.size()));
+            for (EngravingItem* e : elements) {
+                bsp.insert(e);
+            }
+        }
+        const double bspBuildTime = msecs(Clock::now() - start) / 100;
+
+        BspTree bsp;
+        bsp.initialize(pageRect, static_cast<int>(elements.size()));
+        for (EngravingItem* e : elements) {
+            bsp.insert(e);
+        }
+
+        const RectF queryRect(center.x(), center.y(), pageRect.width() / 10, pageRect.height() / 10);
+
+        start = Clock::now();
+        for (int i = 0; i < 1000; ++i) {
+            page->items(queryRect);
+        }
+        const double indexQueryTime = msecs(Clock::now() - start);
+
+        start = Clock::now();
+        for (int i = 0; i < 1000; ++i) {
+            bsp.items(queryRect);
+        }
+        const double bspQueryTime = msecs(Clock::now() - start);
+
+        std::cout << "Page " << page->no() << ", " << elements.size() << " items: rebuild " << indexBuildTime
+                  << " ms (BspTree " << bspBuildTime << " ms), 1000 queries " << indexQueryTime
+                  << " ms (BspTree " << bspQueryTime << " ms)" << std::endl;
+    }
+
+    delete score;
+}
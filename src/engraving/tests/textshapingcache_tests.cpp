@@ -0,0 +1,103 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "draw/fontmetrics.h"
+
+#include "dom/textshapingcache.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace muse::draw;
+
+class Engraving_TextShapingCacheTests : public ::testing::Test
+{
+public:
+    static Font textFont(double pointSize)
+    {
+        Font font(u"Edwin", Font::Type::Text);
+        font.setPointSizeF(pointSize);
+        return font;
+    }
+};
+
+TEST_F(Engraving_TextShapingCacheTests, MatchesFontMetrics)
+{
+    TextShapingCache cache;
+    const Font font = textFont(10.0);
+    const String text(u"Allegro");
+
+    FontMetrics fm(font);
+    TextShapingCache::TextShape shape = cache.textShape(font, text);
+    EXPECT_DOUBLE_EQ(shape.width, fm.width(text));
+    EXPECT_EQ(shape.tightBoundingRect, fm.tightBoundingRect(text));
+
+    TextShapingCache::FontShape fontShape = cache.fontShape(font);
+    EXPECT_DOUBLE_EQ(fontShape.ascent, fm.ascent());
+    EXPECT_DOUBLE_EQ(fontShape.descent, fm.descent());
+    EXPECT_DOUBLE_EQ(fontShape.lineSpacing, fm.lineSpacing());
+}
+
+TEST_F(Engraving_TextShapingCacheTests, HitRate)
+{
+    TextShapingCache cache;
+    const String text(u"Allegro");
+
+    cache.textShape(textFont(10.0), text);
+    cache.textShape(textFont(10.0), text);
+    cache.textShape(textFont(10.0), text);
+
+    // another size (e.g. another spatium) is another entry
+    cache.textShape(textFont(12.0), text);
+
+    TextShapingCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.hits, 2u);
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.size, 2u);
+    EXPECT_DOUBLE_EQ(stats.hitRate(), 0.5);
+
+    cache.resetStats();
+    EXPECT_EQ(cache.stats().hits, 0u);
+    EXPECT_EQ(cache.stats().size, 2u);
+}
+
+TEST_F(Engraving_TextShapingCacheTests, EvictsLeastRecentlyUsed)
+{
+    TextShapingCache cache(2);
+    const Font font = textFont(10.0);
+
+    cache.textShape(font, u"a");
+    cache.textShape(font, u"b");
+    cache.textShape(font, u"a"); // "b" is now the least recently used
+    cache.textShape(font, u"c");
+
+    TextShapingCache::Stats stats = cache.stats();
+    EXPECT_EQ(stats.size, 2u);
+    EXPECT_EQ(stats.evictions, 1u);
+
+    cache.resetStats();
+    cache.textShape(font, u"a");
+    cache.textShape(font, u"b");
+    EXPECT_EQ(cache.stats().hits, 1u);
+    EXPECT_EQ(cache.stats().misses, 1u);
+}
@@ -0,0 +1,168 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "realfn.h"
+
+#include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/system.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+//---------------------------------------------------------
+//   ViewportLayoutTests
+//    In continuous view, only the measures near the viewport
+//    are laid out, the other ones get an estimated width.
+//---------------------------------------------------------
+
+static constexpr int MEASURE_COUNT = 200;
+
+class Engraving_ViewportLayoutTests : public ::testing::Test
+{
+public:
+    static MasterScore* createScore()
+    {
+        MasterScore* score = ScoreRW::readScore(u"test.mscx");
+        EXPECT_TRUE(score);
+        if (!score) {
+            return nullptr;
+        }
+
+        score->startCmd();
+        score->appendMeasures(MEASURE_COUNT - static_cast<int>(score->nmeasures()));
+        score->endCmd();
+
+        score->setLayoutMode(LayoutMode::LINE);
+        score->setLayoutViewport(0.0, VIEWPORT_WIDTH);
+        score->doLayout();
+
+        return score;
+    }
+
+    static size_t estimatedCount(const Score* score)
+    {
+        size_t count = 0;
+        for (const Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+            if (m->isWidthEstimated()) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    static constexpr double VIEWPORT_WIDTH = 1000.0;
+};
+
+TEST_F(Engraving_ViewportLayoutTests, layoutsOnlyMeasuresNearViewport)
+{
+    MasterScore* score = createScore();
+    ASSERT_TRUE(score);
+
+    // the measures in view are laid out, the ones at the end of the score are estimated
+    EXPECT_FALSE(score->firstMeasure()->isWidthEstimated());
+    EXPECT_TRUE(score->lastMeasure()->isWidthEstimated());
+    EXPECT_GT(score->lastMeasure()->width(), 0.0);
+
+    // the estimated measures still follow each other
+    double x = 0.0;
+    for (const MeasureBase* mb : score->systems().front()->measures()) {
+        EXPECT_GE(mb->x(), x);
+        x = mb->x() + mb->width();
+    }
+
+    delete score;
+}
+
+TEST_F(Engraving_ViewportLayoutTests, scrolledMeasuresAreLaidOut)
+{
+    MasterScore* score = createScore();
+    ASSERT_TRUE(score);
+
+    const size_t estimated = estimatedCount(score);
+    ASSERT_GT(estimated, 0u);
+
+    // scroll to the end of the score
+    const Measure* last = score->lastMeasure();
+    EXPECT_TRUE(score->setLayoutViewport(last->canvasPos().x(), VIEWPORT_WIDTH));
+    EXPECT_FALSE(score->lastMeasure()->isWidthEstimated());
+    EXPECT_LT(estimatedCount(score), estimated);
+
+    // the refined widths move the viewport, but the layout settles after a few steps
+    static constexpr int MAX_STEPS = 10;
+    int steps = 0;
+    while (steps < MAX_STEPS && score->setLayoutViewport(score->lastMeasure()->canvasPos().x(), VIEWPORT_WIDTH)) {
+        ++steps;
+    }
+    EXPECT_LT(steps, MAX_STEPS);
+
+    delete score;
+}
+
+TEST_F(Engraving_ViewportLayoutTests, noViewportLaysOutEverything)
+{
+    MasterScore* score = createScore();
+    ASSERT_TRUE(score);
+
+    score->setLayoutViewport(0.0, 0.0);
+    score->doLayout();
+
+    EXPECT_EQ(estimatedCount(score), 0u);
+
+    delete score;
+}
+
+TEST_F(Engraving_ViewportLayoutTests, switchToPageViewLaysOutEverything)
+{
+    MasterScore* score = createScore();
+    ASSERT_TRUE(score);
+    ASSERT_GT(estimatedCount(score), 0u);
+
+    MasterScore* pageScore = ScoreRW::readScore(u"test.mscx");
+    ASSERT_TRUE(pageScore);
+    pageScore->startCmd();
+    pageScore->appendMeasures(MEASURE_COUNT - static_cast<int>(pageScore->nmeasures()));
+    pageScore->endCmd();
+    pageScore->doLayout();
+
+    // [WHEN] Continuous view, which has left measures estimated, is switched to page view
+    score->setLayoutMode(LayoutMode::PAGE);
+    score->doLayout();
+
+    // [THEN] No measure is estimated any more, and the layout is the same as without continuous view
+    EXPECT_EQ(estimatedCount(score), 0u);
+    ASSERT_EQ(score->systems().size(), pageScore->systems().size());
+
+    const Measure* pageMeasure = pageScore->firstMeasure();
+    for (const Measure* m = score->firstMeasure(); m && pageMeasure; m = m->nextMeasure(), pageMeasure = pageMeasure->nextMeasure()) {
+        EXPECT_TRUE(muse::RealIsEqual(m->width(), pageMeasure->width())) << "measure " << m->no();
+        EXPECT_TRUE(muse::RealIsEqual(m->canvasPos().x(), pageMeasure->canvasPos().x())) << "measure " << m->no();
+        EXPECT_TRUE(muse::RealIsEqual(m->canvasPos().y(), pageMeasure->canvasPos().y())) << "measure " << m->no();
+    }
+
+    delete pageScore;
+    delete score;
+}
@@ -31,6 +31,7 @@
 #include "internal/audiothread.h"
 #include "internal/audiobuffer.h"
 #include "internal/audiothreadsecurer.h"
+#include "internal/audiosignalsnotifier.h"
 #include "internal/audiooutputdevicecontroller.h"
 
 #include "internal/plugins/knownaudiopluginsregister.h"
@@ -193,6 +194,7 @@ void AudioModule::onInit(const IApplication::RunMode& mode)
         Objects from different layers (threads) must interact only through:
             * Asynchronous API (@see thirdparty/deto) - controls and pass midi data
             * AudioBuffer - pass audio data from worker to driver for play
+            * AudioSignalsDispatcher - pass audio signal levels from worker to main (lock-free, coalesced)
 
         AudioEngine is in the worker and operates only with the buffer,
         in fact, it knows nothing about the data consumer, about the audio driver.
@@ -214,6 +216,8 @@ void AudioModule::onInit(const IApplication::RunMode& mode)
 
     m_audioOutputController->init();
 
+    AudioSignalsDispatcher::instance()->init();
+
     // Setup audio driver
     setupAudioDriver(mode);
 
@@ -238,6 +242,8 @@ void AudioModule::onDelayedInit()
 
 void AudioModule::onDeinit()
 {
+    AudioSignalsDispatcher::instance()->deinit();
+
     if (m_audioDriver->isOpened()) {
         m_audioDriver->close();
     }
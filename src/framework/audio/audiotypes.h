@@ -349,34 +349,24 @@ struct AudioSignalVal {
 
 using AudioSignalChanges = async::Channel<audioch_t, AudioSignalVal>;
 
-struct AudioSignalsNotifier {
-    void updateSignalValues(const audioch_t audioChNumber, const float newAmplitude, const volume_dbfs_t newPressure)
-    {
-        AudioSignalVal& signalVal = m_signalValuesMap[audioChNumber];
-
-        volume_dbfs_t validatedPressure = std::max(newPressure, MINIMUM_OPERABLE_DBFS_LEVEL);
-
-        if (RealIsEqual(signalVal.pressure, validatedPressure)) {
-            return;
-        }
+struct AudioRenderBenchmarkResult {
+    double renderedDurationSecs = 0.0;
+    double wallTimeMsecs = 0.0;
+    double realTimeFactor = 0.0; // rendered duration / wall time
 
-        if (std::abs(signalVal.pressure - validatedPressure) < PRESSURE_MINIMAL_VALUABLE_DIFF) {
-            return;
-        }
-
-        signalVal.amplitude = newAmplitude;
-        signalVal.pressure = validatedPressure;
-
-        audioSignalChanges.send(audioChNumber, signalVal);
-    }
+    samples_t blockSize = 0;
+    uint64_t blockCount = 0;
 
-    AudioSignalChanges audioSignalChanges;
+    // Render time per block, in microseconds
+    double blockTimeP50 = 0.0;
+    double blockTimeP90 = 0.0;
+    double blockTimeP99 = 0.0;
+    double blockTimeMax = 0.0;
 
-private:
-    static constexpr volume_dbfs_t PRESSURE_MINIMAL_VALUABLE_DIFF = 2.5f;
-    static constexpr volume_dbfs_t MINIMUM_OPERABLE_DBFS_LEVEL = -100.f;
+    // Negative if allocations are not counted in this build (see MUSE_MODULE_AUDIO_COUNT_ALLOCATIONS)
+    double allocationsPerBlock = -1.0;
 
-    std::map<audioch_t, AudioSignalVal> m_signalValuesMap;
+    std::map<TrackId, double> trackCpuTimeMsecs;
 };
 
 enum class PlaybackStatus {
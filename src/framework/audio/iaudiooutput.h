@@ -57,6 +57,9 @@ public:
 
     virtual Progress saveSoundTrackProgress(const TrackSequenceId sequenceId) = 0;
 
+    //! NOTE Renders the whole sequence offline (without an audio driver) and measures the engine performance
+    virtual async::Promise<AudioRenderBenchmarkResult> renderBenchmark(const TrackSequenceId sequenceId) = 0;
+
     virtual void clearAllFx() = 0;
 };
 
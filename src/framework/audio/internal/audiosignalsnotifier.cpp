@@ -0,0 +1,161 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "audiosignalsnotifier.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QTimer>
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::audio;
+
+AudioSignalsNotifier::AudioSignalsNotifier()
+    : m_stream(std::make_shared<AudioSignalsStream>())
+{
+    AudioSignalsDispatcher::instance()->registerStream(m_stream);
+}
+
+void AudioSignalsNotifier::setAudioChannelsCount(const audioch_t count)
+{
+    if (m_channels.size() != count) {
+        m_channels.resize(count);
+    }
+}
+
+void AudioSignalsNotifier::updateSignalValues(const audioch_t audioChNumber, const float newAmplitude, const volume_dbfs_t newPressure)
+{
+    IF_ASSERT_FAILED(audioChNumber < m_channels.size()) {
+        return;
+    }
+
+    ChannelState& state = m_channels[audioChNumber];
+
+    volume_dbfs_t validatedPressure = std::max(newPressure, MINIMUM_OPERABLE_DBFS_LEVEL);
+
+    if (RealIsEqual(state.published.pressure, validatedPressure)
+        || std::abs(state.published.pressure - validatedPressure) < PRESSURE_MINIMAL_VALUABLE_DIFF) {
+        //! NOTE The signal has returned to the published level, nothing to deliver
+        state.hasPending = false;
+    } else {
+        state.pending.amplitude = newAmplitude;
+        state.pending.pressure = validatedPressure;
+        state.hasPending = true;
+        m_hasPending = true;
+    }
+
+    if (!m_hasPending) {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (now - m_lastPublishTime < AUDIO_SIGNALS_DISPATCH_INTERVAL) {
+        return;
+    }
+
+    m_lastPublishTime = now;
+    publishPendingValues();
+}
+
+void AudioSignalsNotifier::publishPendingValues()
+{
+    m_hasPending = false;
+
+    for (audioch_t audioChNum = 0; audioChNum < m_channels.size(); ++audioChNum) {
+        ChannelState& state = m_channels[audioChNum];
+        if (!state.hasPending) {
+            continue;
+        }
+
+        //! NOTE If the main thread is not keeping up, keep the value and try again next time
+        if (!m_stream->queue.tryPush({ audioChNum, state.pending })) {
+            m_hasPending = true;
+            continue;
+        }
+
+        state.published = state.pending;
+        state.hasPending = false;
+    }
+}
+
+AudioSignalChanges AudioSignalsNotifier::audioSignalChanges() const
+{
+    return m_stream->audioSignalChanges;
+}
+
+AudioSignalsDispatcher* AudioSignalsDispatcher::instance()
+{
+    static AudioSignalsDispatcher s;
+    return &s;
+}
+
+void AudioSignalsDispatcher::init()
+{
+    m_timer = std::make_unique<QTimer>();
+    m_timer->setInterval(AUDIO_SIGNALS_DISPATCH_INTERVAL);
+
+    QObject::connect(m_timer.get(), &QTimer::timeout, [this]() {
+        dispatch();
+    });
+
+    m_timer->start();
+}
+
+void AudioSignalsDispatcher::deinit()
+{
+    m_timer.reset();
+}
+
+void AudioSignalsDispatcher::registerStream(const AudioSignalsStreamPtr& stream)
+{
+    std::lock_guard lock(m_streamsMutex);
+    m_streams.push_back(stream);
+}
+
+void AudioSignalsDispatcher::dispatch()
+{
+    std::vector<AudioSignalsStreamPtr> streams;
+
+    {
+        std::lock_guard lock(m_streamsMutex);
+        streams.reserve(m_streams.size());
+
+        for (auto it = m_streams.begin(); it != m_streams.end();) {
+            if (AudioSignalsStreamPtr stream = it->lock()) {
+                streams.push_back(std::move(stream));
+                ++it;
+            } else {
+                it = m_streams.erase(it);
+            }
+        }
+    }
+
+    AudioSignalMessage msg;
+
+    for (const AudioSignalsStreamPtr& stream : streams) {
+        while (stream->queue.tryPop(msg)) {
+            stream->audioSignalChanges.send(msg.audioChNumber, msg.signalVal);
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_AUDIO_AUDIOSIGNALSNOTIFIER_H
+#define MUSE_AUDIO_AUDIOSIGNALSNOTIFIER_H
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "global/concurrency/spscqueue.h"
+
+#include "audiotypes.h"
+
+class QTimer;
+
+namespace muse::audio {
+struct AudioSignalMessage {
+    audioch_t audioChNumber = 0;
+    AudioSignalVal signalVal;
+};
+
+//! NOTE Fixed-size signal messages travel from the worker thread (producer)
+//!      to the main thread (consumer) without locks and without going through the async queues
+struct AudioSignalsStream {
+    SpscQueue<AudioSignalMessage, 64> queue;
+    AudioSignalChanges audioSignalChanges;
+};
+
+using AudioSignalsStreamPtr = std::shared_ptr<AudioSignalsStream>;
+
+//! NOTE Interval at which signal values are delivered to the UI (~60 fps)
+static constexpr std::chrono::milliseconds AUDIO_SIGNALS_DISPATCH_INTERVAL(16);
+
+//! NOTE Worker side: coalesces per-block signal values and publishes them at most once per dispatch interval
+class AudioSignalsNotifier
+{
+public:
+    AudioSignalsNotifier();
+
+    //! NOTE Allocates only when the count changes, e.g. when the source of a track is replaced
+    void setAudioChannelsCount(const audioch_t count);
+    void updateSignalValues(const audioch_t audioChNumber, const float newAmplitude, const volume_dbfs_t newPressure);
+
+    AudioSignalChanges audioSignalChanges() const;
+
+private:
+    void publishPendingValues();
+
+    static constexpr volume_dbfs_t PRESSURE_MINIMAL_VALUABLE_DIFF = 2.5f;
+    static constexpr volume_dbfs_t MINIMUM_OPERABLE_DBFS_LEVEL = -100.f;
+
+    struct ChannelState {
+        AudioSignalVal published;
+        AudioSignalVal pending;
+        bool hasPending = false;
+    };
+
+    std::vector<ChannelState> m_channels;
+    bool m_hasPending = false;
+    std::chrono::steady_clock::time_point m_lastPublishTime;
+
+    AudioSignalsStreamPtr m_stream;
+};
+
+//! NOTE Main thread side: drains all signal streams and notifies the subscribers
+class AudioSignalsDispatcher
+{
+public:
+    static AudioSignalsDispatcher* instance();
+
+    void init();
+    void deinit();
+
+    void registerStream(const AudioSignalsStreamPtr& stream);
+    void dispatch();
+
+private:
+    AudioSignalsDispatcher() = default;
+
+    std::mutex m_streamsMutex;
+    std::vector<std::weak_ptr<AudioSignalsStream> > m_streams;
+
+    std::unique_ptr<QTimer> m_timer;
+};
+}
+
+#endif // MUSE_AUDIO_AUDIOSIGNALSNOTIFIER_H
@@ -24,15 +24,21 @@
 #define MUSE_AUDIO_SFCACHEDLOADER_H
 
 #include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
 
 #include <sfloader/fluid_sfont.h>
 #include <sfloader/fluid_defsfont.h>
+#include <sfloader/fluid_samplecache.h>
+
+#include "sfmappedfile.h"
 
 namespace muse::audio::synth {
 struct SoundFontData
 {
+    //! NOTE Presets are parsed only once per file, the parsed sound font is shared by all Fluid instances
     fluid_sfont_t* soundFontPtr = nullptr;
-    std::FILE* fileStream = nullptr;
 };
 
 struct SoundFontCache : public std::map<std::string, SoundFontData> {
@@ -42,11 +48,23 @@ struct SoundFontCache : public std::map<std::string, SoundFontData> {
         return &s;
     }
 
+    //! NOTE Sound fonts may be loaded by several Fluid instances at once
+    std::mutex mutex;
+
+    //! NOTE The samples of uncompressed sound fonts point into these mappings (see mapSoundFontData).
+    //!      They are members, so they are unmapped only after the sound fonts above have been deleted
+    std::map<std::string, MappedSoundFontFilePtr> mappedFiles;
+    std::mutex mappedFilesMutex;
+
 private:
     SoundFontCache() = default;
     ~SoundFontCache()
     {
         for (const auto& pair : *this) {
+            if (!pair.second.soundFontPtr) {
+                continue;
+            }
+
             fluid_defsfont_t* defsFont = static_cast<fluid_defsfont_t*>(fluid_sfont_get_data(pair.second.soundFontPtr));
 
             if (delete_fluid_defsfont(defsFont) != FLUID_OK) {
@@ -54,55 +72,74 @@ private:
             }
 
             delete_fluid_sfont(pair.second.soundFontPtr);
-
-            if (pair.second.fileStream) {
-                std::fclose(pair.second.fileStream);
-            }
         }
     }
 };
 
 void* openSoundFont(const char* filename)
 {
-    auto search = SoundFontCache::instance()->find(filename);
+    //! NOTE Every fopen() from Fluid gets its own stream, and so its own read position,
+    //!      so concurrent readers (e.g. dynamic sample loading) never disturb each other
+    return std::fopen(filename, "rb");
+}
 
-    if (search != SoundFontCache::instance()->cend()
-        && search->second.fileStream) {
-        return search->second.fileStream;
+int readSoundFont(void* buf, fluid_long_long_t count, void* handle)
+{
+    if (count < 0) {
+        return FLUID_FAILED;
     }
 
-    std::FILE* stream = std::fopen(filename, "r");
-
-    SoundFontData sfData;
-    sfData.fileStream = stream;
-
-    SoundFontCache::instance()->emplace(filename, std::move(sfData));
+    if (count == 0) {
+        return FLUID_OK;
+    }
 
-    return stream;
+    size_t read = std::fread(buf, static_cast<size_t>(count), 1, static_cast<std::FILE*>(handle));
+    return read == 1 ? FLUID_OK : FLUID_FAILED;
 }
 
-int readSoundFont(void* buf, fluid_long_long_t count, void* handle)
+int seekSoundFont(void* handle, fluid_long_long_t offset, int origin)
 {
-    return static_cast<int>(std::fread(buf, count, 1, static_cast<std::FILE*>(handle)));
+    //! NOTE long is 32-bit on Windows, sound fonts can be bigger than 2 GB
+#ifdef _WIN32
+    int ret = _fseeki64(static_cast<std::FILE*>(handle), static_cast<__int64>(offset), origin);
+#else
+    int ret = fseeko(static_cast<std::FILE*>(handle), static_cast<off_t>(offset), origin);
+#endif
+    return ret == 0 ? FLUID_OK : FLUID_FAILED;
 }
 
-int seekSoundFont(void* handle, fluid_long_long_t offset, int origin)
+int closeSoundFont(void* handle)
 {
-    return std::fseek(static_cast<std::FILE*>(handle), offset, origin);
+    return std::fclose(static_cast<std::FILE*>(handle)) == 0 ? FLUID_OK : FLUID_FAILED;
 }
 
-int closeSoundFont(void* /*handle*/)
+fluid_long_long_t tellSoundFont(void* handle)
 {
-    //!Note Prevent closing of sound-font files by Fluid instances,
-    //!     instead the actual closing of cached sound-font files will happen in SoundFontCache.
-    //!     However, we still need to provide "some" callback for Fluid's API
-
-    return FLUID_OK;
+#ifdef _WIN32
+    return static_cast<fluid_long_long_t>(_ftelli64(static_cast<std::FILE*>(handle)));
+#else
+    return static_cast<fluid_long_long_t>(ftello(static_cast<std::FILE*>(handle)));
+#endif
 }
 
-fluid_long_long_t tellSoundFont(void* handle)
+const void* mapSoundFontData(const char* filename, fluid_long_long_t offset, fluid_long_long_t size)
 {
-    return std::ftell(static_cast<std::FILE*>(handle));
+    SoundFontCache* cache = SoundFontCache::instance();
+    std::lock_guard lock(cache->mappedFilesMutex);
+
+    auto it = cache->mappedFiles.find(filename);
+    if (it == cache->mappedFiles.end()) {
+        //! NOTE A failed mapping is remembered too, the samples are then read by Fluid
+        it = cache->mappedFiles.emplace(filename, MappedSoundFontFile::map(filename)).first;
+    }
+
+    const MappedSoundFontFilePtr& file = it->second;
+    if (!file || offset < 0 || size <= 0 || static_cast<size_t>(offset) > file->size()
+        || static_cast<size_t>(size) > file->size() - static_cast<size_t>(offset)) {
+        return nullptr;
+    }
+
+    return file->data() + offset;
 }
 
 int deleteSoundFont(fluid_sfont_t* /*sfont*/)
@@ -124,8 +161,15 @@ static fluid_file_callbacks_t FILE_CALLBACKS {
 
 fluid_sfont_t* loadSoundFont(fluid_sfloader_t* loader, const char* filename)
 {
-    auto search = SoundFontCache::instance()->find(filename);
-    if (search != SoundFontCache::instance()->cend()) {
+    SoundFontCache* cache = SoundFontCache::instance();
+    std::lock_guard lock(cache->mutex);
+
+    //! NOTE Uncompressed samples are not read into buffers, they point into a mapping of the file shared by all Fluid instances.
+    //!      Fluid locks the samples of the selected presets in memory (synth.lock-memory), so playing them doesn't page fault
+    fluid_samplecache_set_map_func(mapSoundFontData);
+
+    auto search = cache->find(filename);
+    if (search != cache->cend() && search->second.soundFontPtr) {
         return search->second.soundFontPtr;
     }
 
@@ -157,7 +201,7 @@ fluid_sfont_t* loadSoundFont(fluid_sfloader_t* loader, const char* filename)
         return nullptr;
     }
 
-    SoundFontData& sfData = SoundFontCache::instance()->operator[](filename);
+    SoundFontData& sfData = cache->operator[](filename);
     sfData.soundFontPtr = result;
 
     return result;
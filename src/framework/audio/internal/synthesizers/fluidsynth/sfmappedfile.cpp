@@ -0,0 +1,151 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "sfmappedfile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "log.h"
+
+using namespace muse::audio::synth;
+
+#ifdef _WIN32
+static std::wstring toWideString(const std::string& str)
+{
+    int len = MultiByteToWideChar(CP_UTF8, 0, str.c_str(), static_cast<int>(str.size()), nullptr, 0);
+    std::wstring result(len, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, str.c_str(), static_cast<int>(str.size()), result.data(), len);
+    return result;
+}
+
+#endif
+
+MappedSoundFontFile::~MappedSoundFontFile()
+{
+#ifdef _WIN32
+    if (m_data) {
+        UnmapViewOfFile(m_data);
+    }
+
+    if (m_mappingHandle) {
+        CloseHandle(m_mappingHandle);
+    }
+
+    if (m_fileHandle && m_fileHandle != INVALID_HANDLE_VALUE) {
+        CloseHandle(m_fileHandle);
+    }
+#else
+    if (m_data) {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#endif
+}
+
+MappedSoundFontFilePtr MappedSoundFontFile::map(const std::string& filePath)
+{
+    std::shared_ptr<MappedSoundFontFile> file(new MappedSoundFontFile());
+
+#ifdef _WIN32
+    HANDLE fileHandle = CreateFileW(toWideString(filePath).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    file->m_fileHandle = fileHandle;
+
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        LOGE() << "failed to open sound font: " << filePath;
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+        LOGE() << "failed to get size of sound font: " << filePath;
+        return nullptr;
+    }
+
+    HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    file->m_mappingHandle = mappingHandle;
+
+    if (!mappingHandle) {
+        LOGE() << "failed to create mapping of sound font: " << filePath;
+        return nullptr;
+    }
+
+    void* data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        LOGE() << "failed to map sound font: " << filePath;
+        return nullptr;
+    }
+
+    file->m_data = static_cast<const uint8_t*>(data);
+    file->m_size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        LOGE() << "failed to open sound font: " << filePath;
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        LOGE() << "failed to get size of sound font: " << filePath;
+        ::close(fd);
+        return nullptr;
+    }
+
+    size_t size = static_cast<size_t>(st.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+
+    //! NOTE The mapping stays valid after the descriptor is closed
+    ::close(fd);
+
+    if (data == MAP_FAILED) {
+        LOGE() << "failed to map sound font: " << filePath;
+        return nullptr;
+    }
+
+#ifdef MADV_RANDOM
+    //! NOTE Samples are paged in on demand by presets, read-ahead of the whole sample chunk is useless
+    madvise(data, size, MADV_RANDOM);
+#endif
+
+    file->m_data = static_cast<const uint8_t*>(data);
+    file->m_size = size;
+#endif
+
+    return file;
+}
+
+const uint8_t* MappedSoundFontFile::data() const
+{
+    return m_data;
+}
+
+size_t MappedSoundFontFile::size() const
+{
+    return m_size;
+}
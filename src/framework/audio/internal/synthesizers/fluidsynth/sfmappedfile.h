@@ -0,0 +1,60 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUSE_AUDIO_SFMAPPEDFILE_H
+#define MUSE_AUDIO_SFMAPPEDFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace muse::audio::synth {
+//! NOTE Read-only memory mapping of a whole sound font file.
+//!      Fluid's samples point directly into the mapping instead of being read into their own buffers,
+//!      so the sample data is shared by all Fluid instances (and with the OS file cache)
+class MappedSoundFontFile
+{
+public:
+    ~MappedSoundFontFile();
+
+    static std::shared_ptr<MappedSoundFontFile> map(const std::string& filePath);
+
+    const uint8_t* data() const;
+    size_t size() const;
+
+private:
+    MappedSoundFontFile() = default;
+
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+#endif
+};
+
+using MappedSoundFontFilePtr = std::shared_ptr<MappedSoundFontFile>;
+}
+
+#endif // MUSE_AUDIO_SFMAPPEDFILE_H
@@ -28,6 +28,7 @@
 #include "internal/audiosanitizer.h"
 #include "internal/audiothread.h"
 #include "internal/worker/audioengine.h"
+#include "internal/worker/renderbenchmark.h"
 #include "audioerrors.h"
 
 #include "muse_framework_config.h"
@@ -245,6 +246,32 @@ Progress AudioOutputHandler::saveSoundTrackProgress(const TrackSequenceId sequen
     return m_saveSoundTracksProgressMap[sequenceId];
 }
 
+Promise<AudioRenderBenchmarkResult> AudioOutputHandler::renderBenchmark(const TrackSequenceId sequenceId)
+{
+    return Promise<AudioRenderBenchmarkResult>([this, sequenceId](auto resolve, auto reject) {
+        ONLY_AUDIO_WORKER_THREAD;
+
+        IF_ASSERT_FAILED(mixer()) {
+            return reject(static_cast<int>(Err::Undefined), "undefined reference to a mixer");
+        }
+
+        ITrackSequencePtr s = sequence(sequenceId);
+        if (!s) {
+            return reject(static_cast<int>(Err::InvalidSequenceId), "invalid sequence id");
+        }
+
+        s->player()->stop();
+        s->player()->seek(0);
+
+        RenderBenchmark benchmark(mixer(), s->player()->duration(), configuration()->renderStep());
+        AudioRenderBenchmarkResult result = benchmark.run();
+
+        s->player()->seek(0);
+
+        return resolve(std::move(result));
+    }, AudioThread::ID);
+}
+
 void AudioOutputHandler::clearAllFx()
 {
     fxResolver()->clearAllFx();
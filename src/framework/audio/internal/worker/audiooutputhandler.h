@@ -27,6 +27,7 @@
 #include "global/async/asyncable.h"
 
 #include "ifxresolver.h"
+#include "iaudioconfiguration.h"
 #include "iaudiooutput.h"
 #include "igettracksequence.h"
 
@@ -41,6 +42,7 @@ using SoundTrackWriterPtr = std::shared_ptr<SoundTrackWriter>;
 class AudioOutputHandler : public IAudioOutput, public Injectable, public async::Asyncable
 {
     Inject<fx::IFxResolver> fxResolver = { this };
+    Inject<IAudioConfiguration> configuration = { this };
 
 public:
     explicit AudioOutputHandler(IGetTrackSequence* getSequence, const muse::modularity::ContextPtr& iocCtx);
@@ -65,6 +67,8 @@ public:
 
     Progress saveSoundTrackProgress(const TrackSequenceId sequenceId) override;
 
+    async::Promise<AudioRenderBenchmarkResult> renderBenchmark(const TrackSequenceId sequenceId) override;
+
     void clearAllFx() override;
 
 private:
@@ -0,0 +1,101 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "mixbus.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "realfn.h"
+
+using namespace muse;
+using namespace muse::audio;
+
+static constexpr size_t CACHE_LINE_SIZE = 64;
+static constexpr size_t FLOATS_PER_CACHE_LINE = CACHE_LINE_SIZE / sizeof(float);
+
+void TrackSlotBuffer::resize(size_t slotCount, size_t slotSize)
+{
+    const size_t slotStride = (slotSize + FLOATS_PER_CACHE_LINE - 1) / FLOATS_PER_CACHE_LINE * FLOATS_PER_CACHE_LINE;
+    const size_t requiredSize = slotCount * slotStride + FLOATS_PER_CACHE_LINE;
+
+    if (m_data.size() < requiredSize) {
+        m_data.assign(requiredSize, 0.f);
+
+        uintptr_t address = reinterpret_cast<uintptr_t>(m_data.data());
+        uintptr_t alignedAddress = (address + CACHE_LINE_SIZE - 1) & ~(uintptr_t(CACHE_LINE_SIZE) - 1);
+        m_begin = m_data.data() + (alignedAddress - address) / sizeof(float);
+    }
+
+    m_slotCount = slotCount;
+    m_slotSize = slotSize;
+    m_slotStride = slotStride;
+}
+
+size_t TrackSlotBuffer::slotCount() const
+{
+    return m_slotCount;
+}
+
+size_t TrackSlotBuffer::slotSize() const
+{
+    return m_slotSize;
+}
+
+float* TrackSlotBuffer::slot(size_t idx)
+{
+    return m_begin + idx * m_slotStride;
+}
+
+const float* TrackSlotBuffer::slot(size_t idx) const
+{
+    return m_begin + idx * m_slotStride;
+}
+
+void TrackSlotBuffer::clearSlot(size_t idx)
+{
+    float* begin = slot(idx);
+    std::fill(begin, begin + m_slotSize, 0.f);
+}
+
+bool muse::audio::mixTrackIntoBuses(const float* trackBuffer, size_t bufferSize, float* masterBuffer, const AuxSendTarget* auxTargets,
+                                    size_t auxTargetCount)
+{
+    bool isSilent = true;
+
+    for (size_t idx = 0; idx < bufferSize; ++idx) {
+        const float sample = trackBuffer[idx];
+
+        if (masterBuffer) {
+            masterBuffer[idx] += sample;
+        }
+
+        for (size_t auxIdx = 0; auxIdx < auxTargetCount; ++auxIdx) {
+            auxTargets[auxIdx].buffer[idx] += sample * auxTargets[auxIdx].signalAmount;
+        }
+
+        if (isSilent && !RealIsNull(sample)) {
+            isSilent = false;
+        }
+    }
+
+    return isSilent;
+}
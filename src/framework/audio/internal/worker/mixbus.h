@@ -0,0 +1,65 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_AUDIO_MIXBUS_H
+#define MUSE_AUDIO_MIXBUS_H
+
+#include <cstddef>
+#include <vector>
+
+namespace muse::audio {
+//! NOTE Contiguous storage for the rendered blocks of all mixer tracks.
+//!      Every track renders directly into its own slot; slots start on a cache line boundary
+//!      so that tracks processed on different threads never share a cache line
+class TrackSlotBuffer
+{
+public:
+    //! NOTE Reallocates only when the requested storage is larger than the current one
+    void resize(size_t slotCount, size_t slotSize);
+
+    size_t slotCount() const;
+    size_t slotSize() const;
+
+    float* slot(size_t idx);
+    const float* slot(size_t idx) const;
+
+    void clearSlot(size_t idx);
+
+private:
+    std::vector<float> m_data;
+    float* m_begin = nullptr;
+    size_t m_slotCount = 0;
+    size_t m_slotSize = 0;
+    size_t m_slotStride = 0;
+};
+
+struct AuxSendTarget {
+    float* buffer = nullptr;
+    float signalAmount = 0.f;
+};
+
+//! NOTE Adds a rendered track block to the master buffer and to all the aux send buffers in a single pass.
+//!      The master buffer may be null. Returns true if the track block is silent
+bool mixTrackIntoBuses(const float* trackBuffer, size_t bufferSize, float* masterBuffer, const AuxSendTarget* auxTargets,
+                       size_t auxTargetCount);
+}
+
+#endif // MUSE_AUDIO_MIXBUS_H
@@ -92,6 +92,7 @@ RetVal<MixerChannelPtr> Mixer::addChannel(const TrackId trackId, ITrackAudioInpu
     });
 
     m_trackChannels.emplace(trackId, channel);
+    updateTrackSlots();
 
     result.val = m_trackChannels[trackId];
     result.ret = make_ret(Ret::Code::Ok);
@@ -111,6 +112,9 @@ RetVal<MixerChannelPtr> Mixer::addAuxChannel(const TrackId trackId)
 
     m_auxChannelInfoList.emplace_back(std::move(aux));
 
+    m_auxSendTargets.reserve(m_auxChannelInfoList.size());
+    m_auxSendTargetChannels.reserve(m_auxChannelInfoList.size());
+
     RetVal<MixerChannelPtr> result;
     result.val = channel;
     result.ret = make_ret(Ret::Code::Ok);
@@ -130,6 +134,7 @@ Ret Mixer::removeChannel(const TrackId trackId)
         }
 
         m_trackChannels.erase(trackId);
+        updateTrackSlots();
         return make_ret(Ret::Code::Ok);
     }
 
@@ -178,37 +183,49 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
     size_t outBufferSize = samplesPerChannel * m_audioChannelsCount;
     std::fill(outBuffer, outBuffer + outBufferSize, 0.f);
 
-    if (m_writeCacheBuff.size() != outBufferSize) {
-        m_writeCacheBuff.resize(outBufferSize, 0.f);
-    }
-
     if (m_isIdle && m_tracksToProcessWhenIdle.empty() && m_isSilence) {
         notifyNoAudioSignal();
         return 0;
     }
 
-    TracksData tracksData;
-    processTrackChannels(outBufferSize, samplesPerChannel, tracksData);
+    processTrackChannels(outBufferSize, samplesPerChannel);
 
     prepareAuxBuffers(outBufferSize);
 
     samples_t masterChannelSampleCount = 0;
 
-    for (auto& pair : tracksData) {
-        const std::vector<float>& trackBuffer = pair.second;
+    for (size_t slotIdx = 0; slotIdx < m_trackSlots.size(); ++slotIdx) {
+        const TrackSlot& slot = m_trackSlots[slotIdx];
+        if (!slot.rendered) {
+            continue;
+        }
 
-        bool outBufferIsSilent = false;
-        mixOutputFromChannel(outBuffer, trackBuffer.data(), samplesPerChannel, outBufferIsSilent);
         masterChannelSampleCount = std::max(samplesPerChannel, masterChannelSampleCount);
 
-        if (!outBufferIsSilent) {
-            m_isSilence = false;
-        } else if (m_isSilence) {
+        if (m_masterParams.muted) {
+            continue;
+        }
+
+        const float* trackBuffer = m_trackSlotBuffer.slot(slotIdx);
+        size_t auxTargetCount = prepareAuxSendTargets(slot.channel->outputParams().auxSends);
+
+        if (!m_isSilence) {
+            mixTrackIntoBuses(trackBuffer, outBufferSize, outBuffer, m_auxSendTargets.data(), auxTargetCount);
+            markAuxSendTargetsReceivedSignal(auxTargetCount);
             continue;
         }
 
-        const AuxSendsParams& auxSends = m_trackChannels.at(pair.first)->outputParams().auxSends;
-        writeTrackToAuxBuffers(trackBuffer.data(), auxSends, samplesPerChannel);
+        //! NOTE While the mixer is silent, silent tracks are not sent to the aux channels,
+        //!      so the track has to be checked before its aux sends are written
+        bool trackIsSilent = mixTrackIntoBuses(trackBuffer, outBufferSize, outBuffer, nullptr, 0);
+        if (trackIsSilent) {
+            continue;
+        }
+
+        m_isSilence = false;
+
+        mixTrackIntoBuses(trackBuffer, outBufferSize, nullptr, m_auxSendTargets.data(), auxTargetCount);
+        markAuxSendTargetsReceivedSignal(auxTargetCount);
     }
 
     if (m_masterParams.muted || masterChannelSampleCount == 0 || m_isSilence) {
@@ -228,57 +245,59 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
     return masterChannelSampleCount;
 }
 
-void Mixer::processTrackChannels(size_t outBufferSize, size_t samplesPerChannel, TracksData& outTracksData)
+void Mixer::updateTrackSlots()
 {
-    auto processChannel = [outBufferSize, samplesPerChannel](MixerChannelPtr channel) -> std::vector<float> {
-        thread_local std::vector<float> buffer(outBufferSize, 0.f);
-        thread_local std::vector<float> silent_buffer(outBufferSize, 0.f);
+    m_trackSlots.clear();
+    m_trackSlots.reserve(m_trackChannels.size());
+
+    for (const auto& pair : m_trackChannels) {
+        TrackSlot slot;
+        slot.channel = pair.second.get();
+        m_trackSlots.push_back(slot);
+    }
 
-        buffer = silent_buffer;
+    m_trackFutures.reserve(m_trackSlots.size());
+}
 
-        if (channel) {
-            channel->process(buffer.data(), samplesPerChannel);
-        }
+void Mixer::processTrackChannels(size_t outBufferSize, samples_t samplesPerChannel)
+{
+    m_trackSlotBuffer.resize(m_trackSlots.size(), outBufferSize);
 
-        return buffer;
+    auto processChannel = [this, samplesPerChannel](size_t slotIdx) {
+        m_trackSlotBuffer.clearSlot(slotIdx);
+        m_trackSlots[slotIdx].channel->process(m_trackSlotBuffer.slot(slotIdx), samplesPerChannel);
     };
 
     bool filterTracks = m_isIdle && !m_tracksToProcessWhenIdle.empty();
+    bool multithreading = useMultithreading();
 
-    if (useMultithreading()) {
-        std::map<TrackId, std::future<std::vector<float> > > futures;
-
-        for (const auto& pair : m_trackChannels) {
-            if (filterTracks && !muse::contains(m_tracksToProcessWhenIdle, pair.second->trackId())) {
-                continue;
-            }
-
-            if (pair.second->muted()) {
-                pair.second->notifyNoAudioSignal();
-                continue;
-            }
+    for (size_t slotIdx = 0; slotIdx < m_trackSlots.size(); ++slotIdx) {
+        TrackSlot& slot = m_trackSlots[slotIdx];
+        slot.rendered = false;
 
-            std::future<std::vector<float> > future = TaskScheduler::instance()->submit(processChannel, pair.second);
-            futures.emplace(pair.first, std::move(future));
+        if (filterTracks && !muse::contains(m_tracksToProcessWhenIdle, slot.channel->trackId())) {
+            continue;
         }
 
-        for (auto& pair : futures) {
-            outTracksData.emplace(pair.first, pair.second.get());
+        if (slot.channel->muted()) {
+            slot.channel->notifyNoAudioSignal();
+            continue;
         }
-    } else {
-        for (const auto& pair : m_trackChannels) {
-            if (filterTracks && !muse::contains(m_tracksToProcessWhenIdle, pair.second->trackId())) {
-                continue;
-            }
 
-            if (pair.second->muted()) {
-                pair.second->notifyNoAudioSignal();
-                continue;
-            }
+        slot.rendered = true;
 
-            outTracksData.emplace(pair.first, processChannel(pair.second));
+        if (multithreading) {
+            m_trackFutures.push_back(TaskScheduler::instance()->submit(processChannel, slotIdx));
+        } else {
+            processChannel(slotIdx);
         }
     }
+
+    for (std::future<void>& future : m_trackFutures) {
+        future.get();
+    }
+
+    m_trackFutures.clear();
 }
 
 bool Mixer::useMultithreading() const
@@ -388,7 +407,7 @@ Channel<AudioOutputParams> Mixer::masterOutputParamsChanged() const
 
 async::Channel<audioch_t, AudioSignalVal> Mixer::masterAudioSignalChanges() const
 {
-    return m_audioSignalNotifier.audioSignalChanges;
+    return m_audioSignalNotifier.audioSignalChanges();
 }
 
 void Mixer::setIsIdle(bool idle)
@@ -410,6 +429,28 @@ void Mixer::setTracksToProcessWhenIdle(std::unordered_set<TrackId>&& trackIds)
     m_tracksToProcessWhenIdle = std::move(trackIds);
 }
 
+void Mixer::setTrackProcessTimeMeasuringEnabled(bool enabled)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    for (const auto& pair : m_trackChannels) {
+        pair.second->setProcessTimeMeasuringEnabled(enabled);
+    }
+}
+
+std::map<TrackId, std::chrono::nanoseconds> Mixer::trackProcessTimes() const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    std::map<TrackId, std::chrono::nanoseconds> result;
+
+    for (const auto& pair : m_trackChannels) {
+        result.emplace(pair.first, pair.second->processTime());
+    }
+
+    return result;
+}
+
 void Mixer::mixOutputFromChannel(float* outBuffer, const float* inBuffer, unsigned int samplesCount, bool& outBufferIsSilent)
 {
     IF_ASSERT_FAILED(outBuffer && inBuffer) {
@@ -453,8 +494,11 @@ void Mixer::prepareAuxBuffers(size_t outBufferSize)
     }
 }
 
-void Mixer::writeTrackToAuxBuffers(const float* trackBuffer, const AuxSendsParams& auxSends, samples_t samplesPerChannel)
+size_t Mixer::prepareAuxSendTargets(const AuxSendsParams& auxSends)
 {
+    m_auxSendTargets.clear();
+    m_auxSendTargetChannels.clear();
+
     for (aux_channel_idx_t auxIdx = 0; auxIdx < auxSends.size(); ++auxIdx) {
         if (auxIdx >= m_auxChannelInfoList.size()) {
             break;
@@ -470,18 +514,21 @@ void Mixer::writeTrackToAuxBuffers(const float* trackBuffer, const AuxSendsParam
             continue;
         }
 
-        float* auxBuffer = aux.buffer.data();
-        float signalAmount = auxSend.signalAmount;
+        AuxSendTarget target;
+        target.buffer = aux.buffer.data();
+        target.signalAmount = auxSend.signalAmount;
 
-        for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
-            for (samples_t s = 0; s < samplesPerChannel; ++s) {
-                int idx = s * m_audioChannelsCount + audioChNum;
+        m_auxSendTargets.push_back(target);
+        m_auxSendTargetChannels.push_back(&aux);
+    }
 
-                auxBuffer[idx] += trackBuffer[idx] * signalAmount;
-            }
-        }
+    return m_auxSendTargets.size();
+}
 
-        aux.receivedAudioSignal = true;
+void Mixer::markAuxSendTargetsReceivedSignal(size_t auxTargetCount)
+{
+    for (size_t i = 0; i < auxTargetCount; ++i) {
+        m_auxSendTargetChannels[i]->receivedAudioSignal = true;
     }
 }
 
@@ -552,6 +599,7 @@ void Mixer::notifyNoAudioSignal()
 
 void Mixer::notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const
 {
+    m_audioSignalNotifier.setAudioChannelsCount(m_audioChannelsCount);
     m_audioSignalNotifier.updateSignalValues(audioChannelNumber, linearRms, dsp::dbFromSample(linearRms));
 }
 
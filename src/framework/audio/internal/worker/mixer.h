@@ -22,6 +22,7 @@
 #ifndef MUSE_AUDIO_MIXER_H
 #define MUSE_AUDIO_MIXER_H
 
+#include <future>
 #include <memory>
 #include <map>
 
@@ -31,6 +32,7 @@
 
 #include "abstractaudiosource.h"
 #include "mixerchannel.h"
+#include "mixbus.h"
 #include "internal/dsp/limiter.h"
 #include "ifxresolver.h"
 #include "iaudioconfiguration.h"
@@ -67,6 +69,9 @@ public:
     void setIsIdle(bool idle);
     void setTracksToProcessWhenIdle(std::unordered_set<TrackId>&& trackIds);
 
+    void setTrackProcessTimeMeasuringEnabled(bool enabled);
+    std::map<TrackId, std::chrono::nanoseconds> trackProcessTimes() const;
+
     // IAudioSource
     void setSampleRate(unsigned int sampleRate) override;
     unsigned int audioChannelsCount() const override;
@@ -74,12 +79,12 @@ public:
     void setIsActive(bool arg) override;
 
 private:
-    using TracksData = std::map<TrackId, std::vector<float> >;
-
-    void processTrackChannels(size_t outBufferSize, size_t samplesPerChannel, TracksData& outTracksData);
+    void updateTrackSlots();
+    void processTrackChannels(size_t outBufferSize, samples_t samplesPerChannel);
     void mixOutputFromChannel(float* outBuffer, const float* inBuffer, unsigned int samplesCount, bool& outBufferIsSilent);
     void prepareAuxBuffers(size_t outBufferSize);
-    void writeTrackToAuxBuffers(const float* trackBuffer, const AuxSendsParams& auxSends, samples_t samplesPerChannel);
+    size_t prepareAuxSendTargets(const AuxSendsParams& auxSends);
+    void markAuxSendTargetsReceivedSignal(size_t auxTargetCount);
     void processAuxChannels(float* buffer, samples_t samplesPerChannel);
     void completeOutput(float* buffer, samples_t samplesPerChannel);
 
@@ -93,8 +98,6 @@ private:
     size_t m_minTrackCountForMultithreading = 0;
     size_t m_nonMutedTrackCount = 0;
 
-    std::vector<float> m_writeCacheBuff;
-
     AudioOutputParams m_masterParams;
     async::Channel<AudioOutputParams> m_masterOutputParamsChanged;
     std::vector<IFxProcessorPtr> m_masterFxProcessors = {};
@@ -110,6 +113,19 @@ private:
 
     std::vector<AuxChannelInfo> m_auxChannelInfoList;
 
+    //! NOTE Tracks in the m_trackChannels order; the track with index i renders into the slot i
+    struct TrackSlot {
+        MixerChannel* channel = nullptr;
+        bool rendered = false;
+    };
+
+    std::vector<TrackSlot> m_trackSlots;
+    TrackSlotBuffer m_trackSlotBuffer;
+    std::vector<std::future<void> > m_trackFutures;
+
+    std::vector<AuxSendTarget> m_auxSendTargets;
+    std::vector<AuxChannelInfo*> m_auxSendTargetChannels;
+
     dsp::LimiterPtr m_limiter = nullptr;
 
     std::set<IClockPtr> m_clocks;
@@ -138,7 +138,7 @@ async::Channel<AudioOutputParams> MixerChannel::outputParamsChanged() const
 
 async::Channel<audioch_t, AudioSignalVal> MixerChannel::audioSignalChanges() const
 {
-    return m_audioSignalNotifier.audioSignalChanges;
+    return m_audioSignalNotifier.audioSignalChanges();
 }
 
 bool MixerChannel::isActive() const
@@ -188,6 +188,32 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
+    if (!m_measureProcessTime) {
+        return doProcess(buffer, samplesPerChannel);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    samples_t processedSamplesCount = doProcess(buffer, samplesPerChannel);
+    m_processTime += std::chrono::steady_clock::now() - start;
+
+    return processedSamplesCount;
+}
+
+void MixerChannel::setProcessTimeMeasuringEnabled(bool enabled)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    m_measureProcessTime = enabled;
+    m_processTime = std::chrono::nanoseconds(0);
+}
+
+std::chrono::nanoseconds MixerChannel::processTime() const
+{
+    return m_processTime;
+}
+
+samples_t MixerChannel::doProcess(float* buffer, samples_t samplesPerChannel)
+{
     samples_t processedSamplesCount = samplesPerChannel;
 
     if (m_audioSource && !m_params.muted) {
@@ -259,5 +285,6 @@ void MixerChannel::notifyNoAudioSignal()
 
 void MixerChannel::notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const
 {
+    m_audioSignalNotifier.setAudioChannelsCount(audioChannelsCount());
     m_audioSignalNotifier.updateSignalValues(audioChannelNumber, linearRms, dsp::dbFromSample(linearRms));
 }
@@ -22,6 +22,8 @@
 #ifndef MUSE_AUDIO_MIXERCHANNEL_H
 #define MUSE_AUDIO_MIXERCHANNEL_H
 
+#include <chrono>
+
 #include "global/modularity/ioc.h"
 #include "global/async/asyncable.h"
 #include "global/async/notification.h"
@@ -30,6 +32,7 @@
 #include "ifxprocessor.h"
 #include "track.h"
 #include "internal/dsp/compressor.h"
+#include "internal/audiosignalsnotifier.h"
 
 namespace muse::audio {
 class MixerChannel : public ITrackAudioOutput, public async::Asyncable
@@ -62,7 +65,11 @@ public:
     async::Channel<unsigned int> audioChannelsCountChanged() const override;
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
 
+    void setProcessTimeMeasuringEnabled(bool enabled);
+    std::chrono::nanoseconds processTime() const;
+
 private:
+    samples_t doProcess(float* buffer, samples_t samplesPerChannel);
     void completeOutput(float* buffer, unsigned int samplesCount) const;
     void notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const;
 
@@ -80,6 +87,9 @@ private:
     async::Notification m_mutedChanged;
     mutable async::Channel<AudioOutputParams> m_paramsChanges;
     mutable AudioSignalsNotifier m_audioSignalNotifier;
+
+    bool m_measureProcessTime = false;
+    std::chrono::nanoseconds m_processTime { 0 };
 };
 
 using MixerChannelPtr = std::shared_ptr<MixerChannel>;
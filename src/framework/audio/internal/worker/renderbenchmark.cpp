@@ -0,0 +1,175 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "renderbenchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "global/defer.h"
+
+#include "internal/audiosanitizer.h"
+#include "audioengine.h"
+#include "mixer.h"
+
+#include "muse_framework_config.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::audio;
+
+#ifdef MUSE_MODULE_AUDIO_COUNT_ALLOCATIONS
+//! NOTE Only allocations made by a thread that explicitly enabled counting are taken into account
+static std::atomic<uint64_t> s_allocationCount = 0;
+static thread_local bool s_countAllocations = false;
+
+void* operator new(std::size_t size)
+{
+    if (s_countAllocations) {
+        s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+static void setAllocationCountingEnabled(bool enabled)
+{
+    s_countAllocations = enabled;
+}
+
+static uint64_t allocationCount()
+{
+    return s_allocationCount.load(std::memory_order_relaxed);
+}
+
+#endif
+
+static double percentile(const std::vector<double>& sortedValues, double p)
+{
+    if (sortedValues.empty()) {
+        return 0.0;
+    }
+
+    size_t idx = static_cast<size_t>(p * static_cast<double>(sortedValues.size() - 1) + 0.5);
+    return sortedValues[std::min(idx, sortedValues.size() - 1)];
+}
+
+RenderBenchmark::RenderBenchmark(std::shared_ptr<Mixer> mixer, msecs_t totalDuration, samples_t renderStep)
+    : m_mixer(std::move(mixer)), m_totalDuration(totalDuration), m_renderStep(renderStep)
+{
+}
+
+AudioRenderBenchmarkResult RenderBenchmark::run()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    AudioRenderBenchmarkResult result;
+
+    IF_ASSERT_FAILED(m_mixer && m_renderStep > 0) {
+        return result;
+    }
+
+    const sample_rate_t sampleRate = AudioEngine::instance()->sampleRate();
+    const samples_t totalSamples = static_cast<samples_t>(m_totalDuration) * sampleRate / 1000000;
+    const uint64_t blockCount = (totalSamples + m_renderStep - 1) / m_renderStep;
+
+    std::vector<float> buffer(m_renderStep * m_mixer->audioChannelsCount(), 0.f);
+    std::vector<double> blockTimes;
+    blockTimes.reserve(blockCount);
+
+    AudioEngine::instance()->setMode(RenderMode::OfflineMode);
+    m_mixer->setIsActive(true);
+    m_mixer->setTrackProcessTimeMeasuringEnabled(true);
+
+    DEFER {
+        m_mixer->setTrackProcessTimeMeasuringEnabled(false);
+        m_mixer->setIsActive(false);
+        AudioEngine::instance()->setMode(RenderMode::IdleMode);
+    };
+
+#ifdef MUSE_MODULE_AUDIO_COUNT_ALLOCATIONS
+    const uint64_t allocationsBefore = allocationCount();
+    setAllocationCountingEnabled(true);
+#endif
+
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point renderStart = Clock::now();
+
+    for (uint64_t block = 0; block < blockCount; ++block) {
+        const Clock::time_point blockStart = Clock::now();
+
+        m_mixer->process(buffer.data(), m_renderStep);
+
+        const std::chrono::duration<double, std::micro> blockTime = Clock::now() - blockStart;
+        blockTimes.push_back(blockTime.count());
+    }
+
+    const std::chrono::duration<double, std::milli> wallTime = Clock::now() - renderStart;
+
+#ifdef MUSE_MODULE_AUDIO_COUNT_ALLOCATIONS
+    setAllocationCountingEnabled(false);
+
+    if (blockCount > 0) {
+        result.allocationsPerBlock = static_cast<double>(allocationCount() - allocationsBefore) / static_cast<double>(blockCount);
+    }
+#endif
+
+    result.blockSize = m_renderStep;
+    result.blockCount = blockCount;
+    result.renderedDurationSecs = static_cast<double>(blockCount * m_renderStep) / static_cast<double>(sampleRate);
+    result.wallTimeMsecs = wallTime.count();
+
+    if (result.wallTimeMsecs > 0.0) {
+        result.realTimeFactor = result.renderedDurationSecs * 1000.0 / result.wallTimeMsecs;
+    }
+
+    std::sort(blockTimes.begin(), blockTimes.end());
+    result.blockTimeP50 = percentile(blockTimes, 0.5);
+    result.blockTimeP90 = percentile(blockTimes, 0.9);
+    result.blockTimeP99 = percentile(blockTimes, 0.99);
+    result.blockTimeMax = blockTimes.empty() ? 0.0 : blockTimes.back();
+
+    for (const auto& pair : m_mixer->trackProcessTimes()) {
+        const std::chrono::duration<double, std::milli> trackTime = pair.second;
+        result.trackCpuTimeMsecs.emplace(pair.first, trackTime.count());
+    }
+
+    return result;
+}
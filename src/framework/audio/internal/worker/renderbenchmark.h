@@ -0,0 +1,48 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_AUDIO_RENDERBENCHMARK_H
+#define MUSE_AUDIO_RENDERBENCHMARK_H
+
+#include <memory>
+
+#include "audiotypes.h"
+
+namespace muse::audio {
+class Mixer;
+
+//! NOTE Pulls the mixer in the offline mode as fast as possible, no audio driver is involved,
+//!      and measures the time spent on every block and on every track
+class RenderBenchmark
+{
+public:
+    RenderBenchmark(std::shared_ptr<Mixer> mixer, msecs_t totalDuration, samples_t renderStep);
+
+    AudioRenderBenchmarkResult run();
+
+private:
+    std::shared_ptr<Mixer> m_mixer;
+    msecs_t m_totalDuration = 0;
+    samples_t m_renderStep = 0;
+};
+}
+
+#endif // MUSE_AUDIO_RENDERBENCHMARK_H
@@ -0,0 +1,331 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+
+#include "audio/internal/audiosanitizer.h"
+#include "audio/internal/dsp/audiomathutils.h"
+#include "audio/internal/worker/mixbus.h"
+#include "audio/internal/worker/mixer.h"
+
+#include "tests/mocks/audioconfigurationmock.h"
+
+using ::testing::Return;
+using ::testing::NiceMock;
+
+using namespace muse;
+using namespace muse::audio;
+
+namespace muse::audio {
+static constexpr audioch_t AUDIO_CHANNELS_COUNT = 2;
+
+//! NOTE Plays the same buffer on every process() call
+class TestTrackInput : public ITrackAudioInput
+{
+public:
+    explicit TestTrackInput(std::vector<float> buffer)
+        : m_buffer(std::move(buffer)) {}
+
+    bool isActive() const override { return m_active; }
+    void setIsActive(bool arg) override { m_active = arg; }
+    void setSampleRate(unsigned int) override {}
+    unsigned int audioChannelsCount() const override { return AUDIO_CHANNELS_COUNT; }
+    async::Channel<unsigned int> audioChannelsCountChanged() const override { return m_audioChannelsCountChanged; }
+
+    samples_t process(float* buffer, samples_t samplesPerChannel) override
+    {
+        std::copy(m_buffer.begin(), m_buffer.begin() + samplesPerChannel * AUDIO_CHANNELS_COUNT, buffer);
+        return samplesPerChannel;
+    }
+
+    void seek(const msecs_t) override {}
+    const AudioInputParams& inputParams() const override { return m_params; }
+    void applyInputParams(const AudioInputParams& params) override { m_params = params; }
+    async::Channel<AudioInputParams> inputParamsChanged() const override { return m_paramsChanged; }
+
+private:
+    std::vector<float> m_buffer;
+    bool m_active = true;
+    AudioInputParams m_params;
+    async::Channel<unsigned int> m_audioChannelsCountChanged;
+    async::Channel<AudioInputParams> m_paramsChanged;
+};
+
+//! NOTE Aux channels receive sends only when they have effects, this one leaves the signal as is
+class PassThroughFx : public IFxProcessor
+{
+public:
+    explicit PassThroughFx(const AudioFxParams& params)
+        : m_params(params) {}
+
+    AudioFxType type() const override { return AudioFxType::MuseFx; }
+    const AudioFxParams& params() const override { return m_params; }
+    async::Channel<AudioFxParams> paramsChanged() const override { return m_paramsChanged; }
+    void setSampleRate(unsigned int) override {}
+    bool active() const override { return m_params.active; }
+    void setActive(bool active) override { m_params.active = active; }
+    void process(float*, unsigned int) override {}
+
+private:
+    AudioFxParams m_params;
+    async::Channel<AudioFxParams> m_paramsChanged;
+};
+
+class PassThroughFxResolver : public fx::IFxResolver
+{
+public:
+    std::vector<IFxProcessorPtr> resolveMasterFxList(const AudioFxChain&) override { return {}; }
+
+    std::vector<IFxProcessorPtr> resolveFxList(const TrackId, const AudioFxChain& fxChain) override
+    {
+        std::vector<IFxProcessorPtr> result;
+        for (const auto& pair : fxChain) {
+            result.push_back(std::make_shared<PassThroughFx>(pair.second));
+        }
+
+        return result;
+    }
+
+    AudioResourceMetaList resolveAvailableResources() const override { return {}; }
+    void registerResolver(const AudioFxType, IResolverPtr) override {}
+    void clearAllFx() override {}
+};
+
+class Audio_MixBusTest : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        AudioSanitizer::setupWorkerThread();
+
+        m_configuration = std::make_shared<NiceMock<AudioConfigurationMock> >();
+        ON_CALL(*m_configuration, audioChannelsCount()).WillByDefault(Return(AUDIO_CHANNELS_COUNT));
+        //! NOTE The tracks are rendered on this thread
+        ON_CALL(*m_configuration, minTrackCountForMultithreading()).WillByDefault(Return(std::numeric_limits<size_t>::max()));
+
+        modularity::globalIoc()->registerExport<IAudioConfiguration>("utests", m_configuration);
+        modularity::globalIoc()->registerExport<fx::IFxResolver>("utests", std::make_shared<PassThroughFxResolver>());
+
+        m_mixer = std::make_shared<Mixer>();
+        m_mixer->setAudioChannelsCount(AUDIO_CHANNELS_COUNT);
+        m_mixer->setSampleRate(48000);
+    }
+
+    void TearDown() override
+    {
+        m_mixer.reset();
+
+        modularity::globalIoc()->unregister<fx::IFxResolver>("utests");
+        modularity::globalIoc()->unregister<IAudioConfiguration>("utests");
+    }
+
+    static AudioOutputParams auxOutputParams(volume_db_t volume, balance_t balance)
+    {
+        AudioFxParams fxParams;
+        fxParams.chainOrder = 0;
+        fxParams.resourceMeta.id = "passthrough";
+        fxParams.resourceMeta.type = AudioResourceType::MusePlugin;
+        fxParams.active = true;
+
+        AudioOutputParams params;
+        params.fxChain.emplace(fxParams.chainOrder, fxParams);
+        params.volume = volume;
+        params.balance = balance;
+        return params;
+    }
+
+    static void applyGain(std::vector<float>& buffer, volume_db_t volume, balance_t balance)
+    {
+        float linearVolume = dsp::linearFromDecibels(volume);
+
+        for (size_t idx = 0; idx < buffer.size(); ++idx) {
+            buffer[idx] *= dsp::balanceGain(balance, static_cast<int>(idx % AUDIO_CHANNELS_COUNT)) * linearVolume;
+        }
+    }
+
+    std::shared_ptr<AudioConfigurationMock> m_configuration;
+    MixerPtr m_mixer;
+};
+}
+
+TEST_F(Audio_MixBusTest, MixerMixesTracksAndAuxSends)
+{
+    //! [GIVEN] Two aux channels with their own volume and balance
+    constexpr size_t auxCount = 2;
+    const volume_db_t auxVolumes[auxCount] = { -6.f, 3.f };
+    const balance_t auxBalances[auxCount] = { 0.f, -0.5f };
+
+    std::vector<MixerChannelPtr> auxChannels;
+    for (size_t auxIdx = 0; auxIdx < auxCount; ++auxIdx) {
+        MixerChannelPtr aux = m_mixer->addAuxChannel(100 + static_cast<TrackId>(auxIdx)).val;
+        aux->applyOutputParams(auxOutputParams(auxVolumes[auxIdx], auxBalances[auxIdx]));
+        auxChannels.push_back(aux);
+    }
+
+    //! [GIVEN] Several tracks with random audio; some of them are sent to the aux channels
+    //! NOTE More samples than the default aux buffer size, so the aux buffers have to grow
+    constexpr samples_t samplesPerChannel = 601;
+    constexpr size_t bufferSize = samplesPerChannel * AUDIO_CHANNELS_COUNT;
+    constexpr size_t trackCount = 5;
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-0.1f, 0.1f);
+
+    std::vector<float> expectedMaster(bufferSize, 0.f);
+    std::vector<std::vector<float> > expectedAux(auxCount, std::vector<float>(bufferSize, 0.f));
+
+    for (size_t i = 0; i < trackCount; ++i) {
+        std::vector<float> source(bufferSize);
+        for (float& sample : source) {
+            sample = distribution(generator);
+        }
+
+        AudioOutputParams params;
+        params.volume = -1.f * static_cast<float>(i);
+        params.balance = 0.2f * static_cast<float>(i) - 0.4f;
+        for (size_t auxIdx = 0; auxIdx < auxCount; ++auxIdx) {
+            params.auxSends.push_back({ 0.25f + 0.5f * static_cast<float>(auxIdx), (i + auxIdx) % 2 == 0 });
+        }
+
+        MixerChannelPtr channel = m_mixer->addChannel(static_cast<TrackId>(i), std::make_shared<TestTrackInput>(source)).val;
+        ASSERT_TRUE(channel);
+        channel->applyOutputParams(params);
+
+        //! [GIVEN] What the track contributes: its own output to the master,
+        //!         and the same output scaled by the send amount to the aux channels
+        std::vector<float> trackOutput = source;
+        applyGain(trackOutput, params.volume, params.balance);
+
+        for (size_t idx = 0; idx < bufferSize; ++idx) {
+            expectedMaster[idx] += trackOutput[idx];
+        }
+
+        for (size_t auxIdx = 0; auxIdx < auxCount; ++auxIdx) {
+            const AuxSendParams& send = params.auxSends[auxIdx];
+            if (!send.active) {
+                continue;
+            }
+
+            for (size_t idx = 0; idx < bufferSize; ++idx) {
+                expectedAux[auxIdx][idx] += trackOutput[idx] * send.signalAmount;
+            }
+        }
+    }
+
+    for (size_t auxIdx = 0; auxIdx < auxCount; ++auxIdx) {
+        applyGain(expectedAux[auxIdx], auxVolumes[auxIdx], auxBalances[auxIdx]);
+
+        for (size_t idx = 0; idx < bufferSize; ++idx) {
+            expectedMaster[idx] += expectedAux[auxIdx][idx];
+        }
+    }
+
+    AudioOutputParams masterParams;
+    masterParams.volume = -2.f;
+    masterParams.balance = 0.3f;
+    m_mixer->setMasterOutputParams(masterParams);
+    applyGain(expectedMaster, masterParams.volume, masterParams.balance);
+
+    //! [WHEN] The mixer processes a block, twice: the second block reuses the slots and aux buffers
+    std::vector<float> output(bufferSize, 1.f);
+    for (int pass = 0; pass < 2; ++pass) {
+        EXPECT_EQ(samplesPerChannel, m_mixer->process(output.data(), samplesPerChannel));
+
+        //! [THEN] The output is the sum of the tracks and the aux channels, with the master gain
+        for (size_t idx = 0; idx < bufferSize; ++idx) {
+            EXPECT_NEAR(expectedMaster[idx], output[idx], 1e-6f) << "pass " << pass << ", sample " << idx;
+        }
+    }
+}
+
+TEST_F(Audio_MixBusTest, MixerSkipsMutedTracks)
+{
+    //! [GIVEN] Two tracks, one of them muted
+    constexpr samples_t samplesPerChannel = 64;
+    constexpr size_t bufferSize = samplesPerChannel * AUDIO_CHANNELS_COUNT;
+
+    MixerChannelPtr audible = m_mixer->addChannel(0, std::make_shared<TestTrackInput>(std::vector<float>(bufferSize, 0.25f))).val;
+    MixerChannelPtr muted = m_mixer->addChannel(1, std::make_shared<TestTrackInput>(std::vector<float>(bufferSize, 0.5f))).val;
+
+    AudioOutputParams mutedParams;
+    mutedParams.muted = true;
+    muted->applyOutputParams(mutedParams);
+
+    //! [WHEN] The mixer processes a block
+    std::vector<float> output(bufferSize, 0.f);
+    m_mixer->process(output.data(), samplesPerChannel);
+
+    //! [THEN] Only the audible track is in the output
+    EXPECT_EQ(std::vector<float>(bufferSize, 0.25f), output);
+
+    //! [WHEN] The master is muted
+    AudioOutputParams masterParams;
+    masterParams.muted = true;
+    m_mixer->setMasterOutputParams(masterParams);
+
+    //! [THEN] The output is silent
+    EXPECT_EQ(0u, m_mixer->process(output.data(), samplesPerChannel));
+    EXPECT_EQ(std::vector<float>(bufferSize, 0.f), output);
+}
+
+TEST_F(Audio_MixBusTest, SilentTrack)
+{
+    //! [GIVEN] A silent track
+    constexpr size_t bufferSize = 128;
+    std::vector<float> track(bufferSize, 0.f);
+    std::vector<float> master(bufferSize, 0.5f);
+
+    //! [THEN] The track is reported as silent and the master buffer isn't changed
+    EXPECT_TRUE(mixTrackIntoBuses(track.data(), bufferSize, master.data(), nullptr, 0));
+    EXPECT_EQ(std::vector<float>(bufferSize, 0.5f), master);
+
+    //! [GIVEN] A single non-silent sample
+    track[bufferSize - 1] = 0.25f;
+
+    //! [THEN] The track is not silent; no master buffer is fine
+    EXPECT_FALSE(mixTrackIntoBuses(track.data(), bufferSize, nullptr, nullptr, 0));
+}
+
+TEST_F(Audio_MixBusTest, SlotsAreCacheLineAligned)
+{
+    //! [GIVEN] A slot buffer with an odd slot size
+    TrackSlotBuffer slots;
+    slots.resize(5, 2 * 301);
+
+    //! [THEN] Every slot starts on a cache line boundary
+    for (size_t i = 0; i < slots.slotCount(); ++i) {
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(slots.slot(i)) % 64);
+    }
+
+    //! [WHEN] The buffer shrinks
+    const float* firstSlot = slots.slot(0);
+    slots.resize(3, 256);
+
+    //! [THEN] The storage is reused
+    EXPECT_EQ(firstSlot, slots.slot(0));
+    EXPECT_EQ(3u, slots.slotCount());
+    EXPECT_EQ(256u, slots.slotSize());
+}
@@ -54,16 +54,19 @@ struct _fluid_samplecache_entry_t
 
     int num_references;
     int mlocked;
+    int mapped; /* MuseScore: the sample data is provided by samplecache_map_func and must not be freed */
 };
 
 static fluid_list_t *samplecache_list = NULL;
 static fluid_mutex_t samplecache_mutex = FLUID_MUTEX_INIT;
+static fluid_samplecache_map_func_t samplecache_map_func = NULL;
 
 static fluid_samplecache_entry_t *new_samplecache_entry(SFData *sf, unsigned int sample_start,
         unsigned int sample_end, int sample_type, time_t mtime);
 static fluid_samplecache_entry_t *get_samplecache_entry(SFData *sf, unsigned int sample_start,
         unsigned int sample_end, int sample_type, time_t mtime);
 static void delete_samplecache_entry(fluid_samplecache_entry_t *entry);
+static int map_sample_data(fluid_samplecache_entry_t *entry, SFData *sf);
 
 static int fluid_get_file_modification_time(char *filename, time_t *modification_time);
 
@@ -185,6 +188,14 @@ unlock_exit:
 }
 
 
+void fluid_samplecache_set_map_func(fluid_samplecache_map_func_t func)
+{
+    fluid_mutex_lock(samplecache_mutex);
+    samplecache_map_func = func;
+    fluid_mutex_unlock(samplecache_mutex);
+}
+
+
 /* Private functions */
 static fluid_samplecache_entry_t *new_samplecache_entry(SFData *sf,
         unsigned int sample_start,
@@ -221,8 +232,11 @@ static fluid_samplecache_entry_t *new_samplecache_entry(SFData *sf,
     entry->sample_type = sample_type;
     entry->modification_time = mtime;
 
-    entry->sample_count = fluid_sffile_read_sample_data(sf, sample_start, sample_end, sample_type,
-                          &entry->sample_data, &entry->sample_data24);
+    if(!map_sample_data(entry, sf))
+    {
+        entry->sample_count = fluid_sffile_read_sample_data(sf, sample_start, sample_end, sample_type,
+                              &entry->sample_data, &entry->sample_data24);
+    }
 
     if(entry->sample_count < 0)
     {
@@ -241,11 +255,66 @@ static void delete_samplecache_entry(fluid_samplecache_entry_t *entry)
     fluid_return_if_fail(entry != NULL);
 
     FLUID_FREE(entry->filename);
-    FLUID_FREE(entry->sample_data);
-    FLUID_FREE(entry->sample_data24);
+
+    if(!entry->mapped)
+    {
+        FLUID_FREE(entry->sample_data);
+        FLUID_FREE(entry->sample_data24);
+    }
+
     FLUID_FREE(entry);
 }
 
+/* MuseScore: points the entry at the sample data provided by samplecache_map_func.
+ * Only uncompressed samples can be used as they are stored in the file (little endian 16-bit words).
+ * Returns TRUE if the entry has been mapped, FALSE if the samples need to be read. */
+static int map_sample_data(fluid_samplecache_entry_t *entry, SFData *sf)
+{
+    fluid_samplecache_map_func_t map_func;
+    unsigned int num_samples;
+    const void *data;
+    const void *data24 = NULL;
+
+    fluid_mutex_lock(samplecache_mutex);
+    map_func = samplecache_map_func;
+    fluid_mutex_unlock(samplecache_mutex);
+
+    if(map_func == NULL || FLUID_IS_BIG_ENDIAN || (entry->sample_type & FLUID_SAMPLETYPE_OGG_VORBIS))
+    {
+        return FALSE;
+    }
+
+    if(((entry->sample_end + 1) <= entry->sample_start)
+            || (entry->sample_start * sizeof(short) > sf->samplesize)
+            || (entry->sample_end * sizeof(short) > sf->samplesize))
+    {
+        return FALSE;
+    }
+
+    num_samples = (entry->sample_end + 1) - entry->sample_start;
+
+    data = map_func(sf->fname, (fluid_long_long_t)sf->samplepos + (fluid_long_long_t)entry->sample_start * sizeof(short),
+                    (fluid_long_long_t)num_samples * sizeof(short));
+
+    if(data == NULL || ((uintptr_t)data % sizeof(short)) != 0)
+    {
+        return FALSE;
+    }
+
+    /* As when reading, the samples are still usable without the 24-bit data */
+    if(sf->sample24pos && (entry->sample_start <= sf->sample24size) && (entry->sample_end <= sf->sample24size))
+    {
+        data24 = map_func(sf->fname, (fluid_long_long_t)sf->sample24pos + entry->sample_start, num_samples);
+    }
+
+    entry->sample_data = (short *)data;
+    entry->sample_data24 = (char *)data24;
+    entry->sample_count = num_samples;
+    entry->mapped = TRUE;
+
+    return TRUE;
+}
+
 static fluid_samplecache_entry_t *get_samplecache_entry(SFData *sf,
         unsigned int sample_start,
         unsigned int sample_end,
@@ -25,13 +25,28 @@
 #include "fluid_sfont.h"
 #include "fluid_sffile.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 int fluid_samplecache_load(SFData *sf,
                            unsigned int sample_start, unsigned int sample_end, int sample_type,
                            int try_mlock, short **data, char **data24);
 
 int fluid_samplecache_unload(const short *sample_data);
 
+/* MuseScore: optional provider of read-only sample data, e.g. a memory mapping of the SoundFont file.
+ * Returns a pointer to size bytes at offset of the file, or NULL to read the samples into a buffer as usual.
+ * The returned data must stay valid until the samples are unloaded. */
+typedef const void *(*fluid_samplecache_map_func_t)(const char *filename, fluid_long_long_t offset, fluid_long_long_t size);
+
+void fluid_samplecache_set_map_func(fluid_samplecache_map_func_t func);
+
 /* Only used for tests */
 int fluid_samplecache_count_entries(void);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* _FLUID_SAMPLECACHE_H */
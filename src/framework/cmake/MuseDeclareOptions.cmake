@@ -13,6 +13,7 @@ declare_muse_module_opt(ACTIONS ON)
 declare_muse_module_opt(AUDIO ON)
 option(MUSE_MODULE_AUDIO_JACK "Enable jack support" OFF)
 option(MUSE_MODULE_AUDIO_EXPORT "Enable audio export" ON)
+option(MUSE_MODULE_AUDIO_COUNT_ALLOCATIONS "Count heap allocations of the audio worker in render benchmarks" OFF)
 
 declare_muse_module_opt(AUTOBOT ON)
 declare_muse_module_opt(CLOUD ON)
@@ -32,6 +32,7 @@
 #include "internal/diagnosticsactions.h"
 #include "internal/diagnosticsactionscontroller.h"
 #include "internal/diagnosticspathsregister.h"
+#include "internal/diagnosticsframetimesregister.h"
 #include "internal/savediagnosticfilesscenario.h"
 
 #include "internal/crashhandler/crashhandler.h"
@@ -68,6 +69,7 @@ void DiagnosticsModule::registerExports()
     m_actionsController = std::make_shared<DiagnosticsActionsController>();
 
     ioc()->registerExport<IDiagnosticsPathsRegister>(moduleName(), new DiagnosticsPathsRegister());
+    ioc()->registerExport<IDiagnosticsFrameTimesRegister>(moduleName(), new DiagnosticsFrameTimesRegister());
     ioc()->registerExport<IDiagnosticsConfiguration>(moduleName(), m_configuration);
     ioc()->registerExport<ISaveDiagnosticFilesScenario>(moduleName(), new SaveDiagnosticFilesScenario());
 }
@@ -0,0 +1,55 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_DIAGNOSTICS_IDIAGNOSTICSFRAMETIMESREGISTER_H
+#define MUSE_DIAGNOSTICS_IDIAGNOSTICSFRAMETIMESREGISTER_H
+
+#include <string>
+#include <vector>
+
+#include "modularity/imoduleinterface.h"
+
+namespace muse::diagnostics {
+//! NOTE Collects per-frame timings reported by views (e.g. the notation paint view),
+//! so that they can be inspected in the profiler panel
+class IDiagnosticsFrameTimesRegister : MODULE_EXPORT_INTERFACE
+{
+    INTERFACE_ID(IDiagnosticsFrameTimesRegister)
+public:
+    virtual ~IDiagnosticsFrameTimesRegister() = default;
+
+    struct Item
+    {
+        std::string name;
+        uint64_t frameCount = 0;
+        double lastMsecs = 0.0;
+        double averageMsecs = 0.0;
+        double maxMsecs = 0.0;
+        std::string details;
+    };
+
+    virtual void addFrame(const std::string& name, double msecs, const std::string& details = std::string()) = 0;
+    virtual std::vector<Item> items() const = 0;
+    virtual void clear() = 0;
+};
+}
+
+#endif // MUSE_DIAGNOSTICS_IDIAGNOSTICSFRAMETIMESREGISTER_H
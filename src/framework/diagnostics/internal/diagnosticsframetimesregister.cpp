@@ -0,0 +1,60 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "diagnosticsframetimesregister.h"
+
+#include <algorithm>
+
+using namespace muse::diagnostics;
+
+void DiagnosticsFrameTimesRegister::addFrame(const std::string& name, double msecs, const std::string& details)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = std::find_if(m_items.begin(), m_items.end(), [&name](const Item& item) {
+        return item.name == name;
+    });
+
+    if (it == m_items.end()) {
+        Item item;
+        item.name = name;
+        m_items.push_back(std::move(item));
+        it = std::prev(m_items.end());
+    }
+
+    it->frameCount++;
+    it->lastMsecs = msecs;
+    it->averageMsecs += (msecs - it->averageMsecs) / static_cast<double>(it->frameCount);
+    it->maxMsecs = std::max(it->maxMsecs, msecs);
+    it->details = details;
+}
+
+std::vector<IDiagnosticsFrameTimesRegister::Item> DiagnosticsFrameTimesRegister::items() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_items;
+}
+
+void DiagnosticsFrameTimesRegister::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_items.clear();
+}
@@ -0,0 +1,46 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_DIAGNOSTICS_DIAGNOSTICSFRAMETIMESREGISTER_H
+#define MUSE_DIAGNOSTICS_DIAGNOSTICSFRAMETIMESREGISTER_H
+
+#include <mutex>
+
+#include "../idiagnosticsframetimesregister.h"
+
+namespace muse::diagnostics {
+class DiagnosticsFrameTimesRegister : public IDiagnosticsFrameTimesRegister
+{
+public:
+    DiagnosticsFrameTimesRegister() = default;
+
+    void addFrame(const std::string& name, double msecs, const std::string& details = std::string()) override;
+    std::vector<Item> items() const override;
+    void clear() override;
+
+private:
+
+    mutable std::mutex m_mutex;
+    std::vector<Item> m_items;
+};
+}
+
+#endif // MUSE_DIAGNOSTICS_DIAGNOSTICSFRAMETIMESREGISTER_H
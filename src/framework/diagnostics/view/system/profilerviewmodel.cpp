@@ -90,9 +90,36 @@ void ProfilerViewModel::reload()
         m_allList.append(item);
     }
 
+    appendFrameTimes();
+
     find(m_searchText);
 }
 
+void ProfilerViewModel::appendFrameTimes()
+{
+    if (!frameTimesRegister()) {
+        return;
+    }
+
+    const QString group = "Frame times";
+    for (const IDiagnosticsFrameTimesRegister::Item& frames : frameTimesRegister()->items()) {
+        Item item;
+        item.group = group;
+        item.data = QString("%1: frames: %2, last: %3 ms, avg: %4 ms, max: %5 ms")
+                    .arg(QString::fromStdString(frames.name))
+                    .arg(frames.frameCount)
+                    .arg(frames.lastMsecs, 0, 'f', 2)
+                    .arg(frames.averageMsecs, 0, 'f', 2)
+                    .arg(frames.maxMsecs, 0, 'f', 2);
+
+        if (!frames.details.empty()) {
+            item.data += ", " + QString::fromStdString(frames.details);
+        }
+
+        m_allList.append(item);
+    }
+}
+
 void ProfilerViewModel::find(const QString& str)
 {
     beginResetModel();
@@ -116,6 +143,9 @@ void ProfilerViewModel::find(const QString& str)
 void ProfilerViewModel::clear()
 {
     PROFILER_CLEAR;
+    if (frameTimesRegister()) {
+        frameTimesRegister()->clear();
+    }
     reload();
 }
 
@@ -24,10 +24,16 @@
 
 #include <QAbstractListModel>
 
+#include "modularity/ioc.h"
+#include "idiagnosticsframetimesregister.h"
+
 namespace muse::diagnostics {
 class ProfilerViewModel : public QAbstractListModel
 {
     Q_OBJECT
+
+    INJECT(IDiagnosticsFrameTimesRegister, frameTimesRegister)
+
 public:
     explicit ProfilerViewModel(QObject* parent = 0);
 
@@ -42,6 +48,8 @@ public:
 
 private:
 
+    void appendFrameTimes();
+
     enum Roles {
         rData = Qt::UserRole + 1,
         rGroup
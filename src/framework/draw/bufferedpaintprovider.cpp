@@ -250,10 +250,17 @@ const Brush& BufferedPaintProvider::brush() const
 
 void BufferedPaintProvider::save()
 {
+    m_savedStates.push_back(currentState());
 }
 
 void BufferedPaintProvider::restore()
 {
+    if (m_savedStates.empty()) {
+        return;
+    }
+
+    editableState() = m_savedStates.back();
+    m_savedStates.pop_back();
 }
 
 void BufferedPaintProvider::setTransform(const Transform& transform)
@@ -358,4 +365,5 @@ void BufferedPaintProvider::clear()
 {
     m_buf = std::make_shared<DrawData>();
     m_itemLevel = -1;
+    m_savedStates.clear();
 }
@@ -106,6 +106,7 @@ private:
     void ensureItemInit(DrawData::Item& item) const;
 
     DrawDataPtr m_buf = nullptr;
+    std::vector<DrawData::State> m_savedStates;
     int m_itemLevel = -1;
     bool m_stateIsUsed = false;
     int m_currentStateNo = 0;
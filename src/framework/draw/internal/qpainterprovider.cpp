@@ -21,6 +21,7 @@
  */
 #include "qpainterprovider.h"
 
+#include <QImage>
 #include <QPainter>
 #include <QRawFont>
 #include <QTextLayout>
@@ -30,6 +31,8 @@
 #include <QStaticText>
 #include <QPainterPath>
 
+#include "global/runtime.h"
+
 #include "draw/utils/drawlogger.h"
 #include "types/transform.h"
 #include "types/painterpath.h"
@@ -305,16 +308,23 @@ void QPainterProvider::drawTextWorkaround(const Font& f, const PointF& pos, cons
 
 void QPainterProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
 {
-    static QHash<char32_t, QString> cache;
-    if (!cache.contains(ucs4Code)) {
-        cache[ucs4Code] = QString::fromUcs4(&ucs4Code, 1);
-    }
+    drawText(point, QString::fromUcs4(&ucs4Code, 1));
+}
 
-    drawText(point, cache.value(ucs4Code));
+//! NOTE QPixmap (and so QPixmapCache) may only be used on the main thread,
+//! other threads paint the pixmap data as a QImage
+static bool isMainThread()
+{
+    return std::this_thread::get_id() == muse::runtime::mainThreadId();
 }
 
 void QPainterProvider::drawPixmap(const PointF& point, const Pixmap& pm)
 {
+    if (!isMainThread()) {
+        m_painter->drawImage(QPointF(point.x(), point.y()), QImage::fromData(pm.data().toQByteArrayNoCopy()));
+        return;
+    }
+
     QString key = QString::number(pm.key());
     QPixmap pixmap;
     if (!QPixmapCache::find(key, &pixmap)) {
@@ -327,6 +337,13 @@ void QPainterProvider::drawPixmap(const PointF& point, const Pixmap& pm)
 
 void QPainterProvider::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset)
 {
+    if (!isMainThread()) {
+        QBrush brush(QImage::fromData(pm.data().toQByteArrayNoCopy()));
+        brush.setTransform(QTransform::fromTranslate(rect.x() - offset.x(), rect.y() - offset.y()));
+        m_painter->fillRect(rect.toQRectF(), brush);
+        return;
+    }
+
     QString key = QString::number(pm.key());
     QPixmap pixmap;
     if (!QPixmapCache::find(key, &pixmap)) {
@@ -27,7 +27,7 @@ using namespace muse;
 using namespace muse::draw;
 
 static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, const std::map<int, DrawData::State>& states,
-                     const Color& overlay)
+                     const Color& overlay, const Transform& baseTransform)
 {
     // first draw obj itself
     for (const DrawData::Data& d : item.datas) {
@@ -40,7 +40,7 @@ static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, co
         provider->setPen(st.pen);
         provider->setBrush(st.brush);
         provider->setFont(st.font);
-        provider->setTransform(st.transform);
+        provider->setTransform(st.transform * baseTransform);
         provider->setAntialiasing(st.isAntialiasing);
         provider->setCompositionMode(st.compositionMode);
 
@@ -76,12 +76,28 @@ static void drawItem(IPaintProviderPtr& provider, const DrawData::Item& item, co
 
     // second draw chilren
     for (const DrawData::Item& ch : item.chilren) {
-        drawItem(provider, ch, states, overlay);
+        drawItem(provider, ch, states, overlay, baseTransform);
     }
 }
 
 void DrawDataPaint::paint(Painter* painter, const DrawDataPtr& data, const Color& overlay)
+{
+    paint(painter, data, data->item, overlay);
+}
+
+void DrawDataPaint::paint(Painter* painter, const DrawDataPtr& data, const DrawData::Item& item, const Color& overlay)
 {
     IPaintProviderPtr provider = painter->provider();
-    drawItem(provider, data->item, data->states, overlay);
+
+    const Transform baseTransform = provider->transform();
+    const Pen pen = provider->pen();
+    const Brush brush = provider->brush();
+    const Font font = provider->font();
+
+    drawItem(provider, item, data->states, overlay, baseTransform);
+
+    provider->setTransform(baseTransform);
+    provider->setPen(pen);
+    provider->setBrush(brush);
+    provider->setFont(font);
 }
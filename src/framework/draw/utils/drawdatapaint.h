@@ -31,7 +31,11 @@ class DrawDataPaint
 public:
     DrawDataPaint() = default;
 
+    //! NOTE The recorded transforms are combined with the current transform of the painter
     static void paint(Painter* painter, const DrawDataPtr& data, const Color& overlay = Color());
+
+    //! NOTE Paints only one of the recorded objects of the data (with its children)
+    static void paint(Painter* painter, const DrawDataPtr& data, const DrawData::Item& item, const Color& overlay = Color());
 };
 }
 
@@ -0,0 +1,104 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MUSE_GLOBAL_SPSCQUEUE_H
+#define MUSE_GLOBAL_SPSCQUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace muse {
+//! NOTE Bounded, wait-free queue for one producer thread and one consumer thread.
+//!      Messages are stored by value in a preallocated ring, so neither side allocates or locks,
+//!      which makes it suitable for passing fixed-size messages to and from real-time threads
+template<typename T, size_t Capacity>
+class SpscQueue
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SpscQueue supports only fixed-size (trivially copyable) messages");
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    SpscQueue() = default;
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    static constexpr size_t capacity()
+    {
+        return Capacity;
+    }
+
+    //! NOTE Producer thread only. Returns false (and drops the message) if the queue is full
+    bool tryPush(const T& item)
+    {
+        const size_t writeIdx = m_writeIndex.load(std::memory_order_relaxed);
+        const size_t readIdx = m_readIndex.load(std::memory_order_acquire);
+
+        if (writeIdx - readIdx == Capacity) {
+            return false;
+        }
+
+        m_data[writeIdx & MASK] = item;
+        m_writeIndex.store(writeIdx + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    //! NOTE Consumer thread only. Returns false if the queue is empty
+    bool tryPop(T& item)
+    {
+        const size_t readIdx = m_readIndex.load(std::memory_order_relaxed);
+        const size_t writeIdx = m_writeIndex.load(std::memory_order_acquire);
+
+        if (readIdx == writeIdx) {
+            return false;
+        }
+
+        item = m_data[readIdx & MASK];
+        m_readIndex.store(readIdx + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    //! NOTE Approximate when called concurrently with push/pop
+    size_t size() const
+    {
+        return m_writeIndex.load(std::memory_order_acquire) - m_readIndex.load(std::memory_order_acquire);
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+private:
+    static constexpr size_t MASK = Capacity - 1;
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_writeIndex = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_readIndex = 0;
+    alignas(CACHE_LINE_SIZE) std::array<T, Capacity> m_data {};
+};
+}
+
+#endif // MUSE_GLOBAL_SPSCQUEUE_H
@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "concurrency/spscqueue.h"
+
+using namespace muse;
+
+class Global_Concurrency_SpscQueueTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Global_Concurrency_SpscQueueTests, PushPop)
+{
+    //! GIVEN Empty queue
+    SpscQueue<int, 4> queue;
+    int value = 0;
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryPop(value));
+
+    //! WHEN Fill it up to the capacity
+    EXPECT_TRUE(queue.tryPush(1));
+    EXPECT_TRUE(queue.tryPush(2));
+    EXPECT_TRUE(queue.tryPush(3));
+    EXPECT_TRUE(queue.tryPush(4));
+
+    //! THEN Next push is rejected
+    EXPECT_FALSE(queue.tryPush(5));
+    EXPECT_EQ(queue.size(), 4);
+
+    //! THEN Items come out in FIFO order
+    for (int expected = 1; expected <= 4; ++expected) {
+        EXPECT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, expected);
+    }
+
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(Global_Concurrency_SpscQueueTests, WrapAround)
+{
+    //! GIVEN Small queue
+    SpscQueue<int, 2> queue;
+    int value = 0;
+
+    //! WHEN Push and pop many more items than the capacity
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(queue.tryPush(i));
+        EXPECT_TRUE(queue.tryPop(value));
+
+        //! THEN Every item is received intact
+        EXPECT_EQ(value, i);
+    }
+}
+
+TEST_F(Global_Concurrency_SpscQueueTests, ProducerConsumerThreads)
+{
+    //! GIVEN Queue shared by two threads
+    struct Message {
+        int index = 0;
+        float value = 0.f;
+    };
+
+    SpscQueue<Message, 64> queue;
+    constexpr int MESSAGE_COUNT = 100000;
+
+    //! WHEN One thread produces and another one consumes
+    std::thread producer([&queue]() {
+        for (int i = 0; i < MESSAGE_COUNT; ++i) {
+            while (!queue.tryPush({ i, static_cast<float>(i) * 0.5f })) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int received = 0;
+    bool inOrder = true;
+
+    while (received < MESSAGE_COUNT) {
+        Message msg;
+        if (!queue.tryPop(msg)) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        inOrder = inOrder && msg.index == received && msg.value == static_cast<float>(received) * 0.5f;
+        ++received;
+    }
+
+    producer.join();
+
+    //! THEN All messages are received in order
+    EXPECT_TRUE(inOrder);
+    EXPECT_TRUE(queue.empty());
+}
@@ -47,6 +47,9 @@ public:
     virtual async::Notification deviceChanged() const = 0;
 
     virtual async::Channel<tick_t, Event> eventReceived() const = 0;
+
+    //! NOTE Time from the moment the driver stamped an event until it was delivered to the receivers
+    virtual MidiInputLatency inputLatency() const = 0;
 };
 }
 
@@ -61,3 +61,8 @@ async::Channel<tick_t, Event> DummyMidiInPort::eventReceived() const
 {
     return m_eventReceived;
 }
+
+MidiInputLatency DummyMidiInPort::inputLatency() const
+{
+    return MidiInputLatency();
+}
@@ -40,6 +40,8 @@ public:
 
     async::Channel<tick_t, Event> eventReceived() const override;
 
+    MidiInputLatency inputLatency() const override;
+
 private:
     MidiDeviceID m_deviceID;
     async::Channel<tick_t, Event> m_eventReceived;
@@ -21,9 +21,15 @@
  */
 #include "alsamidiinport.h"
 
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
 #include <alsa/asoundlib.h>
 #include <alsa/seq.h>
 #include <alsa/seq_midi_event.h>
+#include <poll.h>
+#include <unistd.h>
 
 #include "midierrors.h"
 #include "stringutils.h"
@@ -35,8 +41,15 @@ struct muse::midi::AlsaMidiInPort::Alsa {
     snd_seq_t* midiIn = nullptr;
     int client = -1;
     int port = -1;
+    int inputPort = -1;
+    int queue = -1;
+
+    //! NOTE Used to wake up the input thread when it's blocked in poll()
+    int wakeupPipe[2] = { -1, -1 };
 };
 
+static constexpr int POLL_TIMEOUT_MSECS = 500;
+
 using namespace muse;
 using namespace muse::midi;
 
@@ -62,6 +75,10 @@ void AlsaMidiInPort::init()
 
         m_availableDevicesChanged.notify();
     });
+
+    m_eventsPending.onNotify(this, [this]() {
+        deliverReceivedEvents();
+    });
 }
 
 void AlsaMidiInPort::deinit()
@@ -161,25 +178,53 @@ Ret AlsaMidiInPort::connect(const MidiDeviceID& deviceID)
             return make_ret(Err::MidiInvalidDeviceID, "invalid device id: " + deviceID);
         }
 
-        int err = snd_seq_open(&m_alsa->midiIn, "default", SND_SEQ_OPEN_INPUT, SND_SEQ_NONBLOCK);
+        //! NOTE Duplex, because starting and stopping the timestamp queue goes through the output buffer
+        int err = snd_seq_open(&m_alsa->midiIn, "default", SND_SEQ_OPEN_DUPLEX, SND_SEQ_NONBLOCK);
         if (err < 0) {
             return make_ret(Err::MidiFailedConnect, "failed open seq, err: " + std::string(snd_strerror(err)));
         }
 
         snd_seq_set_client_name(m_alsa->midiIn, "MuseScore");
-        int port
-            = snd_seq_create_simple_port(m_alsa->midiIn, "MuseScore Input Port", SND_SEQ_PORT_CAP_WRITE, SND_SEQ_PORT_TYPE_MIDI_GENERIC);
-        if (port < 0) {
-            return make_ret(Err::MidiFailedConnect, "failed create port");
+
+        m_alsa->queue = snd_seq_alloc_named_queue(m_alsa->midiIn, "MuseScore Input Queue");
+        if (m_alsa->queue < 0) {
+            return make_ret(Err::MidiFailedConnect, "failed alloc queue, err: " + std::string(snd_strerror(m_alsa->queue)));
+        }
+
+        //! NOTE Let the sequencer stamp incoming events with the real time of the queue on arrival
+        snd_seq_port_info_t* pinfo = nullptr;
+        snd_seq_port_info_alloca(&pinfo);
+        snd_seq_port_info_set_name(pinfo, "MuseScore Input Port");
+        snd_seq_port_info_set_capability(pinfo, SND_SEQ_PORT_CAP_WRITE);
+        snd_seq_port_info_set_type(pinfo, SND_SEQ_PORT_TYPE_MIDI_GENERIC | SND_SEQ_PORT_TYPE_APPLICATION);
+        snd_seq_port_info_set_timestamping(pinfo, 1);
+        snd_seq_port_info_set_timestamp_real(pinfo, 1);
+        snd_seq_port_info_set_timestamp_queue(pinfo, m_alsa->queue);
+
+        err = snd_seq_create_port(m_alsa->midiIn, pinfo);
+        if (err < 0) {
+            return make_ret(Err::MidiFailedConnect, "failed create port, err: " + std::string(snd_strerror(err)));
         }
 
+        m_alsa->inputPort = snd_seq_port_info_get_port(pinfo);
         m_alsa->client = deviceParams.at(1);
         m_alsa->port = deviceParams.at(2);
-        err = snd_seq_connect_from(m_alsa->midiIn, 0, m_alsa->client, m_alsa->port);
+        err = snd_seq_connect_from(m_alsa->midiIn, m_alsa->inputPort, m_alsa->client, m_alsa->port);
         if (err < 0) {
             return make_ret(Err::MidiFailedConnect,  "failed connect, err: " + std::string(snd_strerror(err)));
         }
 
+        err = snd_seq_start_queue(m_alsa->midiIn, m_alsa->queue, nullptr);
+        if (err >= 0) {
+            err = snd_seq_drain_output(m_alsa->midiIn);
+        }
+
+        if (err < 0) {
+            return make_ret(Err::MidiFailedConnect, "failed start queue, err: " + std::string(snd_strerror(err)));
+        }
+
+        m_queueStartTime = std::chrono::steady_clock::now();
+
         m_deviceID = deviceID;
         ret = run();
     } else {
@@ -199,15 +244,21 @@ void AlsaMidiInPort::disconnect()
         return;
     }
 
-    snd_seq_disconnect_to(m_alsa->midiIn, 0, m_alsa->client, m_alsa->port);
-    snd_seq_close(m_alsa->midiIn);
-
+    //! NOTE The input thread must be stopped before the sequencer handle is closed
     stop();
 
+    snd_seq_disconnect_from(m_alsa->midiIn, m_alsa->inputPort, m_alsa->client, m_alsa->port);
+    snd_seq_stop_queue(m_alsa->midiIn, m_alsa->queue, nullptr);
+    snd_seq_drain_output(m_alsa->midiIn);
+    snd_seq_free_queue(m_alsa->midiIn, m_alsa->queue);
+    snd_seq_close(m_alsa->midiIn);
+
     LOGD() << "Disconnected from " << m_deviceID;
 
     m_alsa->client = -1;
     m_alsa->port = -1;
+    m_alsa->inputPort = -1;
+    m_alsa->queue = -1;
     m_alsa->midiIn = nullptr;
     m_deviceID.clear();
 }
@@ -232,6 +283,12 @@ async::Channel<tick_t, Event> AlsaMidiInPort::eventReceived() const
     return m_eventReceived;
 }
 
+MidiInputLatency AlsaMidiInPort::inputLatency() const
+{
+    std::lock_guard lock(m_latencyMutex);
+    return m_latency;
+}
+
 Ret AlsaMidiInPort::run()
 {
     if (!isConnected()) {
@@ -243,6 +300,10 @@ Ret AlsaMidiInPort::run()
         return Ret(true);
     }
 
+    if (pipe(m_alsa->wakeupPipe) != 0) {
+        return make_ret(Err::MidiFailedConnect, "failed create wakeup pipe");
+    }
+
     m_running.store(true);
     m_thread = std::make_shared<std::thread>(process, this);
     return Ret(true);
@@ -256,8 +317,19 @@ void AlsaMidiInPort::stop()
     }
 
     m_running.store(false);
+
+    const char wakeup = 1;
+    if (write(m_alsa->wakeupPipe[1], &wakeup, 1) != 1) {
+        LOGW() << "failed wake up the input thread, it will stop on the poll timeout";
+    }
+
     m_thread->join();
     m_thread = nullptr;
+
+    close(m_alsa->wakeupPipe[0]);
+    close(m_alsa->wakeupPipe[1]);
+    m_alsa->wakeupPipe[0] = -1;
+    m_alsa->wakeupPipe[1] = -1;
 }
 
 void AlsaMidiInPort::process(AlsaMidiInPort* self)
@@ -266,21 +338,43 @@ void AlsaMidiInPort::process(AlsaMidiInPort* self)
 }
 
 void AlsaMidiInPort::doProcess()
+{
+    const int seqFdsCount = snd_seq_poll_descriptors_count(m_alsa->midiIn, POLLIN);
+    std::vector<pollfd> fds(seqFdsCount + 1);
+
+    fds[0].fd = m_alsa->wakeupPipe[0];
+    fds[0].events = POLLIN;
+    snd_seq_poll_descriptors(m_alsa->midiIn, fds.data() + 1, seqFdsCount, POLLIN);
+
+    while (m_running.load() && isConnected()) {
+        int ret = poll(fds.data(), fds.size(), POLL_TIMEOUT_MSECS);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            LOGE() << "failed poll, err: " << strerror(errno);
+            break;
+        }
+
+        if (ret == 0 || !m_running.load()) {
+            continue;
+        }
+
+        readPendingEvents();
+    }
+}
+
+void AlsaMidiInPort::readPendingEvents()
 {
     snd_seq_event_t* ev = nullptr;
     uint32_t data = 0;
     uint32_t value = 0;
     Event e;
 
-    while (m_running.load() && isConnected()) {
-        snd_seq_event_input(m_alsa->midiIn, &ev);
-
-        auto sleep = []() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(2));
-        };
-
+    //! NOTE Drain everything the sequencer has buffered, not just one event per wakeup
+    while (snd_seq_event_input(m_alsa->midiIn, &ev) >= 0) {
         if (!ev) {
-            sleep();
             continue;
         }
 
@@ -339,11 +433,50 @@ void AlsaMidiInPort::doProcess()
         e = Event::fromMIDI10Package(data);
 
         e = e.toMIDI20();
-        if (e) {
-            m_eventReceived.send(static_cast<tick_t>(ev->time.tick), e);
+        if (!e) {
+            continue;
+        }
+
+        //! NOTE The event is stamped with the real time of the input queue, so the latency includes
+        //!      the time it spent in the sequencer buffers before this thread woke up
+        const std::chrono::nanoseconds sinceQueueStart = std::chrono::seconds(ev->time.time.tv_sec)
+                                                         + std::chrono::nanoseconds(ev->time.time.tv_nsec);
+
+        ReceivedEvent received;
+        received.tick = static_cast<tick_t>(std::chrono::duration_cast<std::chrono::milliseconds>(sinceQueueStart).count());
+        received.event = e;
+        received.receivedTime = m_queueStartTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(sinceQueueStart);
+
+        if (!m_receivedEvents.tryPush(received)) {
+            LOGW() << "input queue is full, event dropped";
+            continue;
+        }
+
+        if (!m_deliveryScheduled.exchange(true)) {
+            m_eventsPending.notify();
+        }
+    }
+}
+
+void AlsaMidiInPort::deliverReceivedEvents()
+{
+    //! NOTE Reset the flag before draining, so events pushed while draining schedule one more delivery
+    m_deliveryScheduled.store(false);
+
+    ReceivedEvent received;
+    while (m_receivedEvents.tryPop(received)) {
+        const auto latency = std::chrono::steady_clock::now() - received.receivedTime;
+        const double latencyMsecs = std::chrono::duration<double, std::milli>(latency).count();
+
+        {
+            std::lock_guard lock(m_latencyMutex);
+            m_latency.eventCount++;
+            m_latency.lastMsecs = latencyMsecs;
+            m_latency.averageMsecs += (latencyMsecs - m_latency.averageMsecs) / static_cast<double>(m_latency.eventCount);
+            m_latency.maxMsecs = std::max(m_latency.maxMsecs, latencyMsecs);
         }
 
-        sleep();
+        m_eventReceived.send(received.tick, received.event);
     }
 }
 
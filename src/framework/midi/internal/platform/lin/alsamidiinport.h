@@ -22,10 +22,12 @@
 #ifndef MUSE_MIDI_ALSAMIDIINPORT_H
 #define MUSE_MIDI_ALSAMIDIINPORT_H
 
+#include <chrono>
 #include <memory>
 #include <thread>
 
 #include "async/asyncable.h"
+#include "concurrency/spscqueue.h"
 
 #include "imidiinport.h"
 #include "internal/midideviceslistener.h"
@@ -51,12 +53,22 @@ public:
 
     async::Channel<tick_t, Event> eventReceived() const override;
 
+    MidiInputLatency inputLatency() const override;
+
 private:
     Ret run();
     void stop();
 
     static void process(AlsaMidiInPort* self);
     void doProcess();
+    void readPendingEvents();
+    void deliverReceivedEvents();
+
+    struct ReceivedEvent {
+        tick_t tick = 0;
+        Event event;
+        std::chrono::steady_clock::time_point receivedTime;
+    };
 
     bool deviceExists(const MidiDeviceID& deviceId) const;
 
@@ -73,6 +85,16 @@ private:
     mutable std::mutex m_devicesMutex;
 
     async::Channel<tick_t, Event > m_eventReceived;
+
+    //! NOTE Written by the input thread, read by the main thread
+    SpscQueue<ReceivedEvent, 512> m_receivedEvents;
+    std::atomic<bool> m_deliveryScheduled{ false };
+    async::Notification m_eventsPending;
+
+    std::chrono::steady_clock::time_point m_queueStartTime;
+
+    mutable std::mutex m_latencyMutex;
+    MidiInputLatency m_latency;
 };
 }
 
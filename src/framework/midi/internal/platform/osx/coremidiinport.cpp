@@ -344,6 +344,11 @@ async::Channel<tick_t, Event> CoreMidiInPort::eventReceived() const
     return m_eventReceived;
 }
 
+MidiInputLatency CoreMidiInPort::inputLatency() const
+{
+    return MidiInputLatency();
+}
+
 Ret CoreMidiInPort::run()
 {
     if (!isConnected()) {
@@ -47,6 +47,8 @@ public:
 
     async::Channel<tick_t, Event> eventReceived() const override;
 
+    MidiInputLatency inputLatency() const override;
+
 private:
     Ret run();
     void stop();
@@ -227,6 +227,11 @@ async::Channel<tick_t, Event> WinMidiInPort::eventReceived() const
     return m_eventReceived;
 }
 
+MidiInputLatency WinMidiInPort::inputLatency() const
+{
+    return MidiInputLatency();
+}
+
 Ret WinMidiInPort::run()
 {
     if (!isConnected()) {
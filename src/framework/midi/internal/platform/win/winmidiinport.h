@@ -50,6 +50,8 @@ public:
 
     async::Channel<tick_t, Event> eventReceived() const override;
 
+    MidiInputLatency inputLatency() const override;
+
     // internal;
     void doProcess(uint32_t message, tick_t timing);
 
@@ -138,6 +138,14 @@ struct MidiDevice {
 
 using MidiDeviceList = std::vector<MidiDevice>;
 
+//! NOTE Input latency statistics, in milliseconds. Zero if the port doesn't measure it
+struct MidiInputLatency {
+    uint64_t eventCount = 0;
+    double lastMsecs = 0.0;
+    double averageMsecs = 0.0;
+    double maxMsecs = 0.0;
+};
+
 inline MidiDeviceID makeUniqueDeviceId(int index, int arg1, int arg2)
 {
     return std::to_string(index) + ":" + std::to_string(arg1) + ":" + std::to_string(arg2);
@@ -103,6 +103,13 @@ QVariantList MidiPortDevModel::inputDevices() const
 void MidiPortDevModel::inputDeviceAction(const QString& deviceID, const QString& action)
 {
     LOGI() << "deviceID: " << deviceID << ", action: " << action;
+
+    if (midiInPort()->isConnected()) {
+        MidiInputLatency latency = midiInPort()->inputLatency();
+        LOGI() << "input latency, events: " << latency.eventCount << ", last: " << latency.lastMsecs
+               << " ms, average: " << latency.averageMsecs << " ms, max: " << latency.maxMsecs << " ms";
+    }
+
     midiInPort()->disconnect();
 
     if (action == "Connect") {
@@ -121,6 +128,18 @@ QVariantList MidiPortDevModel::inputEvents() const
     return m_inputEvents;
 }
 
+QVariantMap MidiPortDevModel::inputLatency() const
+{
+    MidiInputLatency latency = midiInPort()->inputLatency();
+
+    QVariantMap map;
+    map["eventCount"] = static_cast<qulonglong>(latency.eventCount);
+    map["lastMsecs"] = latency.lastMsecs;
+    map["averageMsecs"] = latency.averageMsecs;
+    map["maxMsecs"] = latency.maxMsecs;
+    return map;
+}
+
 void MidiPortDevModel::generateMIDI20()
 {
     std::set<Event::Opcode> opcodes({ Event::Opcode::PolyPressure,
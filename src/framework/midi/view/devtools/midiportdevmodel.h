@@ -24,6 +24,7 @@
 
 #include <QObject>
 #include <QVariantList>
+#include <QVariantMap>
 
 #include "modularity/ioc.h"
 #include "midi/imidioutport.h"
@@ -41,6 +42,7 @@ class MidiPortDevModel : public QObject, public async::Asyncable
     Q_PROPERTY(QVariantList outputDevices READ outputDevices NOTIFY outputDevicesChanged)
     Q_PROPERTY(QVariantList inputDevices READ inputDevices NOTIFY inputDevicesChanged)
     Q_PROPERTY(QVariantList inputEvents READ inputEvents NOTIFY inputEventsChanged)
+    Q_PROPERTY(QVariantMap inputLatency READ inputLatency NOTIFY inputEventsChanged)
 
 public:
     explicit MidiPortDevModel(QObject* parent = nullptr);
@@ -52,6 +54,7 @@ public:
     Q_INVOKABLE void inputDeviceAction(const QString& deviceID, const QString& action);
 
     QVariantList inputEvents() const;
+    QVariantMap inputLatency() const;
     Q_INVOKABLE void generateMIDI20();
 
 signals:
@@ -21,6 +21,10 @@
  */
 #include "abstractimagewriter.h"
 
+#include <algorithm>
+
+#include "global/io/buffer.h"
+
 #include "log.h"
 
 using namespace muse;
@@ -69,6 +73,53 @@ Ret AbstractImageWriter::writeList(const INotationPtrList&, io::IODevice&, const
     return Ret(Ret::Code::NotSupported);
 }
 
+Ret AbstractImageWriter::writePages(INotationPtr notation, const std::vector<size_t>& pageIndexes,
+                                    const PageWrittenCallback& onPageWritten, const Options& options)
+{
+    Options pageOptions = options;
+
+    for (size_t pageIndex : pageIndexes) {
+        ByteArray data;
+        io::Buffer buffer(&data);
+        buffer.open(io::IODevice::WriteOnly);
+
+        pageOptions[OptionKey::PAGE_NUMBER] = Val(static_cast<int>(pageIndex));
+
+        Ret ret = write(notation, buffer, pageOptions);
+        if (!ret) {
+            return ret;
+        }
+
+        ret = onPageWritten(pageIndex, data);
+        if (!ret) {
+            return ret;
+        }
+    }
+
+    return make_ok();
+}
+
+Ret AbstractImageWriter::writePaintedPages(const std::vector<size_t>& pageIndexes, const PaintPage& paintPage,
+                                           const PageWrittenCallback& onPageWritten) const
+{
+    TRACEFUNC;
+
+    for (size_t pageIndex : pageIndexes) {
+        RetVal<ByteArray> page = paintPage(pageIndex);
+        if (!page.ret) {
+            LOGE() << "failed paint page " << pageIndex << ", err: " << page.ret.toString();
+            return page.ret;
+        }
+
+        Ret ret = onPageWritten(pageIndex, page.val);
+        if (!ret) {
+            return ret;
+        }
+    }
+
+    return make_ok();
+}
+
 INotationWriter::UnitType AbstractImageWriter::unitTypeFromOptions(const Options& options) const
 {
     std::vector<UnitType> supported = supportedUnitTypes();
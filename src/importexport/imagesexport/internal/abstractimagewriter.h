@@ -22,6 +22,10 @@
 #ifndef MU_IMPORTEXPORT_ABSTRACTIMAGEWRITER_H
 #define MU_IMPORTEXPORT_ABSTRACTIMAGEWRITER_H
 
+#include <functional>
+
+#include "global/types/retval.h"
+
 #include "project/inotationwriter.h"
 
 namespace mu::iex::imagesexport {
@@ -34,9 +38,18 @@ public:
     muse::Ret write(notation::INotationPtr notation, muse::io::IODevice& dstDevice, const Options& options = Options()) override;
     muse::Ret writeList(const notation::INotationPtrList& notations, muse::io::IODevice& dstDevice,
                         const Options& options = Options()) override;
+    muse::Ret writePages(notation::INotationPtr notation, const std::vector<size_t>& pageIndexes,
+                         const PageWrittenCallback& onPageWritten, const Options& options = Options()) override;
 
 protected:
     UnitType unitTypeFromOptions(const Options& options) const;
+
+    using PaintPage = std::function<muse::RetVal<muse::ByteArray>(size_t pageIndex)>;
+
+    //! NOTE Runs paintPage for each of the pages in page order and passes the result to onPageWritten.
+    //! The pages are painted on the calling thread: the font and symbol caches used by painting aren't thread-safe
+    muse::Ret writePaintedPages(const std::vector<size_t>& pageIndexes, const PaintPage& paintPage,
+                                const PageWrittenCallback& onPageWritten) const;
 };
 }
 
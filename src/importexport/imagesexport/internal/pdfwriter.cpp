@@ -22,8 +22,10 @@
 
 #include "pdfwriter.h"
 
+#include <limits>
+
+#include <QIODevice>
 #include <QPdfWriter>
-#include <QBuffer>
 
 #include "engraving/dom/masterscore.h"
 
@@ -37,6 +39,61 @@ using namespace muse::io;
 using namespace muse::draw;
 using namespace mu::engraving;
 
+static constexpr qint64 STREAM_CHUNK_SIZE = 1024 * 1024;
+
+namespace {
+//! NOTE QPdfWriter writes every page to its device as soon as the page is finished,
+//! this passes the output on to the destination device in chunks
+class PdfOutputDevice : public QIODevice
+{
+public:
+    PdfOutputDevice(io::IODevice& destinationDevice, qint64 chunkSize)
+        : m_destinationDevice(destinationDevice), m_chunkSize(chunkSize)
+    {
+    }
+
+    bool isSequential() const override
+    {
+        return true;
+    }
+
+    bool flushChunk()
+    {
+        if (m_chunk.isEmpty()) {
+            return !m_failed;
+        }
+
+        size_t written = m_destinationDevice.write(reinterpret_cast<const uint8_t*>(m_chunk.constData()), m_chunk.size());
+        m_failed = m_failed || written != static_cast<size_t>(m_chunk.size()) || m_destinationDevice.hasError();
+        m_chunk.clear();
+
+        return !m_failed;
+    }
+
+protected:
+    qint64 readData(char*, qint64) override
+    {
+        return -1;
+    }
+
+    qint64 writeData(const char* data, qint64 len) override
+    {
+        m_chunk.append(data, len);
+        if (m_chunk.size() >= m_chunkSize && !flushChunk()) {
+            return -1;
+        }
+
+        return len;
+    }
+
+private:
+    io::IODevice& m_destinationDevice;
+    qint64 m_chunkSize = 0;
+    QByteArray m_chunk;
+    bool m_failed = false;
+};
+}
+
 std::vector<INotationWriter::UnitType> PdfWriter::supportedUnitTypes() const
 {
     return { UnitType::PER_PART, UnitType::MULTI_PART };
@@ -53,30 +110,7 @@ Ret PdfWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
         return make_ret(Ret::Code::UnknownError);
     }
 
-    QByteArray qdata;
-    QBuffer buf(&qdata);
-    buf.open(QIODevice::WriteOnly);
-
-    QPdfWriter pdfWriter(&buf);
-    preparePdfWriter(pdfWriter, notation->projectWorkTitleAndPartName(), notation->painting()->pageSizeInch().toQSizeF());
-
-    Painter painter(&pdfWriter, "pdfwriter");
-    if (!painter.isActive()) {
-        return false;
-    }
-
-    INotationPainting::Options opt;
-    opt.deviceDpi = pdfWriter.logicalDpiX();
-    opt.onNewPage = [&pdfWriter]() { pdfWriter.newPage(); };
-
-    notation->painting()->paintPdf(&painter, opt);
-
-    painter.endDraw();
-
-    ByteArray data = ByteArray::fromQByteArrayNoCopy(qdata);
-    destinationDevice.write(data);
-
-    return true;
+    return doWrite({ notation }, destinationDevice, notation->projectWorkTitleAndPartName(), options);
 }
 
 Ret PdfWriter::writeList(const INotationPtrList& notations, io::IODevice& destinationDevice, const Options& options)
@@ -95,12 +129,23 @@ Ret PdfWriter::writeList(const INotationPtrList& notations, io::IODevice& destin
         return make_ret(Ret::Code::UnknownError);
     }
 
-    QByteArray qdata;
-    QBuffer buf(&qdata);
-    buf.open(QIODevice::WriteOnly);
+    return doWrite(notations, destinationDevice, firstNotation->projectWorkTitle(), options);
+}
+
+//! NOTE All notations are painted into one QPdfWriter, so the embedded font subsets are shared by all of them.
+//! When streaming, only the page being painted and the font subsets are kept in memory
+Ret PdfWriter::doWrite(const INotationPtrList& notations, io::IODevice& destinationDevice, const QString& title,
+                       const Options& options)
+{
+    const bool stream = muse::value(options, OptionKey::STREAM_OUTPUT, Val(false)).toBool();
+
+    PdfOutputDevice outputDevice(destinationDevice, stream ? STREAM_CHUNK_SIZE : std::numeric_limits<qint64>::max());
+    outputDevice.open(QIODevice::WriteOnly);
 
-    QPdfWriter pdfWriter(&buf);
-    preparePdfWriter(pdfWriter, firstNotation->projectWorkTitle(), firstNotation->painting()->pageSizeInch().toQSizeF());
+    INotationPtr firstNotation = notations.front();
+
+    QPdfWriter pdfWriter(&outputDevice);
+    preparePdfWriter(pdfWriter, title, firstNotation->painting()->pageSizeInch().toQSizeF());
 
     Painter painter(&pdfWriter, "pdfwriter");
     if (!painter.isActive()) {
@@ -127,8 +172,9 @@ Ret PdfWriter::writeList(const INotationPtrList& notations, io::IODevice& destin
 
     painter.endDraw();
 
-    ByteArray data = ByteArray::fromQByteArrayNoCopy(qdata);
-    destinationDevice.write(data);
+    if (!outputDevice.flushChunk()) {
+        return make_ret(Ret::Code::InternalError);
+    }
 
     return true;
 }
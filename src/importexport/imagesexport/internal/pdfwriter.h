@@ -44,6 +44,8 @@ public:
                         const Options& options = Options()) override;
 
 private:
+    muse::Ret doWrite(const notation::INotationPtrList& notations, muse::io::IODevice& dstDevice, const QString& title,
+                      const Options& options);
     void preparePdfWriter(QPdfWriter& pdfWriter, const QString& title, const QSizeF& size) const;
 };
 }
@@ -22,6 +22,7 @@
 
 #include "pngwriter.h"
 
+#include <algorithm>
 #include <cmath>
 #include <QImage>
 #include <QBuffer>
@@ -46,38 +47,88 @@ Ret PngWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
     }
 
     const float CANVAS_DPI = configuration()->exportPngDpiResolution();
+    const int PAGE_NUMBER = muse::value(options, OptionKey::PAGE_NUMBER, Val(0)).toInt();
+    const INotationPainting::Options opt = paintOptions(PAGE_NUMBER, PAGE_NUMBER, CANVAS_DPI);
 
+    destinationDevice.write(paintPage(notation->painting(), opt, CANVAS_DPI, isTransparentBackground(options)));
+
+    return true;
+}
+
+Ret PngWriter::writePages(INotationPtr notation, const std::vector<size_t>& pageIndexes, const PageWrittenCallback& onPageWritten,
+                          const Options& options)
+{
+    TRACEFUNC;
+
+    IF_ASSERT_FAILED(notation) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    if (pageIndexes.empty()) {
+        return make_ok();
+    }
+
+    const float CANVAS_DPI = configuration()->exportPngDpiResolution();
+    const auto [minPage, maxPage] = std::minmax_element(pageIndexes.cbegin(), pageIndexes.cend());
+    const INotationPainting::Options opt = paintOptions(static_cast<int>(*minPage), static_cast<int>(*maxPage), CANVAS_DPI);
+    const bool transparentBackground = isTransparentBackground(options);
+
+    //! NOTE Everything that changes the score or the global paint state happens here, once for all the pages
+    const INotationPaintingPtr painting = notation->painting();
+    painting->preparePrint(opt);
+
+    auto paint = [painting, opt, CANVAS_DPI, transparentBackground](size_t pageIndex) {
+        INotationPainting::Options pageOpt = opt;
+        pageOpt.fromPage = static_cast<int>(pageIndex);
+        pageOpt.toPage = pageOpt.fromPage;
+
+        return RetVal<ByteArray>::make_ok(paintPage(painting, pageOpt, CANVAS_DPI, transparentBackground));
+    };
+
+    return writePaintedPages(pageIndexes, paint, onPageWritten);
+}
+
+INotationPainting::Options PngWriter::paintOptions(int fromPage, int toPage, float canvasDpi) const
+{
     INotationPainting::Options opt;
-    opt.fromPage = muse::value(options, OptionKey::PAGE_NUMBER, Val(0)).toInt();
-    opt.toPage = opt.fromPage;
+    opt.fromPage = fromPage;
+    opt.toPage = toPage;
     opt.trimMarginPixelSize = configuration()->trimMarginPixelSize();
-    opt.deviceDpi = CANVAS_DPI;
+    opt.deviceDpi = canvasDpi;
     opt.printPageBackground = false; // Printed by us using image.fill
 
-    const SizeF pageSizeInch = notation->painting()->pageSizeInch(opt);
+    return opt;
+}
 
-    int width = std::lrint(pageSizeInch.width() * CANVAS_DPI);
-    int height = std::lrint(pageSizeInch.height() * CANVAS_DPI);
+bool PngWriter::isTransparentBackground(const Options& options) const
+{
+    return muse::value(options, OptionKey::TRANSPARENT_BACKGROUND,
+                       Val(configuration()->exportPngWithTransparentBackground())).toBool();
+}
 
-    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
-    image.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / mu::engraving::INCH));
-    image.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / mu::engraving::INCH));
+ByteArray PngWriter::paintPage(const INotationPaintingPtr& painting, const INotationPainting::Options& opt, float canvasDpi,
+                               bool transparentBackground)
+{
+    const SizeF pageSizeInch = painting->pageSizeInch(opt);
 
-    const bool TRANSPARENT_BACKGROUND = muse::value(options, OptionKey::TRANSPARENT_BACKGROUND,
-                                                    Val(configuration()->exportPngWithTransparentBackground())).toBool();
-    image.fill(TRANSPARENT_BACKGROUND ? Qt::transparent : Qt::white);
+    int width = std::lrint(pageSizeInch.width() * canvasDpi);
+    int height = std::lrint(pageSizeInch.height() * canvasDpi);
 
-    muse::draw::Painter painter(&image, "pngwriter");
+    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
+    image.setDotsPerMeterX(std::lrint((canvasDpi * 1000) / mu::engraving::INCH));
+    image.setDotsPerMeterY(std::lrint((canvasDpi * 1000) / mu::engraving::INCH));
 
-    notation->painting()->paintPng(&painter, opt);
+    image.fill(transparentBackground ? Qt::transparent : Qt::white);
+
+    {
+        muse::draw::Painter painter(&image, "pngwriter");
+        painting->paintPng(&painter, opt);
+    }
 
     QByteArray qdata;
     QBuffer buf(&qdata);
     buf.open(QIODevice::WriteOnly);
     image.save(&buf, "png");
 
-    ByteArray data = ByteArray::fromQByteArrayNoCopy(qdata);
-    destinationDevice.write(data);
-
-    return true;
+    return ByteArray::fromQByteArray(qdata);
 }
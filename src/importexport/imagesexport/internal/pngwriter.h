@@ -36,6 +36,15 @@ class PngWriter : public AbstractImageWriter
 public:
     std::vector<project::INotationWriter::UnitType> supportedUnitTypes() const override;
     muse::Ret write(notation::INotationPtr notation, muse::io::IODevice& dstDevice, const Options& options = Options()) override;
+    muse::Ret writePages(notation::INotationPtr notation, const std::vector<size_t>& pageIndexes,
+                         const PageWrittenCallback& onPageWritten, const Options& options = Options()) override;
+
+private:
+    notation::INotationPainting::Options paintOptions(int fromPage, int toPage, float canvasDpi) const;
+    bool isTransparentBackground(const Options& options) const;
+
+    static muse::ByteArray paintPage(const notation::INotationPaintingPtr& painting, const notation::INotationPainting::Options& opt,
+                                     float canvasDpi, bool transparentBackground);
 };
 }
 
@@ -0,0 +1,890 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "svgpaintprovider.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+#include <QBuffer>
+#include <QFontMetricsF>
+#include <QGlyphRun>
+#include <QMimeDatabase>
+#include <QPainterPath>
+#include <QPixmap>
+#include <QRawFont>
+#include <QTextLayout>
+
+#include "engraving/dom/engravingitem.h"
+#include "engraving/dom/image.h"
+#include "engraving/dom/imageStore.h"
+#include "engraving/dom/mscore.h"
+
+#include "log.h"
+
+using namespace mu::iex::imagesexport;
+using namespace muse;
+using namespace muse::draw;
+
+static constexpr size_t BODY_RESERVE = 1024 * 1024;
+static constexpr size_t DEFS_RESERVE = 64 * 1024;
+static constexpr int MATRIX_DECIMALS = 6;
+
+//! NOTE Coordinates are rounded to 1/1000 of a device pixel (1/360 inch) and trailing zeros are dropped,
+//! which is all the precision any renderer can use and keeps the output compact
+static void appendNumber(std::string& out, double value, int decimals = 3)
+{
+    static constexpr long long SCALES[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+    if (!std::isfinite(value)) {
+        out += '0';
+        return;
+    }
+
+    const long long scale = SCALES[decimals];
+    long long scaled = std::llround(value * scale);
+    if (scaled < 0) {
+        out += '-';
+        scaled = -scaled;
+    }
+
+    char buf[24];
+    const std::to_chars_result res = std::to_chars(buf, buf + sizeof(buf), scaled / scale);
+    out.append(buf, res.ptr);
+
+    long long frac = scaled % scale;
+    if (frac == 0) {
+        return;
+    }
+
+    char digits[6];
+    for (int i = decimals - 1; i >= 0; --i) {
+        digits[i] = static_cast<char>('0' + frac % 10);
+        frac /= 10;
+    }
+
+    size_t len = static_cast<size_t>(decimals);
+    while (digits[len - 1] == '0') {
+        --len;
+    }
+
+    out += '.';
+    out.append(digits, len);
+}
+
+static void appendPoint(std::string& out, double x, double y)
+{
+    appendNumber(out, x);
+    out += ',';
+    appendNumber(out, y);
+}
+
+static void appendColor(std::string& out, const Color& color)
+{
+    static const char HEX[] = "0123456789abcdef";
+
+    const int rgb[3] = { color.red(), color.green(), color.blue() };
+    out += '#';
+    for (int c : rgb) {
+        out += HEX[(c >> 4) & 0xf];
+        out += HEX[c & 0xf];
+    }
+}
+
+static void appendAttribute(std::string& out, const char* name, double value)
+{
+    out += name;
+    appendNumber(out, value);
+    out += '"';
+}
+
+static bool isBlack(const Color& color)
+{
+    return color.red() == 0 && color.green() == 0 && color.blue() == 0;
+}
+
+//! NOTE Works for both PainterPath and QPainterPath, which share the element layout
+template<typename Path>
+static void appendPathData(std::string& out, const Path& path, double dx, double dy)
+{
+    const size_t count = static_cast<size_t>(path.elementCount());
+    for (size_t i = 0; i < count; ++i) {
+        const auto e = path.elementAt(static_cast<decltype(path.elementCount())>(i));
+        if (i > 0) {
+            out += ' ';
+        }
+
+        if (e.isMoveTo()) {
+            out += 'M';
+        } else if (e.isLineTo()) {
+            out += 'L';
+        } else if (e.isCurveTo()) {
+            out += 'C';
+        }
+        // curve data elements continue the preceding C
+
+        appendPoint(out, e.x + dx, e.y + dy);
+    }
+}
+
+SvgPaintProvider::SvgPaintProvider(const DocumentOptions& options)
+    : m_options(options), m_textDevice(1, 1, QImage::Format_ARGB32_Premultiplied)
+{
+    //! NOTE Text is laid out at the engraving resolution, the same as the SVG user units
+    const int dotsPerMeter = static_cast<int>(std::lround(mu::engraving::DPI / 0.0254));
+    m_textDevice.setDotsPerMeterX(dotsPerMeter);
+    m_textDevice.setDotsPerMeterY(dotsPerMeter);
+}
+
+void SvgPaintProvider::setElement(const engraving::EngravingItem* element)
+{
+    if (element == m_element) {
+        return;
+    }
+
+    closeElementGroup();
+
+    m_element = element;
+    m_class = element ? element->typeName() : "";
+    m_id = (m_options.elementIds && element && element->eid().isValid()) ? element->eid().toStdString() : std::string();
+}
+
+ByteArray SvgPaintProvider::data() const
+{
+    std::string header;
+    header.reserve(512);
+    header += "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n<svg width=\"";
+    appendNumber(header, m_options.size.width());
+    header += "px\" height=\"";
+    appendNumber(header, m_options.size.height());
+    header += "px\" viewBox=\"0 0 ";
+    appendNumber(header, m_options.size.width());
+    header += ' ';
+    appendNumber(header, m_options.size.height());
+    header += "\"\n xmlns=\"http://www.w3.org/2000/svg\" xmlns:xlink=\"http://www.w3.org/1999/xlink\""
+              " version=\"1.2\" baseProfile=\"tiny\">\n";
+
+    if (!m_options.title.isEmpty()) {
+        header += "<title>" + m_options.title.toHtmlEscaped().toStdString() + "</title>\n";
+    }
+
+    if (!m_options.description.isEmpty()) {
+        header += "<desc>" + m_options.description.toHtmlEscaped().toStdString() + "</desc>\n";
+    }
+
+    static const std::string DEFS_BEGIN = "<defs>\n";
+    static const std::string DEFS_END = "</defs>\n";
+    static const std::string SVG_END = "</svg>\n";
+
+    const bool hasDefs = !m_defs.empty();
+    const size_t size = header.size() + (hasDefs ? DEFS_BEGIN.size() + m_defs.size() + DEFS_END.size() : 0)
+                        + m_body.size() + SVG_END.size();
+
+    ByteArray result(size);
+    char* dst = reinterpret_cast<char*>(result.data());
+    auto copy = [&dst](const std::string& str) {
+        std::memcpy(dst, str.data(), str.size());
+        dst += str.size();
+    };
+
+    copy(header);
+    if (hasDefs) {
+        copy(DEFS_BEGIN);
+        copy(m_defs);
+        copy(DEFS_END);
+    }
+    copy(m_body);
+    copy(SVG_END);
+
+    return result;
+}
+
+void SvgPaintProvider::beginTarget(const std::string&)
+{
+    m_body.clear();
+    m_defs.clear();
+    m_glyphDefs.clear();
+    m_body.reserve(BODY_RESERVE);
+    m_defs.reserve(DEFS_RESERVE);
+    m_isActive = true;
+}
+
+void SvgPaintProvider::beforeEndTargetHook(Painter*)
+{
+}
+
+bool SvgPaintProvider::endTarget(bool)
+{
+    if (m_isActive) {
+        closeElementGroup();
+        m_isActive = false;
+    }
+
+    return true;
+}
+
+bool SvgPaintProvider::isActive() const
+{
+    return m_isActive;
+}
+
+void SvgPaintProvider::beginObject(const std::string&)
+{
+}
+
+void SvgPaintProvider::endObject()
+{
+}
+
+void SvgPaintProvider::setAntialiasing(bool)
+{
+}
+
+void SvgPaintProvider::setCompositionMode(CompositionMode)
+{
+}
+
+void SvgPaintProvider::setWindow(const RectF&)
+{
+}
+
+void SvgPaintProvider::setViewport(const RectF&)
+{
+}
+
+void SvgPaintProvider::setFont(const Font& font)
+{
+    m_state.font = font;
+}
+
+const Font& SvgPaintProvider::font() const
+{
+    return m_state.font;
+}
+
+void SvgPaintProvider::setPen(const Pen& pen)
+{
+    m_state.pen = pen;
+}
+
+void SvgPaintProvider::setNoPen()
+{
+    m_state.pen.setStyle(PenStyle::NoPen);
+}
+
+const Pen& SvgPaintProvider::pen() const
+{
+    return m_state.pen;
+}
+
+void SvgPaintProvider::setBrush(const Brush& brush)
+{
+    m_state.brush = brush;
+}
+
+const Brush& SvgPaintProvider::brush() const
+{
+    return m_state.brush;
+}
+
+void SvgPaintProvider::save()
+{
+    m_stateStack.push_back(m_state);
+}
+
+void SvgPaintProvider::restore()
+{
+    IF_ASSERT_FAILED(!m_stateStack.empty()) {
+        return;
+    }
+
+    m_state = m_stateStack.back();
+    m_stateStack.pop_back();
+}
+
+void SvgPaintProvider::setTransform(const Transform& transform)
+{
+    m_state.transform = transform;
+}
+
+const Transform& SvgPaintProvider::transform() const
+{
+    return m_state.transform;
+}
+
+void SvgPaintProvider::drawPath(const PainterPath& path)
+{
+    if (m_state.pen.style() == PenStyle::NoPen && m_state.brush.style() == BrushStyle::NoBrush) {
+        return;
+    }
+
+    beginPrimitive("<path");
+    appendBrush(m_state.brush);
+    appendPen(m_state.pen);
+    appendTransform();
+
+    if (path.fillRule() == PainterPath::FillRule::OddEvenFill) {
+        m_body += " fill-rule=\"evenodd\"";
+    }
+
+    m_body += " d=\"";
+    appendPathData(m_body, path, m_dx, m_dy);
+    m_body += '"';
+    endPrimitive();
+}
+
+void SvgPaintProvider::drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode)
+{
+    IF_ASSERT_FAILED(points && pointCount >= 2) {
+        return;
+    }
+
+    if (mode == PolygonMode::Polyline) {
+        if (m_state.pen.style() == PenStyle::NoPen) {
+            return;
+        }
+
+        beginPrimitive("<polyline");
+        m_body += " fill=\"none\"";
+        appendPen(m_state.pen);
+        appendTransform();
+
+        m_body += " points=\"";
+        for (size_t i = 0; i < pointCount; ++i) {
+            if (i > 0) {
+                m_body += ' ';
+            }
+            appendPoint(m_body, points[i].x() + m_dx, points[i].y() + m_dy);
+        }
+        m_body += '"';
+        endPrimitive();
+        return;
+    }
+
+    if (m_state.pen.style() == PenStyle::NoPen && m_state.brush.style() == BrushStyle::NoBrush) {
+        return;
+    }
+
+    beginPrimitive("<path");
+    appendBrush(m_state.brush);
+    appendPen(m_state.pen);
+    appendTransform();
+
+    //! NOTE Polygons are always written with the even-odd rule, as the QPaintEngine based generator did
+    m_body += " fill-rule=\"evenodd\" d=\"M";
+    appendPoint(m_body, points[0].x() + m_dx, points[0].y() + m_dy);
+    for (size_t i = 1; i < pointCount; ++i) {
+        m_body += " L";
+        appendPoint(m_body, points[i].x() + m_dx, points[i].y() + m_dy);
+    }
+
+    if (points[pointCount - 1] != points[0]) {
+        m_body += " L";
+        appendPoint(m_body, points[0].x() + m_dx, points[0].y() + m_dy);
+    }
+    m_body += '"';
+    endPrimitive();
+}
+
+void SvgPaintProvider::drawText(const PointF& point, const String& text)
+{
+    if (text.isEmpty() || m_state.pen.style() == PenStyle::NoPen) {
+        return;
+    }
+
+    drawShapedText(shapeText(m_state.font, text.toQString()), point);
+}
+
+void SvgPaintProvider::drawText(const RectF& rect, int flags, const String& text)
+{
+    if (text.isEmpty() || m_state.pen.style() == PenStyle::NoPen) {
+        return;
+    }
+
+    const ShapedText& shaped = shapeText(m_state.font, text.toQString());
+
+    double x = rect.x();
+    if (flags & AlignRight) {
+        x = rect.right() - shaped.width;
+    } else if (flags & AlignHCenter) {
+        x = rect.x() + (rect.width() - shaped.width) / 2;
+    }
+
+    double y = rect.y();
+    if (flags & AlignBottom) {
+        y = rect.bottom() - shaped.height;
+    } else if (flags & AlignVCenter) {
+        y = rect.y() + (rect.height() - shaped.height) / 2;
+    }
+
+    drawShapedText(shaped, PointF(x, y + shaped.ascent));
+}
+
+void SvgPaintProvider::drawTextWorkaround(const Font& f, const PointF& pos, const String& text)
+{
+    //! NOTE The workaround is for QPainter scaling glyphs and positions differently;
+    //! here both come from the same layout, so the text is simply drawn with the given font
+    const Font font = m_state.font;
+    m_state.font = f;
+    drawText(pos, text);
+    m_state.font = font;
+}
+
+void SvgPaintProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
+{
+    if (m_state.pen.style() == PenStyle::NoPen) {
+        return;
+    }
+
+    drawShapedText(shapeText(m_state.font, QString::fromUcs4(&ucs4Code, 1)), point);
+}
+
+void SvgPaintProvider::drawPixmap(const PointF& point, const Pixmap& pm)
+{
+    if (pm.isNull()) {
+        return;
+    }
+
+    drawEncodedImage(point, SizeF(pm.width(), pm.height()), pm.data().toQByteArrayNoCopy());
+}
+
+void SvgPaintProvider::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset)
+{
+    if (pm.isNull() || pm.width() <= 0 || pm.height() <= 0) {
+        return;
+    }
+
+    //! NOTE Clipping isn't written, so the last row and column of tiles may extend past the rect
+    for (double y = rect.top() - offset.y(); y < rect.bottom(); y += pm.height()) {
+        for (double x = rect.left() - offset.x(); x < rect.right(); x += pm.width()) {
+            drawPixmap(PointF(x, y), pm);
+        }
+    }
+}
+
+void SvgPaintProvider::drawPixmap(const PointF& point, const QPixmap& pm)
+{
+    if (pm.isNull()) {
+        return;
+    }
+
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    pm.save(&buffer, "PNG");
+
+    drawImage(point, SizeF(pm.width(), pm.height()), data, "image/png");
+}
+
+void SvgPaintProvider::drawTiledPixmap(const RectF& rect, const QPixmap& pm, const PointF& offset)
+{
+    if (pm.isNull()) {
+        return;
+    }
+
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+    pm.save(&buffer, "PNG");
+
+    for (double y = rect.top() - offset.y(); y < rect.bottom(); y += pm.height()) {
+        for (double x = rect.left() - offset.x(); x < rect.right(); x += pm.width()) {
+            drawImage(PointF(x, y), SizeF(pm.width(), pm.height()), data, "image/png");
+        }
+    }
+}
+
+bool SvgPaintProvider::hasClipping() const
+{
+    return m_state.clipping;
+}
+
+//! NOTE Like the QPaintEngine based generator, clipping is tracked but not written
+void SvgPaintProvider::setClipRect(const RectF&)
+{
+    m_state.clipping = true;
+}
+
+void SvgPaintProvider::setClipping(bool enable)
+{
+    m_state.clipping = enable;
+}
+
+const SvgPaintProvider::ShapedText& SvgPaintProvider::shapeText(const Font& font, const QString& text)
+{
+    std::string key = font.family().toStdString();
+    key += '\n';
+    appendNumber(key, font.pointSizeF());
+    key += '/';
+    key += std::to_string(font.pixelSize());
+    key += '\n';
+    key += std::to_string(static_cast<int>(font.weight()));
+    key += font.italic() ? 'i' : '-';
+    key += font.underline() ? 'u' : '-';
+    key += font.strike() ? 's' : '-';
+    key += font.noFontMerging() ? 'n' : '-';
+    key += '\n';
+    key += text.toStdString();
+
+    auto it = m_shapedTexts.find(key);
+    if (it != m_shapedTexts.end()) {
+        return it->second;
+    }
+
+    ShapedText shaped;
+
+    const QFont qfont = font.toQFont();
+    QTextLayout layout(text, qfont, &m_textDevice);
+    layout.beginLayout();
+    while (layout.createLine().isValid()) {
+    }
+    layout.endLayout();
+
+    if (layout.lineCount() > 0) {
+        const QTextLine line = layout.lineAt(0);
+        shaped.width = line.naturalTextWidth();
+        shaped.ascent = line.ascent();
+        shaped.height = line.height();
+    }
+
+    for (const QGlyphRun& run : layout.glyphRuns()) {
+        const QRawFont rawFont = run.rawFont();
+        const QVector<quint32> indexes = run.glyphIndexes();
+        const QVector<QPointF> positions = run.positions();
+
+        for (qsizetype i = 0; i < indexes.size(); ++i) {
+            const int defIndex = glyphDef(rawFont, indexes.at(i));
+            if (defIndex < 0) {
+                continue;
+            }
+
+            const QPointF& pos = positions.at(i);
+            shaped.glyphs.push_back({ defIndex, PointF(pos.x(), pos.y() - shaped.ascent) });
+        }
+    }
+
+    if (font.underline() || font.strike()) {
+        const QFontMetricsF fm(qfont, &m_textDevice);
+        const double lineWidth = fm.lineWidth();
+
+        if (font.underline()) {
+            shaped.decorations.push_back(RectF(0.0, fm.underlinePos() - lineWidth / 2, shaped.width, lineWidth));
+        }
+
+        if (font.strike()) {
+            shaped.decorations.push_back(RectF(0.0, -fm.strikeOutPos() - lineWidth / 2, shaped.width, lineWidth));
+        }
+    }
+
+    return m_shapedTexts.emplace(std::move(key), std::move(shaped)).first->second;
+}
+
+int SvgPaintProvider::glyphDef(const QRawFont& rawFont, quint32 glyphIndex)
+{
+    std::string key = rawFont.familyName().toStdString();
+    key += '\n';
+    key += rawFont.styleName().toStdString();
+    key += '\n';
+    appendNumber(key, rawFont.pixelSize());
+    key += '\n';
+    key += std::to_string(rawFont.weight());
+    key += '\n';
+    key += std::to_string(static_cast<int>(rawFont.style()));
+    key += '\n';
+    key += std::to_string(glyphIndex);
+
+    auto it = m_glyphDefs.find(key);
+    if (it != m_glyphDefs.end()) {
+        return it->second;
+    }
+
+    const QPainterPath path = rawFont.pathForGlyph(glyphIndex);
+    if (path.isEmpty()) {
+        m_glyphDefs.emplace(std::move(key), -1);
+        return -1;
+    }
+
+    const int defIndex = static_cast<int>(m_glyphDefs.size());
+    m_glyphDefs.emplace(std::move(key), defIndex);
+
+    m_defs += "<path id=\"g";
+    m_defs += std::to_string(defIndex);
+    m_defs += "\" d=\"";
+    appendPathData(m_defs, path, 0.0, 0.0);
+    m_defs += "\"/>\n";
+
+    return defIndex;
+}
+
+void SvgPaintProvider::drawShapedText(const ShapedText& shaped, const PointF& baseline)
+{
+    const Color& color = m_state.pen.color();
+
+    for (const ShapedGlyph& glyph : shaped.glyphs) {
+        beginPrimitive("<use");
+        appendTextFill(color);
+        appendTransform();
+
+        m_body += " xlink:href=\"#g";
+        m_body += std::to_string(glyph.defIndex);
+        m_body += '"';
+        appendAttribute(m_body, " x=\"", baseline.x() + glyph.pos.x() + m_dx);
+        appendAttribute(m_body, " y=\"", baseline.y() + glyph.pos.y() + m_dy);
+        endPrimitive();
+    }
+
+    for (const RectF& rect : shaped.decorations) {
+        beginPrimitive("<path");
+        appendTextFill(color);
+        appendTransform();
+
+        const double left = baseline.x() + rect.left() + m_dx;
+        const double right = baseline.x() + rect.right() + m_dx;
+        const double top = baseline.y() + rect.top() + m_dy;
+        const double bottom = baseline.y() + rect.bottom() + m_dy;
+
+        m_body += " d=\"M";
+        appendPoint(m_body, left, top);
+        m_body += " L";
+        appendPoint(m_body, right, top);
+        m_body += " L";
+        appendPoint(m_body, right, bottom);
+        m_body += " L";
+        appendPoint(m_body, left, bottom);
+        m_body += " Z\"";
+        endPrimitive();
+    }
+}
+
+void SvgPaintProvider::drawEncodedImage(const PointF& point, const SizeF& size, const QByteArray& encoded)
+{
+    QMimeDatabase mimeDatabase;
+
+    QByteArray data = encoded;
+    QString mimeType = mimeDatabase.mimeTypeForData(encoded).name();
+    if (mimeType != "image/png" && mimeType != "image/jpeg") {
+        const QImage image = QImage::fromData(encoded);
+        if (image.isNull()) {
+            LOGW() << "Could not decode image";
+            return;
+        }
+
+        data.clear();
+        QBuffer buffer(&data);
+        buffer.open(QIODevice::WriteOnly);
+        image.save(&buffer, "PNG");
+        mimeType = "image/png";
+    }
+
+    // check whether we can just use the original raster image
+    // to reduce the resulting file size
+    if (m_element && m_element->isImage()) {
+        const mu::engraving::Image* img = mu::engraving::toImage(m_element);
+        const mu::engraving::ImageStoreItem* storeItem = img->storeItem(); // holds the original image file content
+        if (img->imageType() == mu::engraving::ImageType::RASTER && storeItem) {
+            const QByteArray imgData = storeItem->buffer().toQByteArrayNoCopy();
+            const QString type = mimeDatabase.mimeTypeForData(imgData).name();
+            if ((type == "image/png" || type == "image/jpeg") && imgData.size() < data.size()) {
+                drawImage(point, size, imgData, type.toLatin1().constData());
+                return;
+            }
+        }
+    }
+
+    drawImage(point, size, data, mimeType.toLatin1().constData());
+}
+
+void SvgPaintProvider::drawImage(const PointF& point, const SizeF& size, const QByteArray& data, const char* mimeType)
+{
+    beginPrimitive("<image");
+    appendTransform();
+    appendAttribute(m_body, " x=\"", point.x() + m_dx);
+    appendAttribute(m_body, " y=\"", point.y() + m_dy);
+    appendAttribute(m_body, " width=\"", size.width());
+    appendAttribute(m_body, " height=\"", size.height());
+    m_body += " preserveAspectRatio=\"none\" xlink:href=\"data:";
+    m_body += mimeType;
+    m_body += ";base64,";
+    const QByteArray base64 = data.toBase64();
+    m_body.append(base64.constData(), static_cast<size_t>(base64.size()));
+    m_body += '"';
+    endPrimitive();
+}
+
+void SvgPaintProvider::beginPrimitive(const char* tag)
+{
+    if (!m_id.empty() && !m_groupOpen) {
+        m_body += "<g id=\"eid";
+        m_body += m_id;
+        m_body += "\">\n";
+        m_groupOpen = true;
+    }
+
+    m_body += tag;
+    m_body += " class=\"";
+    m_body += m_class;
+    m_body += '"';
+}
+
+void SvgPaintProvider::endPrimitive()
+{
+    m_body += "/>\n";
+}
+
+void SvgPaintProvider::closeElementGroup()
+{
+    if (!m_groupOpen) {
+        return;
+    }
+
+    m_body += "</g>\n";
+    m_groupOpen = false;
+}
+
+void SvgPaintProvider::appendBrush(const Brush& brush)
+{
+    if (brush.style() == BrushStyle::NoBrush) {
+        m_body += " fill=\"none\"";
+        return;
+    }
+
+    // Default fill color is black, default fill-opacity is 100%
+    appendTextFill(brush.color());
+}
+
+void SvgPaintProvider::appendTextFill(const Color& color)
+{
+    if (!isBlack(color)) {
+        m_body += " fill=\"";
+        appendColor(m_body, color);
+        m_body += '"';
+    }
+
+    if (color.alpha() != 255) {
+        appendAttribute(m_body, " fill-opacity=\"", color.alpha() / 255.0);
+    }
+}
+
+void SvgPaintProvider::appendPen(const Pen& pen)
+{
+    // Default value for stroke is "none"
+    if (pen.style() == PenStyle::NoPen) {
+        return;
+    }
+
+    const Color& color = pen.color();
+    m_body += " stroke=\"";
+    appendColor(m_body, color);
+    m_body += '"';
+
+    if (color.alpha() != 255) {
+        appendAttribute(m_body, " stroke-opacity=\"", color.alpha() / 255.0);
+    }
+
+    const double width = pen.widthF();
+
+    if (pen.style() != PenStyle::SolidLine) {
+        // SVG dashes are absolute, Qt ones are in pen widths
+        const double penWidth = width > 0 ? width : 1.0;
+        m_body += " stroke-dasharray=\"";
+        const std::vector<double> pattern = pen.dashPattern();
+        for (size_t i = 0; i < pattern.size(); ++i) {
+            if (i > 0) {
+                m_body += ',';
+            }
+            appendNumber(m_body, pattern[i] * penWidth);
+        }
+        m_body += "\" stroke-dashoffset=\"0\"";
+    }
+
+    // Default stroke-width is 1
+    if (width > 0 && width != 1) {
+        appendAttribute(m_body, " stroke-width=\"", width);
+    }
+
+    switch (pen.capStyle()) {
+    case PenCapStyle::FlatCap:
+        // This is the default stroke-linecap value
+        break;
+    case PenCapStyle::SquareCap:
+        m_body += " stroke-linecap=\"square\"";
+        break;
+    case PenCapStyle::RoundCap:
+        m_body += " stroke-linecap=\"round\"";
+        break;
+    }
+
+    switch (pen.joinStyle()) {
+    case PenJoinStyle::MiterJoin:
+        // Qt's default miter limit
+        m_body += " stroke-linejoin=\"miter\" stroke-miterlimit=\"2\"";
+        break;
+    case PenJoinStyle::BevelJoin:
+        m_body += " stroke-linejoin=\"bevel\"";
+        break;
+    case PenJoinStyle::RoundJoin:
+        m_body += " stroke-linejoin=\"round\"";
+        break;
+    }
+
+    // Zero width pens are cosmetic
+    if (width == 0) {
+        m_body += " vector-effect=\"non-scaling-stroke\"";
+    }
+}
+
+void SvgPaintProvider::appendTransform()
+{
+    const Transform& t = m_state.transform;
+
+    // m11 and m22 have floating point flotsam, for example: 1.000000629
+    // Both values should be == integer 1, because no scaling is intended.
+    const double m11 = std::round(t.m11() * 1000) / 1000.0;
+    const double m22 = std::round(t.m22() * 1000) / 1000.0;
+
+    if (m11 == 1 && m22 == 1 && t.m12() == 0 && t.m21() == 0) {
+        // Translations are folded into the coordinates
+        m_dx = t.dx();
+        m_dy = t.dy();
+        return;
+    }
+
+    m_dx = 0.0;
+    m_dy = 0.0;
+
+    // the linear part scales the coordinates, so it needs more precision than they do
+    m_body += " transform=\"matrix(";
+    appendNumber(m_body, t.m11(), MATRIX_DECIMALS);
+    m_body += ',';
+    appendNumber(m_body, t.m12(), MATRIX_DECIMALS);
+    m_body += ',';
+    appendNumber(m_body, t.m21(), MATRIX_DECIMALS);
+    m_body += ',';
+    appendNumber(m_body, t.m22(), MATRIX_DECIMALS);
+    m_body += ',';
+    appendNumber(m_body, t.dx());
+    m_body += ',';
+    appendNumber(m_body, t.dy());
+    m_body += ")\"";
+}
@@ -0,0 +1,177 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef MU_IMPORTEXPORT_SVGPAINTPROVIDER_H
+#define MU_IMPORTEXPORT_SVGPAINTPROVIDER_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <QImage>
+#include <QString>
+
+#include "draw/ipaintprovider.h"
+#include "types/bytearray.h"
+
+class QRawFont;
+
+namespace mu::engraving {
+class EngravingItem;
+}
+
+namespace mu::iex::imagesexport {
+//! NOTE Writes SVG straight from the paint calls, without the QPainter/QPaintEngine round trip.
+//! Text and symbols are written once per document as glyph outlines in <defs> and referenced with <use>
+class SvgPaintProvider : public muse::draw::IPaintProvider
+{
+public:
+    struct DocumentOptions {
+        QString title;
+        QString description;
+        muse::SizeF size;
+        bool elementIds = false; // wrap the output of each element with a valid EID in <g id="eid...">
+    };
+
+    SvgPaintProvider(const DocumentOptions& options);
+
+    //! NOTE The element whose output follows; used for the class (and id) attributes
+    void setElement(const engraving::EngravingItem* element);
+
+    //! NOTE The whole document, available after the painting has ended
+    muse::ByteArray data() const;
+
+    void beginTarget(const std::string& name) override;
+    void beforeEndTargetHook(muse::draw::Painter* painter) override;
+    bool endTarget(bool endDraw = false) override;
+    bool isActive() const override;
+
+    void beginObject(const std::string& name) override;
+    void endObject() override;
+
+    void setAntialiasing(bool arg) override;
+    void setCompositionMode(muse::draw::CompositionMode mode) override;
+    void setWindow(const muse::RectF& window) override;
+    void setViewport(const muse::RectF& viewport) override;
+
+    void setFont(const muse::draw::Font& font) override;
+    const muse::draw::Font& font() const override;
+
+    void setPen(const muse::draw::Pen& pen) override;
+    void setNoPen() override;
+    const muse::draw::Pen& pen() const override;
+
+    void setBrush(const muse::draw::Brush& brush) override;
+    const muse::draw::Brush& brush() const override;
+
+    void save() override;
+    void restore() override;
+
+    void setTransform(const muse::draw::Transform& transform) override;
+    const muse::draw::Transform& transform() const override;
+
+    // drawing functions
+    void drawPath(const muse::draw::PainterPath& path) override;
+    void drawPolygon(const muse::PointF* points, size_t pointCount, muse::draw::PolygonMode mode) override;
+
+    void drawText(const muse::PointF& point, const muse::String& text) override;
+    void drawText(const muse::RectF& rect, int flags, const muse::String& text) override;
+    void drawTextWorkaround(const muse::draw::Font& f, const muse::PointF& pos, const muse::String& text) override;
+
+    void drawSymbol(const muse::PointF& point, char32_t ucs4Code) override;
+
+    void drawPixmap(const muse::PointF& point, const muse::draw::Pixmap& pm) override;
+    void drawTiledPixmap(const muse::RectF& rect, const muse::draw::Pixmap& pm,
+                         const muse::PointF& offset = muse::PointF()) override;
+
+    void drawPixmap(const muse::PointF& point, const QPixmap& pm) override;
+    void drawTiledPixmap(const muse::RectF& rect, const QPixmap& pm, const muse::PointF& offset = muse::PointF()) override;
+
+    bool hasClipping() const override;
+
+    void setClipRect(const muse::RectF& rect) override;
+    void setClipping(bool enable) override;
+
+private:
+    struct State {
+        muse::draw::Font font;
+        muse::draw::Pen pen;
+        muse::draw::Brush brush;
+        muse::draw::Transform transform;
+        bool clipping = false;
+    };
+
+    struct ShapedGlyph {
+        int defIndex = -1;
+        muse::PointF pos; // relative to the start of the baseline
+    };
+
+    struct ShapedText {
+        std::vector<ShapedGlyph> glyphs;
+        std::vector<muse::RectF> decorations; // underline and strike out, relative to the baseline
+        double width = 0.0;
+        double ascent = 0.0;
+        double height = 0.0;
+    };
+
+    const ShapedText& shapeText(const muse::draw::Font& font, const QString& text);
+    int glyphDef(const QRawFont& rawFont, quint32 glyphIndex); // -1 for glyphs without outline
+
+    void drawShapedText(const ShapedText& shaped, const muse::PointF& baseline);
+    void drawImage(const muse::PointF& point, const muse::SizeF& size, const QByteArray& data, const char* mimeType);
+    void drawEncodedImage(const muse::PointF& point, const muse::SizeF& size, const QByteArray& encoded);
+
+    void beginPrimitive(const char* tag);
+    void endPrimitive();
+    void closeElementGroup();
+
+    void appendBrush(const muse::draw::Brush& brush);
+    void appendPen(const muse::draw::Pen& pen);
+    void appendTextFill(const muse::draw::Color& color);
+    void appendTransform();
+
+    DocumentOptions m_options;
+    bool m_isActive = false;
+
+    State m_state;
+    std::vector<State> m_stateStack;
+
+    const engraving::EngravingItem* m_element = nullptr;
+    std::string m_class;
+    std::string m_id;
+    bool m_groupOpen = false;
+
+    // translation folded into the coordinates of the current primitive
+    double m_dx = 0.0;
+    double m_dy = 0.0;
+
+    std::string m_body;
+    std::string m_defs;
+
+    QImage m_textDevice; // only provides the resolution for text layout
+    std::unordered_map<std::string, ShapedText> m_shapedTexts;
+    std::unordered_map<std::string, int> m_glyphDefs;
+};
+}
+
+#endif // MU_IMPORTEXPORT_SVGPAINTPROVIDER_H
@@ -22,7 +22,8 @@
 
 #include "svgwriter.h"
 
-#include <QBuffer>
+#include <map>
+#include <memory>
 
 #include "draw/painter.h"
 
@@ -34,7 +35,7 @@
 #include "engraving/dom/system.h"
 #include "engraving/dom/repeatlist.h"
 
-#include "svggenerator.h"
+#include "svgpaintprovider.h"
 
 #include "log.h"
 
@@ -62,55 +63,160 @@ Ret SvgWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
         return make_ret(Ret::Code::UnknownError);
     }
 
+    const size_t PAGE_NUMBER = muse::value(options, OptionKey::PAGE_NUMBER, Val(0)).toInt();
+    if (PAGE_NUMBER >= score->pages().size()) {
+        return false;
+    }
+
+    const double pixelRatioBackup = mu::engraving::MScore::pixelRatio;
+    beginPrinting(score, options);
+
+    std::vector<std::unique_ptr<mu::engraving::StaffLines> > concatenatedStaffLines;
+    const PageItems items = pageItems(score, score->pages().at(PAGE_NUMBER), concatenatedStaffLines);
+
+    destinationDevice.write(paintPage(scoreRenderer().get(), pageOptions(score, PAGE_NUMBER, options), items));
+
+    endPrinting(score, pixelRatioBackup);
+
+    return true;
+}
+
+Ret SvgWriter::writePages(INotationPtr notation, const std::vector<size_t>& pageIndexes, const PageWrittenCallback& onPageWritten,
+                          const Options& options)
+{
+    TRACEFUNC;
+
+    IF_ASSERT_FAILED(notation) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    mu::engraving::Score* score = notation->elements()->msScore();
+    IF_ASSERT_FAILED(score) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    const std::vector<mu::engraving::Page*>& pages = score->pages();
+    for (size_t pageIndex : pageIndexes) {
+        if (pageIndex >= pages.size()) {
+            return false;
+        }
+    }
+
+    const double pixelRatioBackup = mu::engraving::MScore::pixelRatio;
+    beginPrinting(score, options);
+
+    //! NOTE Everything that changes the score or the global paint state happens here, once for all the pages;
+    //! the pages are then only read while they are painted
+    std::vector<std::unique_ptr<mu::engraving::StaffLines> > concatenatedStaffLines;
+    std::map<size_t, std::pair<PageOptions, PageItems> > pagesToPaint;
+    for (size_t pageIndex : pageIndexes) {
+        pagesToPaint[pageIndex] = { pageOptions(score, pageIndex, options),
+                                    pageItems(score, pages.at(pageIndex), concatenatedStaffLines) };
+    }
+
+    const mu::engraving::rendering::IScoreRenderer* renderer = scoreRenderer().get();
+
+    auto paint = [renderer, &pagesToPaint](size_t pageIndex) {
+        const auto& [pageOpt, items] = pagesToPaint.at(pageIndex);
+        return RetVal<ByteArray>::make_ok(paintPage(renderer, pageOpt, items));
+    };
+
+    Ret ret = writePaintedPages(pageIndexes, paint, onPageWritten);
+
+    endPrinting(score, pixelRatioBackup);
+
+    return ret;
+}
+
+void SvgWriter::beginPrinting(mu::engraving::Score* score, const Options& options) const
+{
     score->setPrinting(true); // don’t print page break symbols etc.
 
     mu::engraving::MScore::pdfPrinting = true;
     mu::engraving::MScore::svgPrinting = true;
 
-    const std::vector<mu::engraving::Page*>& pages = score->pages();
-    double pixelRationBackup = mu::engraving::MScore::pixelRatio;
+    // The SVG user unit is the engraving DPI
+    mu::engraving::MScore::pixelRatio = 1.0;
 
-    const size_t PAGE_NUMBER = muse::value(options, OptionKey::PAGE_NUMBER, Val(0)).toInt();
-    if (PAGE_NUMBER >= pages.size()) {
-        return false;
+    // Set color for elements on beats
+    BeatsColors beatsColors = parseBeatsColors(muse::value(options, OptionKey::BEATS_COLORS, Val()).toQVariant());
+    if (beatsColors.isEmpty()) {
+        return;
     }
 
-    mu::engraving::Page* page = pages.at(PAGE_NUMBER);
+    int beatIndex = 0;
+    for (const mu::engraving::RepeatSegment* repeatSegment : score->repeatList()) {
+        for (const mu::engraving::Measure* measure : repeatSegment->measureList()) {
+            for (mu::engraving::Segment* segment = measure->first(); segment; segment = segment->next()) {
+                if (!segment->isChordRestType()) {
+                    continue;
+                }
 
-    QByteArray qdata;
-    QBuffer buf(&qdata);
-    buf.open(QIODevice::WriteOnly);
+                if (beatsColors.contains(beatIndex)) {
+                    for (EngravingItem* element : segment->elist()) {
+                        if (!element) {
+                            continue;
+                        }
 
-    SvgGenerator printer;
-    QString title(score->name());
-    printer.setTitle(pages.size() > 1 ? QString("%1 (%2)").arg(title).arg(PAGE_NUMBER + 1) : title);
-    printer.setOutputDevice(&buf);
+                        if (element->isChord()) {
+                            for (Note* note : toChord(element)->notes()) {
+                                note->setColor(beatsColors[beatIndex]);
+                            }
+                        } else if (element->isChordRest()) {
+                            element->setColor(beatsColors[beatIndex]);
+                        }
+                    }
+                }
+
+                beatIndex++;
+            }
+        }
+    }
+}
+
+void SvgWriter::endPrinting(mu::engraving::Score* score, double pixelRatioBackup) const
+{
+    mu::engraving::MScore::pixelRatio = pixelRatioBackup;
+    score->setPrinting(false);
+    mu::engraving::MScore::pdfPrinting = false;
+    mu::engraving::MScore::svgPrinting = false;
+}
 
+SvgWriter::PageOptions SvgWriter::pageOptions(const mu::engraving::Score* score, size_t pageIndex, const Options& options) const
+{
+    const std::vector<mu::engraving::Page*>& pages = score->pages();
+
+    const mu::engraving::Page* page = pages.at(pageIndex);
     const int TRIM_MARGIN_SIZE = configuration()->trimMarginPixelSize();
 
-    RectF pageRect = page->abbox();
-    if (TRIM_MARGIN_SIZE >= 0) {
-        pageRect = page->tbbox().adjusted(-TRIM_MARGIN_SIZE, -TRIM_MARGIN_SIZE, TRIM_MARGIN_SIZE, TRIM_MARGIN_SIZE);
-    }
+    PageOptions opt;
 
-    qreal width = pageRect.width();
-    qreal height = pageRect.height();
-    printer.setSize(QSize(width, height));
-    printer.setViewBox(QRectF(0, 0, width, height));
+    QString title(score->name());
+    opt.title = pages.size() > 1 ? QString("%1 (%2)").arg(title).arg(pageIndex + 1) : title;
 
-    muse::draw::Painter painter(&printer, "svgwriter");
-    painter.setAntialiasing(true);
-    if (TRIM_MARGIN_SIZE >= 0) {
-        painter.translate(-pageRect.topLeft());
+    opt.trimMargin = TRIM_MARGIN_SIZE >= 0;
+    opt.pageRect = page->abbox();
+    if (opt.trimMargin) {
+        opt.pageRect = page->tbbox().adjusted(-TRIM_MARGIN_SIZE, -TRIM_MARGIN_SIZE, TRIM_MARGIN_SIZE, TRIM_MARGIN_SIZE);
     }
 
-    mu::engraving::MScore::pixelRatio = mu::engraving::DPI / printer.logicalDpiX();
+    opt.transparentBackground = muse::value(options, OptionKey::TRANSPARENT_BACKGROUND,
+                                            Val(configuration()->exportSvgWithTransparentBackground())).toBool();
+    opt.elementIds = muse::value(options, OptionKey::ELEMENT_IDS, Val(false)).toBool();
+    opt.description = QString("Generated by MuseScore Studio %1").arg(application()->version().toString());
 
-    const bool TRANSPARENT_BACKGROUND = muse::value(options, OptionKey::TRANSPARENT_BACKGROUND,
-                                                    Val(configuration()->exportSvgWithTransparentBackground())).toBool();
-    if (!TRANSPARENT_BACKGROUND) {
-        painter.fillRect(pageRect, muse::draw::Color::WHITE);
-    }
+    return opt;
+}
+
+SvgWriter::PageItems SvgWriter::pageItems(const mu::engraving::Score* score, const mu::engraving::Page* page,
+                                            std::vector<std::unique_ptr<mu::engraving::StaffLines> >& concatenatedStaffLines) const
+{
+    PageItems items;
+
+    auto addConcatenatedStaffLines = [&items, &concatenatedStaffLines](mu::engraving::StaffLines* staffLines) {
+        concatenatedStaffLines.emplace_back(staffLines);
+        items.push_back(staffLines);
+    };
 
     // 1st pass: StaffLines
     for (const mu::engraving::System* system : page->systems()) {
@@ -141,8 +247,7 @@ Ret SvgWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
             for (mu::engraving::MeasureBase* measure = firstMeasure; measure; measure = system->nextMeasure(measure)) {
                 if (!measure->isMeasure()) {
                     if (concatenatedSL != nullptr) {
-                        printer.setElement(concatenatedSL);
-                        scoreRenderer()->paintItem(painter, concatenatedSL);
+                        addConcatenatedStaffLines(concatenatedSL);
                         concatenatedSL = nullptr;
                         prevStaffType = nullptr;
                     }
@@ -155,8 +260,7 @@ Ret SvgWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
                 if ((!m->visible(staffIndex) && !m->isCutawayClef(staffIndex)) || !sl->visible()
                     || (score->staff(staffIndex)->staffType(m->tick()) != prevStaffType)) {
                     if (concatenatedSL != nullptr) {
-                        printer.setElement(concatenatedSL);
-                        scoreRenderer()->paintItem(painter, concatenatedSL);
+                        addConcatenatedStaffLines(concatenatedSL);
                         concatenatedSL = nullptr;
                         prevStaffType = nullptr;
                     }
@@ -179,47 +283,14 @@ Ret SvgWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
                 }
             }
             if (concatenatedSL != nullptr) {
-                printer.setElement(concatenatedSL);
-                scoreRenderer()->paintItem(painter, concatenatedSL);
+                addConcatenatedStaffLines(concatenatedSL);
                 concatenatedSL = nullptr;
                 prevStaffType = nullptr;
             }
         }
     }
 
-    BeatsColors beatsColors = parseBeatsColors(muse::value(options, OptionKey::BEATS_COLORS, Val()).toQVariant());
-
-    // 2nd pass: Set color for elements on beats
-    int beatIndex = 0;
-    for (const mu::engraving::RepeatSegment* repeatSegment : score->repeatList()) {
-        for (const mu::engraving::Measure* measure : repeatSegment->measureList()) {
-            for (mu::engraving::Segment* segment = measure->first(); segment; segment = segment->next()) {
-                if (!segment->isChordRestType()) {
-                    continue;
-                }
-
-                if (beatsColors.contains(beatIndex)) {
-                    for (EngravingItem* element : segment->elist()) {
-                        if (!element) {
-                            continue;
-                        }
-
-                        if (element->isChord()) {
-                            for (Note* note : toChord(element)->notes()) {
-                                note->setColor(beatsColors[beatIndex]);
-                            }
-                        } else if (element->isChordRest()) {
-                            element->setColor(beatsColors[beatIndex]);
-                        }
-                    }
-                }
-
-                beatIndex++;
-            }
-        }
-    }
-
-    // 3rd pass: the rest of the elements
+    // 2nd pass: the rest of the elements
     std::vector<mu::engraving::EngravingItem*> elements = page->elements();
     std::sort(elements.begin(), elements.end(), mu::engraving::elementLessThan);
 
@@ -238,25 +309,45 @@ Ret SvgWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
             break;
         }
 
-        // Set the EngravingItem pointer inside SvgGenerator/SvgPaintEngine
-        printer.setElement(element);
+        items.push_back(element);
+    }
 
-        // Paint it
-        scoreRenderer()->paintItem(painter, element);
+    return items;
+}
+
+ByteArray SvgWriter::paintPage(const mu::engraving::rendering::IScoreRenderer* renderer, const PageOptions& opt, const PageItems& items)
+{
+    const RectF& pageRect = opt.pageRect;
+
+    SvgPaintProvider::DocumentOptions docOpt;
+    docOpt.title = opt.title;
+    docOpt.description = opt.description;
+    docOpt.size = pageRect.size();
+    docOpt.elementIds = opt.elementIds;
+
+    auto printer = std::make_shared<SvgPaintProvider>(docOpt);
+
+    muse::draw::Painter painter(printer, "svgwriter");
+    painter.setAntialiasing(true);
+    if (opt.trimMargin) {
+        painter.translate(-pageRect.topLeft());
     }
 
-    painter.endDraw();
+    if (!opt.transparentBackground) {
+        painter.fillRect(pageRect, muse::draw::Color::WHITE);
+    }
 
-    ByteArray data = ByteArray::fromQByteArrayNoCopy(qdata);
-    destinationDevice.write(data);
+    for (const mu::engraving::EngravingItem* item : items) {
+        // Set the EngravingItem pointer for the class and id attributes
+        printer->setElement(item);
 
-    // Clean up and return
-    mu::engraving::MScore::pixelRatio = pixelRationBackup;
-    score->setPrinting(false);
-    mu::engraving::MScore::pdfPrinting = false;
-    mu::engraving::MScore::svgPrinting = false;
+        // Paint it
+        renderer->paintItem(painter, item);
+    }
 
-    return true;
+    painter.endDraw();
+
+    return printer->data();
 }
 
 SvgWriter::BeatsColors SvgWriter::parseBeatsColors(const QVariant& obj) const
@@ -23,26 +23,60 @@
 #ifndef MU_IMPORTEXPORT_SVGWRITER_H
 #define MU_IMPORTEXPORT_SVGWRITER_H
 
+#include <memory>
+
 #include "abstractimagewriter.h"
 
 #include "modularity/ioc.h"
+#include "global/iapplication.h"
 #include "../iimagesexportconfiguration.h"
 #include "engraving/rendering/iscorerenderer.h"
 
+namespace mu::engraving {
+class EngravingItem;
+class Page;
+class Score;
+class StaffLines;
+}
+
 namespace mu::iex::imagesexport {
 class SvgWriter : public AbstractImageWriter
 {
     INJECT(IImagesExportConfiguration, configuration)
     INJECT(engraving::rendering::IScoreRenderer, scoreRenderer)
+    INJECT(muse::IApplication, application)
 
 public:
     std::vector<project::INotationWriter::UnitType> supportedUnitTypes() const override;
     muse::Ret write(notation::INotationPtr notation, muse::io::IODevice& dstDevice, const Options& options = Options()) override;
+    muse::Ret writePages(notation::INotationPtr notation, const std::vector<size_t>& pageIndexes,
+                         const PageWrittenCallback& onPageWritten, const Options& options = Options()) override;
 
 private:
     using BeatsColors = QHash<int /* beatIndex */, QColor>;
+    using PageItems = std::vector<const engraving::EngravingItem*>;
+
+    struct PageOptions {
+        QString title;
+        QString description;
+        muse::RectF pageRect;
+        bool trimMargin = false;
+        bool transparentBackground = false;
+        bool elementIds = false;
+    };
 
     BeatsColors parseBeatsColors(const QVariant& obj) const;
+
+    void beginPrinting(engraving::Score* score, const Options& options) const;
+    void endPrinting(engraving::Score* score, double pixelRatioBackup) const;
+
+    PageOptions pageOptions(const engraving::Score* score, size_t pageIndex, const Options& options) const;
+    PageItems pageItems(const engraving::Score* score, const engraving::Page* page,
+                        std::vector<std::unique_ptr<engraving::StaffLines> >& concatenatedStaffLines) const;
+
+    //! NOTE Only reads the score, it is set up once for all the pages
+    static muse::ByteArray paintPage(const engraving::rendering::IScoreRenderer* renderer, const PageOptions& opt,
+                                     const PageItems& items);
 };
 }
 
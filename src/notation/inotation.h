@@ -103,6 +103,10 @@ public:
 
     // notify
     virtual muse::async::Notification notationChanged() const = 0;
+
+    //! NOTE The layout of the parts that are not shown is deferred (see Score::setLayoutDeferred).
+    //! Lays out the first pages when the notation is about to be shown, the other ones follow progressively
+    virtual void ensureLaidOut() = 0;
 };
 }
 
@@ -146,6 +146,15 @@ public:
     virtual void setIsLimitCanvasScrollArea(bool limited) = 0;
     virtual muse::async::Notification isLimitCanvasScrollAreaChanged() const = 0;
 
+    virtual bool isTiledRenderingEnabled() const = 0;
+    virtual void setIsTiledRenderingEnabled(bool enabled) = 0;
+    virtual muse::async::Notification isTiledRenderingEnabledChanged() const = 0;
+
+    virtual double simplifiedPaintingSpatiumSize() const = 0;
+    virtual void setSimplifiedPaintingSpatiumSize(double size) = 0;
+    virtual double staffLinesOnlyPaintingSpatiumSize() const = 0;
+    virtual void setStaffLinesOnlyPaintingSpatiumSize(double size) = 0;
+
     virtual bool colorNotesOutsideOfUsablePitchRange() const = 0;
     virtual void setColorNotesOutsideOfUsablePitchRange(bool value) = 0;
 
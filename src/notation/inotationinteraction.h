@@ -109,6 +109,7 @@ public:
     virtual void setDropTarget(const EngravingItem* item, bool notify = true) = 0;
     virtual void setDropRect(const muse::RectF& rect) = 0;
     virtual void endDrop() = 0;
+    virtual bool isDropStarted() const = 0;
     virtual muse::async::Notification dropChanged() const = 0;
 
     virtual bool applyPaletteElement(mu::engraving::EngravingItem* element, Qt::KeyboardModifiers modifiers = {}) = 0;
@@ -45,10 +45,30 @@ public:
     virtual muse::SizeF pageSizeInch() const = 0;
     virtual muse::SizeF pageSizeInch(const Options& opt) const = 0;
 
+    //! NOTE The visible part of the canvas. In continuous view, the measures scrolled into view
+    //! are laid out (see Score::setLayoutViewport) and notationChanged is sent
+    virtual void setVisibleRect(const muse::RectF& visibleRect) = 0;
+
     virtual void paintView(muse::draw::Painter* painter, const muse::RectF& frameRect, bool isPrinting) = 0;
+
+    struct PageTile {
+        Page* page = nullptr;
+        muse::RectF rect;                           // in page coordinates
+        muse::draw::Painter* painter = nullptr;     // already transformed to page coordinates
+    };
+
+    //! NOTE Paints the page sheet and the score elements (without interaction elements) of each tile, clipped to the tile rect.
+    //! Tiles are painted on the calling thread: the fonts, symbol and pixmap caches used by painting aren't thread-safe
+    virtual void paintPageTiles(const std::vector<PageTile>& tiles, bool isPrinting) = 0;
+    virtual void paintInteraction(muse::draw::Painter* painter) = 0;
     virtual void paintPdf(muse::draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPrint(muse::draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPng(muse::draw::Painter* painter, const Options& opt) = 0;
+
+    //! NOTE Sets up the print state for opt.deviceDpi and records the pages from opt.fromPage to opt.toPage once,
+    //! so that painting these pages one by one with paintPdf, paintPrint and paintPng (with the same deviceDpi)
+    //! doesn't set them up again, as long as the score does not change
+    virtual void preparePrint(const Options& opt) = 0;
 };
 
 using INotationPaintingPtr = std::shared_ptr<INotationPainting>;
@@ -620,7 +620,9 @@ void MasterNotation::setExcerptIsOpen(const INotationPtr excerptNotation, bool o
     excerptNotation->setIsOpen(open);
 
     if (open) {
-        excerptNotation->elements()->msScore()->doLayout();
+        //! NOTE The layout of a closed part is out of date,
+        //! it is laid out again when the part is shown
+        excerptNotation->elements()->msScore()->setLayoutDeferred(true);
     }
 }
 
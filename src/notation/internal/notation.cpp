@@ -24,6 +24,8 @@
 #include <QGuiApplication>
 #include <QScreen>
 
+#include "async/async.h"
+
 #include "engraving/dom/masterscore.h"
 
 #include "notationpainting.h"
@@ -44,6 +46,9 @@
 using namespace mu::notation;
 using namespace mu::engraving;
 
+// the number of pages laid out at once by a progressive layout
+static constexpr size_t PROGRESSIVE_LAYOUT_PAGES_PER_STEP = 4;
+
 Notation::Notation(mu::engraving::Score* score)
 {
     m_painting = std::make_shared<NotationPainting>(this);
@@ -130,6 +135,8 @@ void Notation::setScore(Score* score)
 
     m_score = score;
     m_scoreInited.notify();
+
+    continueProgressiveLayout();
 }
 
 muse::async::Notification Notation::scoreInited() const
@@ -309,6 +316,46 @@ muse::async::Notification Notation::notationChanged() const
     return m_notationChanged;
 }
 
+void Notation::ensureLaidOut()
+{
+    if (!m_score || !m_score->isLayoutDeferred()) {
+        return;
+    }
+
+    m_score->layoutNextPages(PROGRESSIVE_LAYOUT_PAGES_PER_STEP);
+    notifyAboutNotationChanged();
+
+    continueProgressiveLayout();
+}
+
+void Notation::continueProgressiveLayout()
+{
+    //! NOTE The score can only be changed from the main thread,
+    //! so the remaining pages are laid out in small steps between the events
+    //! A deferred layout is started by ensureLaidOut()
+    if (!m_score || m_progressiveLayoutScheduled || m_score->isLayoutDeferred() || m_score->isLayoutComplete()) {
+        return;
+    }
+
+    m_progressiveLayoutScheduled = true;
+
+    muse::async::Async::call(this, [this]() {
+        m_progressiveLayoutScheduled = false;
+
+        if (!m_score) {
+            return;
+        }
+
+        bool complete = m_score->layoutNextPages(PROGRESSIVE_LAYOUT_PAGES_PER_STEP);
+
+        notifyAboutNotationChanged();
+
+        if (!complete) {
+            continueProgressiveLayout();
+        }
+    });
+}
+
 INotationAccessibilityPtr Notation::accessibility() const
 {
     return m_accessibility;
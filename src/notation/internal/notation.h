@@ -78,6 +78,7 @@ public:
     INotationPartsPtr parts() const override;
 
     muse::async::Notification notationChanged() const override;
+    void ensureLaidOut() override;
 
 protected:
     mu::engraving::Score* score() const override;
@@ -85,6 +86,7 @@ protected:
     muse::async::Notification scoreInited() const override;
 
     void notifyAboutNotationChanged();
+    void continueProgressiveLayout();
 
     INotationPartsPtr m_parts = nullptr;
     INotationUndoStackPtr m_undoStack = nullptr;
@@ -99,6 +101,8 @@ private:
 
     muse::async::Notification m_openChanged;
 
+    bool m_progressiveLayoutScheduled = false;
+
     INotationPaintingPtr m_painting = nullptr;
     INotationViewStatePtr m_viewState = nullptr;
     INotationSoloMuteStatePtr m_soloMuteState = nullptr;
@@ -27,6 +27,7 @@
 
 #include "engraving/dom/note.h"
 #include "engraving/dom/text.h"
+#include "engraving/rendering/dev/layoutprofiler.h"
 
 #include "translation.h"
 #include "log.h"
@@ -66,7 +67,8 @@ const std::unordered_map<ActionCode, bool EngravingDebuggingOptions::*> Notation
     { "color-segment-shapes", &EngravingDebuggingOptions::colorSegmentShapes },
     { "show-skylines", &EngravingDebuggingOptions::showSkylines },
     { "show-system-bounding-rects", &EngravingDebuggingOptions::showSystemBoundingRects },
-    { "show-corrupted-measures", &EngravingDebuggingOptions::showCorruptedMeasures }
+    { "show-corrupted-measures", &EngravingDebuggingOptions::showCorruptedMeasures },
+    { "record-layout-profile", &EngravingDebuggingOptions::recordLayoutProfile }
 };
 
 void NotationActionController::init()
@@ -295,6 +297,7 @@ void NotationActionController::init()
 
     registerAction("load-style", &Controller::loadStyle);
     registerAction("save-style", &Controller::saveStyle);
+    registerAction("save-layout-profile", &Controller::saveLayoutProfile);
 
     registerAction("voice-x12", &Interaction::swapVoices, 0, 1);
     registerAction("voice-x13", &Interaction::swapVoices, 0, 2);
@@ -1642,6 +1645,22 @@ void NotationActionController::saveStyle()
     }
 }
 
+void NotationActionController::saveLayoutProfile()
+{
+    TRACEFUNC;
+    std::vector<std::string> filter = { muse::trc("notation", "Chrome trace files") + " (*.json)" };
+    muse::io::path_t path = interactive()->selectSavingFile(muse::qtrc("notation", "Save layout profile"),
+                                                            configuration()->userStylesPath(), filter);
+    if (path.empty()) {
+        return;
+    }
+
+    if (!mu::engraving::rendering::dev::LayoutProfiler::instance()->writeChromeTrace(path)) {
+        interactive()->error(muse::trc("notation", "The layout profile could not be saved."),
+                             muse::trc("notation", "An error occurred."));
+    }
+}
+
 FilterElementsOptions NotationActionController::elementsFilterOptions(const EngravingItem* element) const
 {
     TRACEFUNC;
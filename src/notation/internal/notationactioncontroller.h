@@ -156,6 +156,7 @@ private:
     muse::io::path_t selectStyleFile(bool forLoad);
     void loadStyle();
     void saveStyle();
+    void saveLayoutProfile();
 
     void toggleScoreConfig(ScoreConfigType configType);
     void toggleConcertPitch();
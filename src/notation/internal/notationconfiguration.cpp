@@ -69,6 +69,9 @@ static const Settings::Key TOOLBAR_KEY(module_name, "ui/toolbar/");
 
 static const Settings::Key IS_CANVAS_ORIENTATION_VERTICAL_KEY(module_name, "ui/canvas/scroll/verticalOrientation");
 static const Settings::Key IS_LIMIT_CANVAS_SCROLL_AREA_KEY(module_name, "ui/canvas/scroll/limitScrollArea");
+static const Settings::Key IS_TILED_RENDERING_ENABLED_KEY(module_name, "ui/canvas/misc/tiledRendering");
+static const Settings::Key SIMPLIFIED_PAINTING_SPATIUM_SIZE_KEY(module_name, "ui/canvas/misc/simplifiedPaintingSpatiumSize");
+static const Settings::Key STAFF_LINES_ONLY_PAINTING_SPATIUM_SIZE_KEY(module_name, "ui/canvas/misc/staffLinesOnlyPaintingSpatiumSize");
 
 static const Settings::Key COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE(module_name, "score/note/warnPitchRange");
 static const Settings::Key WARN_GUITAR_BENDS(module_name, "score/note/warnGuitarBends");
@@ -185,6 +188,18 @@ void NotationConfiguration::init()
         m_isLimitCanvasScrollAreaChanged.notify();
     });
 
+    settings()->setDefaultValue(IS_TILED_RENDERING_ENABLED_KEY, Val(false));
+    settings()->setCanBeManuallyEdited(IS_TILED_RENDERING_ENABLED_KEY, true);
+    settings()->valueChanged(IS_TILED_RENDERING_ENABLED_KEY).onReceive(this, [this](const Val&) {
+        m_isTiledRenderingEnabledChanged.notify();
+    });
+
+    //! NOTE In device pixels per spatium, 0 disables
+    settings()->setDefaultValue(SIMPLIFIED_PAINTING_SPATIUM_SIZE_KEY, Val(2.5));
+    settings()->setCanBeManuallyEdited(SIMPLIFIED_PAINTING_SPATIUM_SIZE_KEY, true);
+    settings()->setDefaultValue(STAFF_LINES_ONLY_PAINTING_SPATIUM_SIZE_KEY, Val(1.0));
+    settings()->setCanBeManuallyEdited(STAFF_LINES_ONLY_PAINTING_SPATIUM_SIZE_KEY, true);
+
     settings()->setDefaultValue(COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE, Val(true));
     settings()->setDefaultValue(WARN_GUITAR_BENDS, Val(true));
     settings()->setDefaultValue(REALTIME_DELAY, Val(750));
@@ -660,6 +675,41 @@ Notification NotationConfiguration::isLimitCanvasScrollAreaChanged() const
     return m_isLimitCanvasScrollAreaChanged;
 }
 
+bool NotationConfiguration::isTiledRenderingEnabled() const
+{
+    return settings()->value(IS_TILED_RENDERING_ENABLED_KEY).toBool();
+}
+
+void NotationConfiguration::setIsTiledRenderingEnabled(bool enabled)
+{
+    settings()->setSharedValue(IS_TILED_RENDERING_ENABLED_KEY, Val(enabled));
+}
+
+Notification NotationConfiguration::isTiledRenderingEnabledChanged() const
+{
+    return m_isTiledRenderingEnabledChanged;
+}
+
+double NotationConfiguration::simplifiedPaintingSpatiumSize() const
+{
+    return settings()->value(SIMPLIFIED_PAINTING_SPATIUM_SIZE_KEY).toDouble();
+}
+
+void NotationConfiguration::setSimplifiedPaintingSpatiumSize(double size)
+{
+    settings()->setSharedValue(SIMPLIFIED_PAINTING_SPATIUM_SIZE_KEY, Val(size));
+}
+
+double NotationConfiguration::staffLinesOnlyPaintingSpatiumSize() const
+{
+    return settings()->value(STAFF_LINES_ONLY_PAINTING_SPATIUM_SIZE_KEY).toDouble();
+}
+
+void NotationConfiguration::setStaffLinesOnlyPaintingSpatiumSize(double size)
+{
+    settings()->setSharedValue(STAFF_LINES_ONLY_PAINTING_SPATIUM_SIZE_KEY, Val(size));
+}
+
 bool NotationConfiguration::colorNotesOutsideOfUsablePitchRange() const
 {
     return settings()->value(COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE).toBool();
@@ -151,6 +151,15 @@ public:
     void setIsLimitCanvasScrollArea(bool limited) override;
     muse::async::Notification isLimitCanvasScrollAreaChanged() const override;
 
+    bool isTiledRenderingEnabled() const override;
+    void setIsTiledRenderingEnabled(bool enabled) override;
+    muse::async::Notification isTiledRenderingEnabledChanged() const override;
+
+    double simplifiedPaintingSpatiumSize() const override;
+    void setSimplifiedPaintingSpatiumSize(double size) override;
+    double staffLinesOnlyPaintingSpatiumSize() const override;
+    void setStaffLinesOnlyPaintingSpatiumSize(double size) override;
+
     bool colorNotesOutsideOfUsablePitchRange() const override;
     void setColorNotesOutsideOfUsablePitchRange(bool value) override;
 
@@ -221,6 +230,7 @@ private:
     muse::async::Channel<muse::io::path_t> m_userStylesPathChanged;
     muse::async::Notification m_scoreOrderListPathsChanged;
     muse::async::Notification m_isLimitCanvasScrollAreaChanged;
+    muse::async::Notification m_isTiledRenderingEnabledChanged;
     muse::async::Notification m_isPlayRepeatsChanged;
     muse::async::Notification m_isPlayChordSymbolsChanged;
     muse::ValCh<int> m_pianoKeyboardNumberOfKeys;
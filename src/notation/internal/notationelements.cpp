@@ -125,6 +125,8 @@ mu::engraving::Measure* NotationElements::measure(const int measureIndex) const
 
 PageList NotationElements::pages() const
 {
+    //! NOTE Only the pages laid out so far, if the score is laid out progressively.
+    //! Export, print and plugins complete the layout themselves (see Score::ensureLayoutComplete)
     PageList result;
     for (const Page* page : score()->pages()) {
         result.push_back(page);
@@ -140,7 +142,13 @@ const Page* NotationElements::pageByPoint(const PointF& point) const
 
 mu::engraving::Page* NotationElements::page(const int pageIndex) const
 {
-    if (pageIndex < 0 || size_t(pageIndex) >= score()->pages().size()) {
+    if (pageIndex < 0) {
+        return nullptr;
+    }
+
+    score()->ensurePageLaidOut(static_cast<mu::engraving::page_idx_t>(pageIndex));
+
+    if (size_t(pageIndex) >= score()->pages().size()) {
         return nullptr;
     }
 
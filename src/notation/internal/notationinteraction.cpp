@@ -295,9 +295,43 @@ void NotationInteraction::notifyAboutSelectionChangedIfNeed()
 
     score()->setSelectionChanged(false);
 
+    ensureSelectionLaidOut();
+
     m_selectionChanged.notify();
 }
 
+void NotationInteraction::ensureSelectionLaidOut()
+{
+    mu::engraving::Score* score = this->score();
+    if (score->isLayoutComplete()) {
+        return;
+    }
+
+    //! NOTE While the score is laid out progressively, a selection can reach measures without a system,
+    //! but the selection range and the view expect them to be laid out
+    auto isLaidOut = [](const Measure* m) {
+        return !m || m->coveringMMRestOrThis()->system();
+    };
+
+    const mu::engraving::Selection& sel = score->selection();
+    bool laidOut = true;
+
+    if (sel.isRange()) {
+        laidOut = isLaidOut(sel.endSegment() ? sel.endSegment()->measure() : score->lastMeasure());
+    } else {
+        for (const EngravingItem* item : sel.elements()) {
+            if (!isLaidOut(item->findMeasure())) {
+                laidOut = false;
+                break;
+            }
+        }
+    }
+
+    if (!laidOut) {
+        score->ensureLayoutComplete();
+    }
+}
+
 void NotationInteraction::notifyAboutNoteInputStateChanged()
 {
     m_noteInput->stateChanged().notify();
@@ -557,8 +591,6 @@ std::vector<EngravingItem*> NotationInteraction::hitElements(const PointF& pos,
     };
 
     for (EngravingItem* element : potentiallyHitElements) {
-        element->itemDiscovered = 0;
-
         if (!canHitElement(element)) {
             continue;
         }
@@ -2245,6 +2277,11 @@ void NotationInteraction::endDrop()
     setDropTarget(nullptr);
 }
 
+bool NotationInteraction::isDropStarted() const
+{
+    return m_dropData.ed.dropElement || m_dropData.dropTarget;
+}
+
 muse::async::Notification NotationInteraction::dropChanged() const
 {
     return m_dropChanged;
@@ -2636,14 +2673,16 @@ void NotationInteraction::expandSelection(ExpandSelectionMode mode)
     ChordRest* el = 0;
     switch (mode) {
     case ExpandSelectionMode::BeginSystem: {
-        Measure* measure = cr->segment()->measure()->system()->firstMeasure();
+        System* system = cr->segment()->measure()->system();
+        Measure* measure = system ? system->firstMeasure() : nullptr;
         if (measure) {
             el = measure->first()->nextChordRest(cr->track());
         }
         break;
     }
     case ExpandSelectionMode::EndSystem: {
-        Measure* measure = cr->segment()->measure()->system()->lastMeasure();
+        System* system = cr->segment()->measure()->system();
+        Measure* measure = system ? system->lastMeasure() : nullptr;
         if (measure) {
             el = measure->last()->nextChordRest(cr->track(), true);
         }
@@ -35,6 +35,7 @@
 #include "../iselectinstrumentscenario.h"
 #include "inotationundostack.h"
 
+#include "engraving/dom/bsp.h"
 #include "engraving/dom/engravingitem.h"
 #include "engraving/dom/elementgroup.h"
 #include "scorecallbacks.h"
@@ -116,6 +117,7 @@ public:
     void setDropTarget(const EngravingItem* item, bool notify = true) override;
     void setDropRect(const muse::RectF& rect) override;
     void endDrop() override;
+    bool isDropStarted() const override;
     muse::async::Notification dropChanged() const override;
 
     bool applyPaletteElement(mu::engraving::EngravingItem* element, Qt::KeyboardModifiers modifiers = {}) override;
@@ -318,6 +320,7 @@ private:
     void notifyAboutDragChanged();
     void notifyAboutDropChanged();
     void notifyAboutSelectionChangedIfNeed();
+    void ensureSelectionLaidOut();
     void notifyAboutNotationChanged();
     void notifyAboutTextEditingStarted();
     void notifyAboutTextEditingChanged();
@@ -23,6 +23,8 @@
 
 #include <QScreen>
 
+#include "engraving/dom/mscore.h"
+#include "engraving/dom/page.h"
 #include "engraving/dom/score.h"
 
 #include "notation.h"
@@ -82,6 +84,7 @@ int NotationPainting::pageCount() const
         return 0;
     }
 
+    //! NOTE Only the pages laid out so far, if the score is laid out progressively
     return static_cast<int>(score()->npages());
 }
 
@@ -117,6 +120,10 @@ void NotationPainting::doPaint(Painter* painter, const Options& opt)
         return;
     }
 
+    if (opt.isPrinting) {
+        ensurePagesLaidOut(opt);
+    }
+
     Options myopt = opt;
     bool printPageBackground = myopt.printPageBackground;
     myopt.onPaintPageSheet = [this, printPageBackground](Painter* painter, const Page* page, const RectF& pageRect) {
@@ -126,10 +133,38 @@ void NotationPainting::doPaint(Painter* painter, const Options& opt)
     scoreRenderer()->paintScore(painter, score(), myopt);
 
     if (!myopt.isPrinting) {
-        static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
+        paintInteraction(painter);
     }
 }
 
+void NotationPainting::ensurePagesLaidOut(const Options& opt)
+{
+    //! NOTE The view paints what is already laid out, but printing needs the requested pages
+    if (opt.toPage >= 0) {
+        score()->ensurePageLaidOut(static_cast<engraving::page_idx_t>(opt.toPage));
+    } else {
+        score()->ensureLayoutComplete();
+    }
+}
+
+void NotationPainting::setVisibleRect(const RectF& visibleRect)
+{
+    //! NOTE In continuous view only the measures near the viewport are laid out completely,
+    //! the ones that have just been scrolled into view are laid out here, outside of painting
+    if (!score() || !score()->layoutOptions().isLinearMode()) {
+        return;
+    }
+
+    if (score()->setLayoutViewport(visibleRect.x(), visibleRect.width())) {
+        m_notation->notifyAboutNotationChanged();
+    }
+}
+
+void NotationPainting::paintInteraction(Painter* painter)
+{
+    static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
+}
+
 void NotationPainting::paintPageSheet(Painter* painter, const Page* page, const RectF& pageRect, bool printPageBackground) const
 {
     TRACEFUNC;
@@ -186,9 +221,44 @@ void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool
     opt.frameRect = frameRect;
     opt.deviceDpi = uiConfiguration()->logicalDpi();
     opt.isPrinting = isPrinting;
+    opt.simplifiedSpatiumSize = configuration()->simplifiedPaintingSpatiumSize();
+    opt.staffLinesOnlySpatiumSize = configuration()->staffLinesOnlyPaintingSpatiumSize();
     doPaint(painter, opt);
 }
 
+void NotationPainting::paintPageTiles(const std::vector<PageTile>& tiles, bool isPrinting)
+{
+    TRACEFUNC;
+    if (!score() || tiles.empty()) {
+        return;
+    }
+
+    //! NOTE The global paint state is set up once for all the tiles
+    const int deviceDpi = uiConfiguration()->logicalDpi();
+    MScore::pixelRatio = engraving::DPI / deviceDpi;
+    score()->setPrinting(isPrinting);
+    MScore::pdfPrinting = isPrinting;
+
+    for (const PageTile& tile : tiles) {
+        tile.page->displayList().update(tile.page, [this](Painter& painter, const std::vector<EngravingItem*>& items) {
+            scoreRenderer()->paintItems(painter, items);
+        });
+
+        Painter* painter = tile.painter;
+        const RectF pageRect = tile.page->ldata()->bbox();
+
+        //! NOTE The painter might be the one of the view, so nothing is painted outside of the tile
+        painter->setAntialiasing(true);
+        painter->setClipping(true);
+        painter->setClipRect(tile.rect);
+        paintPageSheet(painter, tile.page, pageRect, true);
+
+        painter->setClipRect(tile.rect.intersected(pageRect));
+        tile.page->displayList().paint(*painter, tile.rect);
+        painter->setClipping(false);
+    }
+}
+
 void NotationPainting::paintPdf(Painter* painter, const Options& opt)
 {
     Q_ASSERT(opt.deviceDpi > 0);
@@ -218,3 +288,35 @@ void NotationPainting::paintPng(Painter* painter, const Options& opt)
     myopt.isPrinting = true;
     doPaint(painter, myopt);
 }
+
+void NotationPainting::preparePrint(const Options& opt)
+{
+    TRACEFUNC;
+    Q_ASSERT(opt.deviceDpi > 0);
+    if (!score()) {
+        return;
+    }
+
+    //! NOTE Painting then finds the state already set up and only reads it
+    MScore::pixelRatio = engraving::DPI / opt.deviceDpi;
+    score()->setPrinting(true);
+    MScore::pdfPrinting = true;
+
+    ensurePagesLaidOut(opt);
+
+    const std::vector<Page*>& pages = score()->pages();
+    if (pages.empty()) {
+        return;
+    }
+
+    const size_t fromPage = opt.fromPage >= 0 ? static_cast<size_t>(opt.fromPage) : 0;
+    const size_t toPage = (opt.toPage >= 0 && static_cast<size_t>(opt.toPage) < pages.size())
+                          ? static_cast<size_t>(opt.toPage) : pages.size() - 1;
+
+    for (size_t i = fromPage; i <= toPage; ++i) {
+        Page* page = pages.at(i);
+        page->displayList().update(page, [this](Painter& painter, const std::vector<EngravingItem*>& items) {
+            scoreRenderer()->paintItems(painter, items);
+        });
+    }
+}
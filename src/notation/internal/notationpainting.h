@@ -55,16 +55,22 @@ public:
     muse::SizeF pageSizeInch() const override;
     muse::SizeF pageSizeInch(const Options& opt) const override;
 
+    void setVisibleRect(const muse::RectF& visibleRect) override;
+
     void paintView(muse::draw::Painter* painter, const muse::RectF& frameRect, bool isPrinting) override;
+    void paintPageTiles(const std::vector<PageTile>& tiles, bool isPrinting) override;
+    void paintInteraction(muse::draw::Painter* painter) override;
     void paintPdf(muse::draw::Painter* painter, const Options& opt) override;
     void paintPrint(muse::draw::Painter* painter, const Options& opt) override;
     void paintPng(muse::draw::Painter* painter, const Options& opt) override;
+    void preparePrint(const Options& opt) override;
 
 private:
     mu::engraving::Score* score() const;
 
     bool isPaintPageBorder() const;
     void doPaint(muse::draw::Painter* painter, const Options& opt);
+    void ensurePagesLaidOut(const Options& opt);
     void paintPageBorder(muse::draw::Painter* painter, const mu::engraving::Page* page) const;
     void paintPageSheet(muse::draw::Painter* painter, const engraving::Page* page, const muse::RectF& pageRect,
                         bool printPageBackground) const;
@@ -2455,6 +2455,17 @@ const UiActionList NotationUiActions::m_engravingDebuggingActions = {
              TranslatableString("action", "Show corrupted measures"),
              Checkable::Yes
              ),
+    UiAction("record-layout-profile",
+             mu::context::UiCtxNotationOpened,
+             mu::context::CTX_NOTATION_OPENED,
+             TranslatableString("action", "Record layout profile"),
+             Checkable::Yes
+             ),
+    UiAction("save-layout-profile",
+             mu::context::UiCtxNotationOpened,
+             mu::context::CTX_NOTATION_OPENED,
+             TranslatableString("action", "Save layout profile…")
+             ),
     UiAction("edit-strings",
              mu::context::UiCtxNotationOpened,
              mu::context::CTX_NOTATION_OPENED
@@ -99,6 +99,10 @@ void NotationUndoStack::prepareChanges()
         return;
     }
 
+    //! NOTE Edits work on ranges of measures and expect them to be laid out,
+    //! so a progressive layout is completed first
+    score()->ensureLayoutComplete();
+
     score()->startCmd();
 }
 
@@ -22,10 +22,13 @@
 
 #include "positionswriter.h"
 
+#include <algorithm>
 #include <cmath>
+#include <random>
 #include <QBuffer>
 
 #include "engraving/dom/masterscore.h"
+#include "engraving/dom/page.h"
 #include "engraving/dom/repeatlist.h"
 #include "engraving/dom/system.h"
 
@@ -47,6 +50,59 @@ constexpr std::string_view ELEMENT_TAG("element");
 constexpr std::string_view EVENTS_TAG("events");
 constexpr std::string_view EVENT_TAG("event");
 
+//! NOTE Binary positions format, all integers are LEB128 varints unless noted:
+//!
+//! "MSPS", u8 version, u8 element type (0 - segments, 1 - measures), session id,
+//! current layout revision, since revision, score count, then for each score:
+//!     name length, name (utf-8), system count, then for each system:
+//!         layout revision, element count, u8 has records;
+//!         if the system was laid out after "since revision" (has records):
+//!             page index, then for each element:
+//!                 zigzag dx, zigzag dy (from the previous element of the system, the first from 0,0), sx, sy
+//!     event count, then for each event: zigzag element id delta, zigzag time delta
+//!
+//! Coordinates are in 1/100 of a pixel at the export png resolution.
+//! Element ids are implicit: consecutive over the systems of a score, starting at 0.
+//! Systems without records keep the positions the reader got earlier for the system with the same
+//! layout revision. Revisions are unique per system layout, unlike system indices, which shift when
+//! an edit adds or absorbs a system.
+//!
+//! Layout revisions come from a counter of the running process, so they are only comparable within
+//! one session id. A reader that gets another session id than before (e.g. the backend restarted)
+//! must drop the positions it keeps and ask again with since revision 0.
+constexpr std::string_view BINARY_MAGIC("MSPS");
+constexpr uint8_t BINARY_VERSION = 2;
+constexpr double BINARY_UNITS_PER_PIXEL = 100.0;
+
+static void appendVarint(ByteArray& data, uint64_t value)
+{
+    while (value >= 0x80) {
+        data.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    data.push_back(static_cast<uint8_t>(value));
+}
+
+static void appendZigzag(ByteArray& data, int64_t value)
+{
+    appendVarint(data, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+static uint64_t sessionId()
+{
+    static const uint64_t id = []() {
+        std::random_device device;
+        return (static_cast<uint64_t>(device()) << 32) | device();
+    }();
+
+    return id;
+}
+
+static int64_t toBinaryUnits(double value)
+{
+    return std::llround(value * BINARY_UNITS_PER_PIXEL);
+}
+
 static void writeElementPosition(deprecated::XmlWriter& writer, const std::string& id, const muse::PointF& pos, const muse::PointF& sPos,
                                  page_idx_t pageIndex)
 {
@@ -68,18 +124,6 @@ static void writeEventPosition(deprecated::XmlWriter& writer, const std::string&
     writer.writeEndElement();
 }
 
-static void writeMeasureEvents(deprecated::XmlWriter& writer, Measure* m, int offset, const QHash<void*, int>& segments)
-{
-    for (mu::engraving::Segment* s = m->first(mu::engraving::SegmentType::ChordRest); s;
-         s = s->next(mu::engraving::SegmentType::ChordRest)) {
-        int tick = s->tick().ticks() + offset;
-        int id = segments[(void*)s];
-        int time = lrint(m->score()->repeatList().utick2utime(tick) * 1000);
-
-        writeEventPosition(writer, std::to_string(id), time);
-    }
-}
-
 PositionsWriter::PositionsWriter(PositionsWriter::ElementType elementType)
     : m_elementType(elementType)
 {
@@ -96,7 +140,7 @@ bool PositionsWriter::supportsUnitType(UnitType unitType) const
     return std::find(unitTypes.cbegin(), unitTypes.cend(), unitType) != unitTypes.cend();
 }
 
-Ret PositionsWriter::write(INotationPtr notation, io::IODevice& destinationDevice, const Options&)
+Ret PositionsWriter::write(INotationPtr notation, io::IODevice& destinationDevice, const Options& options)
 {
     IF_ASSERT_FAILED(notation) {
         return make_ret(Ret::Code::UnknownError);
@@ -108,6 +152,11 @@ Ret PositionsWriter::write(INotationPtr notation, io::IODevice& destinationDevic
         return make_ret(Ret::Code::UnknownError);
     }
 
+    if (muse::value(options, OptionKey::BINARY_OUTPUT, Val(false)).toBool()) {
+        uint64_t sinceRevision = muse::value(options, OptionKey::SINCE_LAYOUT_REVISION, Val(int64_t(0))).toInt64();
+        return writeBinary({ score }, destinationDevice, sinceRevision);
+    }
+
     QByteArray qdata;
     QBuffer buf(&qdata);
     buf.open(QIODevice::WriteOnly);
@@ -117,8 +166,8 @@ Ret PositionsWriter::write(INotationPtr notation, io::IODevice& destinationDevic
     writer.writeStartDocument();
     writer.writeStartElement(SCORE_TAG);
 
-    writeElementsPositions(writer, score);
-    writeEventsPositions(writer, score);
+    writeElementsPositions(writer, elementsPositions(score));
+    writeEventsPositions(writer, eventsPositions(score));
 
     writer.writeEndElement();
     writer.writeEndDocument();
@@ -129,10 +178,32 @@ Ret PositionsWriter::write(INotationPtr notation, io::IODevice& destinationDevic
     return true;
 }
 
-Ret PositionsWriter::writeList(const INotationPtrList&, io::IODevice&, const Options&)
+Ret PositionsWriter::writeList(const INotationPtrList& notations, io::IODevice& destinationDevice, const Options& options)
 {
-    NOT_SUPPORTED;
-    return Ret(Ret::Code::NotSupported);
+    //! NOTE Only the binary format can hold several scores
+    if (!muse::value(options, OptionKey::BINARY_OUTPUT, Val(false)).toBool()) {
+        NOT_SUPPORTED;
+        return Ret(Ret::Code::NotSupported);
+    }
+
+    IF_ASSERT_FAILED(!notations.empty()) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    std::vector<const mu::engraving::Score*> scores;
+    scores.reserve(notations.size());
+
+    for (const INotationPtr& notation : notations) {
+        const mu::engraving::Score* score = notation ? notation->elements()->msScore() : nullptr;
+        IF_ASSERT_FAILED(score) {
+            return make_ret(Ret::Code::UnknownError);
+        }
+
+        scores.push_back(score);
+    }
+
+    uint64_t sinceRevision = muse::value(options, OptionKey::SINCE_LAYOUT_REVISION, Val(int64_t(0))).toInt64();
+    return writeBinary(scores, destinationDevice, sinceRevision);
 }
 
 qreal PositionsWriter::pngDpiResolution() const
@@ -160,25 +231,21 @@ QHash<void*, int> PositionsWriter::elementIds(const mu::engraving::Score* score)
     return elementIds;
 }
 
-void PositionsWriter::writeElementsPositions(deprecated::XmlWriter& writer, const mu::engraving::Score* score) const
+std::vector<PositionsWriter::ElementPosition> PositionsWriter::elementsPositions(const mu::engraving::Score* score) const
 {
-    writer.writeStartElement(ELEMENTS_TAG);
-
     switch (m_elementType) {
     case ElementType::SEGMENT:
-        writeSegmentsPositions(writer, score);
-        break;
+        return segmentsPositions(score);
     case ElementType::MEASURE:
-        writeMeasuresPositions(writer, score);
-        break;
+        return measuresPositions(score);
     }
 
-    writer.writeEndElement();
+    return {};
 }
 
-void PositionsWriter::writeSegmentsPositions(deprecated::XmlWriter& writer, const mu::engraving::Score* score) const
+std::vector<PositionsWriter::ElementPosition> PositionsWriter::segmentsPositions(const mu::engraving::Score* score) const
 {
-    int id = 0;
+    std::vector<ElementPosition> positions;
     qreal ndpi = pngDpiResolution();
 
     Measure* measure = score->firstMeasureMM();
@@ -193,62 +260,66 @@ void PositionsWriter::writeSegmentsPositions(deprecated::XmlWriter& writer, cons
             }
         }
 
+        const System* system = segment->measure()->system();
+
         sx *= ndpi;
-        qreal sy = segment->measure()->system()->height() * ndpi;
+        qreal sy = system->height() * ndpi;
 
         int x = segment->pagePos().x() * ndpi;
         int y = segment->pagePos().y() * ndpi;
 
-        Page* page = segment->measure()->system()->page();
-        page_idx_t pageIndex = score->pageIdx(page);
-
-        writeElementPosition(writer, std::to_string(id), PointF(x, y), PointF(sx, sy), pageIndex);
-
-        id++;
+        positions.push_back({ PointF(x, y), PointF(sx, sy), score->pageIdx(system->page()), system });
     }
+
+    return positions;
 }
 
-void PositionsWriter::writeMeasuresPositions(deprecated::XmlWriter& writer, const mu::engraving::Score* score) const
+std::vector<PositionsWriter::ElementPosition> PositionsWriter::measuresPositions(const mu::engraving::Score* score) const
 {
-    int id = 0;
+    std::vector<ElementPosition> positions;
     qreal ndpi = pngDpiResolution();
 
     for (Measure* measure = score->firstMeasureMM(); measure; measure = measure->nextMeasureMM()) {
+        const System* system = measure->system();
+
         qreal sx = measure->ldata()->bbox().width() * ndpi;
-        qreal sy = measure->system()->height() * ndpi;
+        qreal sy = system->height() * ndpi;
         qreal x = measure->pagePos().x() * ndpi;
-        qreal y = measure->system()->pagePos().y() * ndpi;
+        qreal y = system->pagePos().y() * ndpi;
 
-        Page* page = measure->system()->page();
-        page_idx_t pageIndex = score->pageIdx(page);
-
-        writeElementPosition(writer, std::to_string(id), PointF(x, y), PointF(sx, sy), pageIndex);
-
-        id++;
+        positions.push_back({ PointF(x, y), PointF(sx, sy), score->pageIdx(system->page()), system });
     }
+
+    return positions;
 }
 
-void PositionsWriter::writeEventsPositions(deprecated::XmlWriter& writer, const mu::engraving::Score* score) const
+std::vector<PositionsWriter::EventPosition> PositionsWriter::eventsPositions(const mu::engraving::Score* score) const
 {
+    std::vector<EventPosition> events;
     QHash<void*, int> elementIds = this->elementIds(score);
 
-    writer.writeStartElement(EVENTS_TAG);
-
     score->masterScore()->setExpandRepeats(true);
 
-    for (const mu::engraving::RepeatSegment* repeatSegment : score->repeatList()) {
+    const RepeatList& repeatList = score->repeatList();
+
+    for (const mu::engraving::RepeatSegment* repeatSegment : repeatList) {
         int startTick = repeatSegment->tick;
         int endTick = startTick + repeatSegment->len();
         int tickOffset = repeatSegment->utick - repeatSegment->tick;
         for (Measure* measure = score->tick2measureMM(Fraction::fromTicks(startTick)); measure; measure = measure->nextMeasureMM()) {
             if (m_elementType == ElementType::SEGMENT) {
-                writeMeasureEvents(writer, measure, tickOffset, elementIds);
+                for (mu::engraving::Segment* s = measure->first(mu::engraving::SegmentType::ChordRest); s;
+                     s = s->next(mu::engraving::SegmentType::ChordRest)) {
+                    int tick = s->tick().ticks() + tickOffset;
+                    int time = std::lrint(repeatList.utick2utime(tick) * 1000);
+
+                    events.push_back({ elementIds[(void*)s], time });
+                }
             } else {
                 int tick = measure->tick().ticks() + tickOffset;
-                int id = elementIds[(void*)measure];
-                int time = std::lrint(measure->score()->repeatList().utick2utime(tick) * 1000);
+                int time = std::lrint(repeatList.utick2utime(tick) * 1000);
 
-                writeEventPosition(writer, std::to_string(id), time);
+                events.push_back({ elementIds[(void*)measure], time });
             }
 
             if (measure->endTick().ticks() >= endTick) {
@@ -257,5 +328,124 @@ void PositionsWriter::writeEventsPositions(deprecated::XmlWriter& writer, const
         }
     }
 
+    return events;
+}
+
+void PositionsWriter::writeElementsPositions(deprecated::XmlWriter& writer, const std::vector<ElementPosition>& elements) const
+{
+    writer.writeStartElement(ELEMENTS_TAG);
+
+    for (size_t id = 0; id < elements.size(); ++id) {
+        const ElementPosition& element = elements[id];
+        writeElementPosition(writer, std::to_string(id), element.pos, element.sPos, element.pageIndex);
+    }
+
+    writer.writeEndElement();
+}
+
+void PositionsWriter::writeEventsPositions(deprecated::XmlWriter& writer, const std::vector<EventPosition>& events) const
+{
+    writer.writeStartElement(EVENTS_TAG);
+
+    for (const EventPosition& event : events) {
+        writeEventPosition(writer, std::to_string(event.elementId), event.time);
+    }
+
     writer.writeEndElement();
 }
+
+Ret PositionsWriter::writeBinary(const std::vector<const mu::engraving::Score*>& scores, io::IODevice& destinationDevice,
+                                 uint64_t sinceRevision) const
+{
+    const uint64_t lastRevision = System::lastLayoutRevision();
+
+    //! NOTE A revision this process has not reached yet comes from another session, write everything
+    if (sinceRevision > lastRevision) {
+        sinceRevision = 0;
+    }
+
+    ByteArray data;
+    data.reserve(64 * 1024);
+
+    data.push_back(reinterpret_cast<const uint8_t*>(BINARY_MAGIC.data()), BINARY_MAGIC.size());
+    data.push_back(BINARY_VERSION);
+    data.push_back(static_cast<uint8_t>(m_elementType));
+    appendVarint(data, sessionId());
+    appendVarint(data, lastRevision);
+    appendVarint(data, sinceRevision);
+    appendVarint(data, scores.size());
+
+    for (const mu::engraving::Score* score : scores) {
+        writeBinaryScore(data, score, sinceRevision);
+    }
+
+    if (destinationDevice.write(data) != data.size()) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    return true;
+}
+
+void PositionsWriter::writeBinaryScore(ByteArray& data, const mu::engraving::Score* score, uint64_t sinceRevision) const
+{
+    ByteArray name = score->name().toUtf8();
+    appendVarint(data, name.size());
+    data.push_back(name);
+
+    const std::vector<ElementPosition> elements = elementsPositions(score);
+
+    //! NOTE Elements come in score order, so the elements of a system are consecutive
+    std::vector<std::pair<size_t, size_t> > systemRanges;
+    for (size_t i = 0; i < elements.size(); ++i) {
+        if (systemRanges.empty() || elements[i].system != elements[systemRanges.back().first].system) {
+            systemRanges.push_back({ i, i });
+        }
+        systemRanges.back().second = i + 1;
+    }
+
+    appendVarint(data, systemRanges.size());
+
+    for (const auto& [begin, end] : systemRanges) {
+        const System* system = elements[begin].system;
+        bool hasRecords = system->layoutRevision() > sinceRevision;
+
+        appendVarint(data, system->layoutRevision());
+        appendVarint(data, end - begin);
+        data.push_back(hasRecords ? 1 : 0);
+
+        if (!hasRecords) {
+            continue;
+        }
+
+        appendVarint(data, elements[begin].pageIndex);
+
+        int64_t prevX = 0;
+        int64_t prevY = 0;
+        for (size_t i = begin; i < end; ++i) {
+            const ElementPosition& element = elements[i];
+            int64_t x = toBinaryUnits(element.pos.x());
+            int64_t y = toBinaryUnits(element.pos.y());
+
+            appendZigzag(data, x - prevX);
+            appendZigzag(data, y - prevY);
+            appendVarint(data, std::max<int64_t>(toBinaryUnits(element.sPos.x()), 0));
+            appendVarint(data, std::max<int64_t>(toBinaryUnits(element.sPos.y()), 0));
+
+            prevX = x;
+            prevY = y;
+        }
+    }
+
+    const std::vector<EventPosition> events = eventsPositions(score);
+    appendVarint(data, events.size());
+
+    int64_t prevId = 0;
+    int64_t prevTime = 0;
+    for (const EventPosition& event : events) {
+        appendZigzag(data, event.elementId - prevId);
+        appendZigzag(data, event.time - prevTime);
+
+        prevId = event.elementId;
+        prevTime = event.time;
+    }
+}
@@ -23,7 +23,11 @@
 #ifndef MU_NOTATION_POSITIONSWRITER_H
 #define MU_NOTATION_POSITIONSWRITER_H
 
+#include <vector>
+
 #include "modularity/ioc.h"
+#include "draw/types/geometry.h"
+#include "engraving/types/types.h"
 #include "importexport/imagesexport/iimagesexportconfiguration.h"
 #include "project/inotationwriter.h"
 
@@ -33,6 +37,7 @@ class XmlWriter;
 
 namespace mu::engraving {
 class Score;
+class System;
 }
 
 namespace mu::notation {
@@ -56,14 +61,35 @@ public:
     muse::Ret writeList(const INotationPtrList& notations, muse::io::IODevice& device, const Options& options = Options()) override;
 
 private:
+    friend class PositionsWriterTests;
+
+    struct ElementPosition {
+        muse::PointF pos;
+        muse::PointF sPos;
+        engraving::page_idx_t pageIndex = 0;
+        const engraving::System* system = nullptr;
+    };
+
+    struct EventPosition {
+        int elementId = 0;
+        int time = 0;
+    };
+
     qreal pngDpiResolution() const;
     QHash<void*, int> elementIds(const mu::engraving::Score* score) const;
 
-    void writeElementsPositions(muse::deprecated::XmlWriter& writer, const mu::engraving::Score* score) const;
-    void writeSegmentsPositions(muse::deprecated::XmlWriter& writer, const mu::engraving::Score* score) const;
-    void writeMeasuresPositions(muse::deprecated::XmlWriter& writer, const mu::engraving::Score* score) const;
+    // element ids are the indices in the returned list
+    std::vector<ElementPosition> elementsPositions(const mu::engraving::Score* score) const;
+    std::vector<ElementPosition> segmentsPositions(const mu::engraving::Score* score) const;
+    std::vector<ElementPosition> measuresPositions(const mu::engraving::Score* score) const;
+    std::vector<EventPosition> eventsPositions(const mu::engraving::Score* score) const;
+
+    void writeElementsPositions(muse::deprecated::XmlWriter& writer, const std::vector<ElementPosition>& elements) const;
+    void writeEventsPositions(muse::deprecated::XmlWriter& writer, const std::vector<EventPosition>& events) const;
 
-    void writeEventsPositions(muse::deprecated::XmlWriter& writer, const mu::engraving::Score* score) const;
+    muse::Ret writeBinary(const std::vector<const mu::engraving::Score*>& scores, muse::io::IODevice& device,
+                          uint64_t sinceRevision) const;
+    void writeBinaryScore(muse::ByteArray& data, const mu::engraving::Score* score, uint64_t sinceRevision) const;
 
     ElementType m_elementType = ElementType::SEGMENT;
 };
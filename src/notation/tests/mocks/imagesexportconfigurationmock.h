@@ -0,0 +1,51 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_NOTATION_IMAGESEXPORTCONFIGURATIONMOCK_H
+#define MU_NOTATION_IMAGESEXPORTCONFIGURATIONMOCK_H
+
+#include <gmock/gmock.h>
+
+#include "importexport/imagesexport/iimagesexportconfiguration.h"
+
+namespace mu::notation {
+class ImagesExportConfigurationMock : public iex::imagesexport::IImagesExportConfiguration
+{
+public:
+    MOCK_METHOD(int, exportPdfDpiResolution, (), (const, override));
+    MOCK_METHOD(void, setExportPdfDpiResolution, (int), (override));
+
+    MOCK_METHOD(float, exportPngDpiResolution, (), (const, override));
+    MOCK_METHOD(void, setExportPngDpiResolution, (float), (override));
+    MOCK_METHOD(void, setExportPngDpiResolutionOverride, (std::optional<float>), (override));
+
+    MOCK_METHOD(bool, exportPngWithTransparentBackground, (), (const, override));
+    MOCK_METHOD(void, setExportPngWithTransparentBackground, (bool), (override));
+
+    MOCK_METHOD(bool, exportSvgWithTransparentBackground, (), (const, override));
+    MOCK_METHOD(void, setExportSvgWithTransparentBackground, (bool), (override));
+
+    MOCK_METHOD(int, trimMarginPixelSize, (), (const, override));
+    MOCK_METHOD(void, setTrimMarginPixelSize, (std::optional<int>), (override));
+};
+}
+
+#endif // MU_NOTATION_IMAGESEXPORTCONFIGURATIONMOCK_H
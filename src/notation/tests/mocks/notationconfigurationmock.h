@@ -136,6 +136,15 @@ public:
     MOCK_METHOD(void, setIsLimitCanvasScrollArea, (bool), (override));
     MOCK_METHOD(muse::async::Notification, isLimitCanvasScrollAreaChanged, (), (const, override));
 
+    MOCK_METHOD(bool, isTiledRenderingEnabled, (), (const, override));
+    MOCK_METHOD(void, setIsTiledRenderingEnabled, (bool), (override));
+    MOCK_METHOD(muse::async::Notification, isTiledRenderingEnabledChanged, (), (const, override));
+
+    MOCK_METHOD(double, simplifiedPaintingSpatiumSize, (), (const, override));
+    MOCK_METHOD(void, setSimplifiedPaintingSpatiumSize, (double), (override));
+    MOCK_METHOD(double, staffLinesOnlyPaintingSpatiumSize, (), (const, override));
+    MOCK_METHOD(void, setStaffLinesOnlyPaintingSpatiumSize, (double), (override));
+
     MOCK_METHOD(bool, colorNotesOutsideOfUsablePitchRange, (), (const, override));
     MOCK_METHOD(void, setColorNotesOutsideOfUsablePitchRange, (bool), (override));
 
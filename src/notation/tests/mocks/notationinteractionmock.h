@@ -77,6 +77,7 @@ public:
     MOCK_METHOD(void, setDropTarget, (const EngravingItem*, bool), (override));
     MOCK_METHOD(void, setDropRect, (const muse::RectF&), (override));
     MOCK_METHOD(void, endDrop, (), (override));
+    MOCK_METHOD(bool, isDropStarted, (), (const, override));
     MOCK_METHOD(muse::async::Notification, dropChanged, (), (const, override));
 
     MOCK_METHOD(bool, applyPaletteElement, (mu::engraving::EngravingItem*, Qt::KeyboardModifiers), (override));
@@ -0,0 +1,291 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cmath>
+
+#include "mocks/imagesexportconfigurationmock.h"
+
+#include "engraving/tests/utils/scorerw.h"
+#include "engraving/dom/masterscore.h"
+#include "engraving/dom/system.h"
+
+#include "global/io/buffer.h"
+
+#include "notation/internal/positionswriter.h"
+
+using ::testing::Return;
+
+using namespace mu;
+using namespace mu::notation;
+using namespace mu::engraving;
+using namespace muse;
+
+static const String TEST_SCORE_PATH(u"data/test.mscx");
+
+namespace {
+//! NOTE Reads back the binary format described in positionswriter.cpp
+class BinaryPositionsReader
+{
+public:
+    explicit BinaryPositionsReader(const ByteArray& data)
+        : m_data(data) {}
+
+    bool atEnd() const { return m_pos >= m_data.size(); }
+
+    uint8_t byte()
+    {
+        EXPECT_LT(m_pos, m_data.size());
+        return m_pos < m_data.size() ? m_data.at(m_pos++) : 0;
+    }
+
+    uint64_t varint()
+    {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t b = byte();
+            value |= static_cast<uint64_t>(b & 0x7f) << shift;
+            if (!(b & 0x80)) {
+                break;
+            }
+        }
+        return value;
+    }
+
+    int64_t zigzag()
+    {
+        uint64_t value = varint();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    std::string string(size_t size)
+    {
+        std::string str;
+        for (size_t i = 0; i < size; ++i) {
+            str.push_back(static_cast<char>(byte()));
+        }
+        return str;
+    }
+
+private:
+    const ByteArray& m_data;
+    size_t m_pos = 0;
+};
+
+struct DecodedSystem {
+    uint64_t layoutRevision = 0;
+    size_t elementCount = 0;
+    bool hasRecords = false;
+    size_t pageIndex = 0;
+    std::vector<std::pair<int64_t, int64_t> > positions;
+};
+
+struct DecodedPositions {
+    std::string magic;
+    uint8_t version = 0;
+    uint8_t elementType = 0;
+    uint64_t sessionId = 0;
+    uint64_t lastRevision = 0;
+    uint64_t sinceRevision = 0;
+    std::vector<DecodedSystem> systems;
+    size_t eventCount = 0;
+};
+
+DecodedPositions decode(const ByteArray& data)
+{
+    BinaryPositionsReader reader(data);
+    DecodedPositions result;
+
+    result.magic = reader.string(4);
+    result.version = reader.byte();
+    result.elementType = reader.byte();
+    result.sessionId = reader.varint();
+    result.lastRevision = reader.varint();
+    result.sinceRevision = reader.varint();
+
+    EXPECT_EQ(reader.varint(), 1u);
+
+    size_t nameSize = reader.varint();
+    reader.string(nameSize);
+
+    size_t systemCount = reader.varint();
+    for (size_t i = 0; i < systemCount; ++i) {
+        DecodedSystem system;
+        system.layoutRevision = reader.varint();
+        system.elementCount = reader.varint();
+        system.hasRecords = reader.byte() != 0;
+
+        if (system.hasRecords) {
+            system.pageIndex = reader.varint();
+
+            int64_t x = 0;
+            int64_t y = 0;
+            for (size_t e = 0; e < system.elementCount; ++e) {
+                x += reader.zigzag();
+                y += reader.zigzag();
+                reader.varint();
+                reader.varint();
+                system.positions.push_back({ x, y });
+            }
+        }
+
+        result.systems.push_back(std::move(system));
+    }
+
+    result.eventCount = reader.varint();
+    for (size_t i = 0; i < result.eventCount; ++i) {
+        reader.zigzag();
+        reader.zigzag();
+    }
+
+    EXPECT_TRUE(reader.atEnd());
+
+    return result;
+}
+}
+
+namespace mu::notation {
+class PositionsWriterTests : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        m_configuration = std::make_shared<ImagesExportConfigurationMock>();
+        ON_CALL(*m_configuration, exportPngDpiResolution())
+        .WillByDefault(Return(300.0f));
+
+        m_writer.imagesExportConfiguration.set(m_configuration);
+
+        m_score = ScoreRW::readScore(TEST_SCORE_PATH);
+        ASSERT_TRUE(m_score);
+    }
+
+    void TearDown() override
+    {
+        delete m_score;
+    }
+
+protected:
+    ByteArray writeBinary(uint64_t sinceRevision) const
+    {
+        ByteArray data;
+        io::Buffer buffer(&data);
+        buffer.open(io::IODevice::WriteOnly);
+
+        EXPECT_TRUE(m_writer.writeBinary({ m_score }, buffer, sinceRevision));
+
+        return data;
+    }
+
+    std::vector<std::pair<int64_t, int64_t> > expectedPositions() const
+    {
+        std::vector<std::pair<int64_t, int64_t> > positions;
+        for (const PositionsWriter::ElementPosition& element : m_writer.elementsPositions(m_score)) {
+            positions.push_back({ std::llround(element.pos.x() * 100.0), std::llround(element.pos.y() * 100.0) });
+        }
+        return positions;
+    }
+
+    std::shared_ptr<ImagesExportConfigurationMock> m_configuration;
+    PositionsWriter m_writer;
+    MasterScore* m_score = nullptr;
+};
+}
+
+TEST_F(PositionsWriterTests, WriteBinary_AllSystems)
+{
+    // [GIVEN] A laid out score
+
+    // [WHEN] Write the positions of all systems
+    DecodedPositions positions = decode(writeBinary(0));
+
+    // [THEN] The header is valid
+    EXPECT_EQ(positions.magic, "MSPS");
+    EXPECT_EQ(positions.version, 2);
+    EXPECT_EQ(positions.elementType, 0);
+    EXPECT_EQ(positions.lastRevision, System::lastLayoutRevision());
+    EXPECT_EQ(positions.sinceRevision, 0u);
+
+    // [THEN] The systems come in score order, keyed by their layout revision
+    ASSERT_EQ(positions.systems.size(), m_score->systems().size());
+    for (size_t i = 0; i < positions.systems.size(); ++i) {
+        EXPECT_EQ(positions.systems.at(i).layoutRevision, m_score->systems().at(i)->layoutRevision());
+        EXPECT_TRUE(positions.systems.at(i).hasRecords);
+    }
+
+    // [THEN] The deltas add up to the positions of the elements
+    std::vector<std::pair<int64_t, int64_t> > decoded;
+    for (const DecodedSystem& system : positions.systems) {
+        EXPECT_EQ(system.positions.size(), system.elementCount);
+        decoded.insert(decoded.end(), system.positions.begin(), system.positions.end());
+    }
+
+    EXPECT_EQ(decoded, expectedPositions());
+}
+
+TEST_F(PositionsWriterTests, WriteBinary_SkipsSystemsNotLaidOutSince)
+{
+    // [GIVEN] The revision of the last output
+    uint64_t lastRevision = System::lastLayoutRevision();
+
+    // [WHEN] Write again without a relayout
+    DecodedPositions unchanged = decode(writeBinary(lastRevision));
+
+    // [THEN] No system has records, but the element counts are kept
+    ASSERT_FALSE(unchanged.systems.empty());
+    for (const DecodedSystem& system : unchanged.systems) {
+        EXPECT_FALSE(system.hasRecords);
+        EXPECT_GT(system.elementCount, 0u);
+        EXPECT_TRUE(system.positions.empty());
+    }
+
+    // [WHEN] Relayout the score and write again
+    m_score->doLayout();
+    DecodedPositions relaidOut = decode(writeBinary(lastRevision));
+
+    // [THEN] Every system has a new revision and records
+    for (const DecodedSystem& system : relaidOut.systems) {
+        EXPECT_GT(system.layoutRevision, lastRevision);
+        EXPECT_TRUE(system.hasRecords);
+    }
+}
+
+TEST_F(PositionsWriterTests, WriteBinary_SinceRevisionFromAnotherSession)
+{
+    // [GIVEN] A revision this process has not reached, e.g. from a backend run before a restart
+    uint64_t futureRevision = System::lastLayoutRevision() + 1000;
+
+    // [WHEN] Write since that revision
+    DecodedPositions first = decode(writeBinary(futureRevision));
+    DecodedPositions second = decode(writeBinary(0));
+
+    // [THEN] Everything is written, as if since revision was 0
+    EXPECT_EQ(first.sinceRevision, 0u);
+    for (const DecodedSystem& system : first.systems) {
+        EXPECT_TRUE(system.hasRecords);
+    }
+
+    // [THEN] The session id identifies this process
+    EXPECT_EQ(first.sessionId, second.sessionId);
+}
@@ -21,10 +21,14 @@
  */
 #include "abstractnotationpaintview.h"
 
+#include <chrono>
+
 #include <QPainter>
 
 #include "actions/actiontypes.h"
 
+#include "engraving/dom/score.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -227,6 +231,8 @@ void AbstractNotationPaintView::onCurrentNotationChanged()
 
 void AbstractNotationPaintView::onLoadNotation(INotationPtr)
 {
+    m_notation->ensureLaidOut();
+
     if (viewport().isValid() && !m_notation->viewState()->isMatrixInited()) {
         m_inputController->initZoom();
     }
@@ -237,11 +243,14 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
         m_notation->painting()->setViewMode(m_notation->viewState()->viewMode());
     }
 
+    updateVisibleRect();
+
     INotationInteractionPtr interaction = notationInteraction();
 
     m_notation->notationChanged().onNotify(this, [this, interaction]() {
         interaction->hideShadowNote();
         m_shadowNoteRect = RectF();
+        m_tileCache.invalidateIfLayoutUnchanged();
         scheduleRedraw();
     });
 
@@ -250,8 +259,9 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
         onNoteInputStateChanged();
     });
 
+    m_lastSelectionRect = interaction->selection()->canvasBoundingRect();
     interaction->selectionChanged().onNotify(this, [this]() {
-        scheduleRedraw();
+        onSelectionChanged();
     });
 
     interaction->showItemRequested().onReceive(this, [this](const INotationInteraction::ShowItemRequest& request) {
@@ -282,8 +292,10 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     });
 
     m_notation->viewModeChanged().onNotify(this, [this]() {
+        m_tileCache.clear();
         updateLoopMarkers();
         ensureViewportInsideScrollableArea();
+        updateVisibleRect();
     });
 
     if (isMainView()) {
@@ -324,6 +336,9 @@ void AbstractNotationPaintView::onUnloadNotation(INotationPtr)
     interaction->noteInput()->stateChanged().resetOnNotify(this);
     interaction->selectionChanged().resetOnNotify(this);
 
+    m_tileCache.clear();
+    m_lastSelectionRect = RectF();
+
     if (isMainView()) {
         m_notation->accessibility()->setMapToScreenFunc(nullptr);
         m_notation->interaction()->setGetViewRectFunc(nullptr);
@@ -359,6 +374,7 @@ void AbstractNotationPaintView::onMatrixChanged(const Transform& oldMatrix, cons
         m_shadowNoteRect = newMatrix.map(logicRect);
     }
 
+    updateVisibleRect();
     scheduleRedraw();
 
     emit horizontalScrollChanged();
@@ -384,6 +400,7 @@ void AbstractNotationPaintView::onViewSizeChanged()
 
     ensureViewportInsideScrollableArea();
 
+    updateVisibleRect();
     scheduleRedraw();
 
     emit horizontalScrollChanged();
@@ -571,6 +588,8 @@ void AbstractNotationPaintView::paint(QPainter* qp)
 {
     TRACEFUNC;
 
+    const auto paintStart = std::chrono::steady_clock::now();
+
     RectF rect = RectF::fromQRectF(qp->clipBoundingRect());
     rect = correctDrawRect(rect);
 
@@ -590,7 +609,27 @@ void AbstractNotationPaintView::paint(QPainter* qp)
     painter->setWorldTransform(m_matrix * guiScalingCompensation);
 
     bool isPrinting = publishMode() || m_inputController->readonly();
-    notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+
+    std::string frameName = "Notation view";
+    std::string frameDetails;
+
+    if (isTiledRenderingActive()) {
+        NotationTileCache::PaintResult result = paintTiles(qp, rect, isPrinting);
+        if (!isPrinting) {
+            notation()->painting()->paintInteraction(painter);
+        }
+
+        //! NOTE Rasterise the rest of the visible tiles on the next frame
+        if (result.pendingTiles > 0) {
+            scheduleRedraw();
+        }
+
+        frameName = "Notation view (tiled)";
+        frameDetails = "visible tiles: " + std::to_string(result.visibleTiles) + ", painted tiles: " + std::to_string(result.paintedTiles)
+                       + ", pending tiles: " + std::to_string(result.pendingTiles);
+    } else {
+        notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+    }
 
     m_playbackCursor->paint(painter);
     m_noteInputCursor->paint(painter);
@@ -605,6 +644,58 @@ void AbstractNotationPaintView::paint(QPainter* qp)
         ctx.fromLogical = [this](const PointF& pos) -> PointF { return fromLogical(pos); };
         m_continuousPanel->paint(*painter, ctx);
     }
+
+    if (frameTimesRegister()) {
+        const std::chrono::duration<double, std::milli> paintTime = std::chrono::steady_clock::now() - paintStart;
+        frameTimesRegister()->addFrame(frameName, paintTime.count(), frameDetails);
+    }
+}
+
+bool AbstractNotationPaintView::isTiledRenderingActive() const
+{
+    if (!configuration()->isTiledRenderingEnabled()) {
+        return false;
+    }
+
+    //! NOTE The debug painting is not cached
+    if (engravingConfiguration()->debuggingOptions().anyEnabled()) {
+        return false;
+    }
+
+    //! NOTE While editing, the score is changed (and repainted) on every step anyway.
+    //! While dropping, the drop target is highlighted without a relayout
+    INotationInteractionPtr interaction = notationInteraction();
+    return !interaction->isDragStarted()
+           && !interaction->isDropStarted()
+           && !interaction->isTextEditingStarted()
+           && !interaction->isElementEditStarted()
+           && !interaction->isGripEditStarted();
+}
+
+NotationTileCache::PaintResult AbstractNotationPaintView::paintTiles(QPainter* painter, const RectF& rect, bool isPrinting)
+{
+    TRACEFUNC;
+
+    engraving::Score* score = notation()->elements()->msScore();
+    if (!score) {
+        return NotationTileCache::PaintResult();
+    }
+
+    const double pixelScale = currentScaling() * configuration()->guiScaling() * painter->device()->devicePixelRatioF();
+
+    return m_tileCache.paint(painter, notation()->painting(), score->pages(), toLogical(rect), pixelScale, isPrinting);
+}
+
+void AbstractNotationPaintView::onSelectionChanged()
+{
+    //! NOTE Selected elements are painted in the selection color,
+    //! so the tiles of the previous and the new selection are outdated
+    RectF selectionRect = notationSelection()->canvasBoundingRect();
+    m_tileCache.invalidate(m_lastSelectionRect);
+    m_tileCache.invalidate(selectionRect);
+    m_lastSelectionRect = selectionRect;
+
+    scheduleRedraw();
 }
 
 void AbstractNotationPaintView::onNotationSetup()
@@ -626,14 +717,22 @@ void AbstractNotationPaintView::onNotationSetup()
     });
 
     configuration()->foregroundChanged().onNotify(this, [this]() {
+        m_tileCache.clear();
+        scheduleRedraw();
+    });
+
+    configuration()->isTiledRenderingEnabledChanged().onNotify(this, [this]() {
+        m_tileCache.clear();
         scheduleRedraw();
     });
 
     uiConfiguration()->currentThemeChanged().onNotify(this, [this]() {
+        m_tileCache.clear();
         scheduleRedraw();
     });
 
     engravingConfiguration()->debuggingOptionsChanged().onNotify(this, [this]() {
+        m_tileCache.clear();
         scheduleRedraw();
     });
 }
@@ -706,6 +805,14 @@ RectF AbstractNotationPaintView::viewport() const
     return toLogical(RectF(0.0, 0.0, width(), height()));
 }
 
+void AbstractNotationPaintView::updateVisibleRect()
+{
+    //! NOTE Lays out the measures scrolled into view in continuous view before they are painted
+    if (notation() && viewport().isValid()) {
+        notation()->painting()->setVisibleRect(viewport());
+    }
+}
+
 QRectF AbstractNotationPaintView::viewport_property() const
 {
     return viewport().toQRectF();
@@ -1252,6 +1359,7 @@ void AbstractNotationPaintView::setNotation(INotationPtr notation)
 void AbstractNotationPaintView::setReadonly(bool readonly)
 {
     m_inputController->setReadonly(readonly);
+    m_tileCache.clear();
 }
 
 void AbstractNotationPaintView::clear()
@@ -1443,6 +1551,7 @@ void AbstractNotationPaintView::setPublishMode(bool arg)
     }
 
     m_publishMode = arg;
+    m_tileCache.clear();
     emit publishModeChanged();
 }
 
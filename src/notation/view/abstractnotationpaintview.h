@@ -39,6 +39,7 @@
 #include "ui/iuiactionsregister.h"
 #include "uicomponents/view/abstractmenumodel.h"
 #include "uicomponents/view/quickpaintedview.h"
+#include "diagnostics/idiagnosticsframetimesregister.h"
 
 #include "notationviewinputcontroller.h"
 #include "noteinputcursor.h"
@@ -46,6 +47,7 @@
 #include "loopmarker.h"
 #include "continuouspanel.h"
 #include "abstractelementpopupmodel.h"
+#include "notationtilecache.h"
 
 namespace mu::notation {
 class AbstractNotationPaintView : public muse::uicomponents::QuickPaintedView, public IControlledView, public muse::Injectable,
@@ -73,6 +75,7 @@ class AbstractNotationPaintView : public muse::uicomponents::QuickPaintedView, p
     muse::Inject<muse::ui::IUiContextResolver> uiContextResolver = { this };
     muse::Inject<muse::ui::IMainWindow> mainWindow = { this };
     muse::Inject<muse::ui::IUiActionsRegister> actionsRegister = { this };
+    muse::Inject<muse::diagnostics::IDiagnosticsFrameTimesRegister> frameTimesRegister = { this };
 
 public:
     explicit AbstractNotationPaintView(QQuickItem* parent = nullptr);
@@ -204,6 +207,7 @@ private:
 
     void scheduleRedraw(const muse::RectF& rect = muse::RectF());
     muse::RectF correctDrawRect(const muse::RectF& rect) const;
+    void updateVisibleRect();
 
     // Input
     void wheelEvent(QWheelEvent* event) override;
@@ -248,6 +252,10 @@ private:
 
     void paintBackground(const muse::RectF& rect, muse::draw::Painter* painter);
 
+    bool isTiledRenderingActive() const;
+    NotationTileCache::PaintResult paintTiles(QPainter* painter, const muse::RectF& rect, bool isPrinting);
+    void onSelectionChanged();
+
     muse::PointF canvasCenter() const;
     std::pair<qreal, qreal> constraintCanvas(qreal dx, qreal dy) const;
 
@@ -275,6 +283,9 @@ private:
     bool m_isContextMenuOpen = false;
 
     muse::RectF m_shadowNoteRect;
+
+    NotationTileCache m_tileCache;
+    muse::RectF m_lastSelectionRect;
 };
 }
 
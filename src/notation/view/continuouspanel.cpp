@@ -129,7 +129,6 @@ void ContinuousPanel::paint(Painter& painter, const NotationViewContext& ctx)
     const mu::engraving::Measure* currentMeasure = nullptr;
     bool showInvisible = score->isShowInvisible();
     for (const mu::engraving::EngravingItem* e : el) {
-        e->itemDiscovered = false;
         if (!e->visible() && !showInvisible) {
             continue;
         }
@@ -173,7 +172,6 @@ void ContinuousPanel::paint(Painter& painter, const NotationViewContext& ctx)
     qreal xPosTimeSig  = 0;
 
     for (const mu::engraving::EngravingItem* e : std::as_const(el)) {
-        e->itemDiscovered = false;
         if (!e->visible() && !showInvisible) {
             continue;
         }
@@ -0,0 +1,255 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "notationtilecache.h"
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#include <QPainter>
+
+#include "draw/painter.h"
+#include "engraving/dom/page.h"
+
+#include "log.h"
+
+using namespace mu::notation;
+using namespace muse;
+
+//! NOTE ~1 MB per tile (4 MB on HiDPI screens)
+static constexpr size_t MAX_TILE_COUNT = 96;
+
+//! NOTE Rasterising is spread over several frames, so that scrolling and zooming stay smooth
+static constexpr std::chrono::milliseconds TILE_RASTERISE_BUDGET(8);
+
+static int64_t scaleKey(double pixelScale)
+{
+    return std::llround(pixelScale * 10000.0);
+}
+
+static INotationPainting::PageTile pageTile(const Page* page, const RectF& rect, draw::Painter* painter)
+{
+    INotationPainting::PageTile tile;
+    tile.page = const_cast<Page*>(page);
+    tile.rect = rect;
+    tile.painter = painter;
+    return tile;
+}
+
+void NotationTileCache::clear()
+{
+    m_tiles.clear();
+    m_pageRevisions.clear();
+    m_invalidateIfLayoutUnchanged = false;
+}
+
+void NotationTileCache::invalidate(const RectF& rect)
+{
+    if (!rect.isValid()) {
+        return;
+    }
+
+    for (auto it = m_tiles.begin(); it != m_tiles.end();) {
+        if (it->second.canvasRect.intersects(rect)) {
+            it = m_tiles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void NotationTileCache::invalidateIfLayoutUnchanged()
+{
+    m_invalidateIfLayoutUnchanged = true;
+}
+
+bool NotationTileCache::syncPageRevisions(const std::vector<Page*>& pages)
+{
+    bool changed = pages.size() != m_pageRevisions.size();
+
+    std::map<const Page*, uint64_t> revisions;
+    for (const Page* page : pages) {
+        revisions[page] = page->layoutRevision();
+
+        auto it = m_pageRevisions.find(page);
+        if (it == m_pageRevisions.end() || it->second != page->layoutRevision()) {
+            removePageTiles(page);
+            changed = true;
+        }
+    }
+
+    //! NOTE Removed pages
+    for (const auto& pair : m_pageRevisions) {
+        if (revisions.find(pair.first) == revisions.end()) {
+            removePageTiles(pair.first);
+        }
+    }
+
+    m_pageRevisions = std::move(revisions);
+
+    return changed;
+}
+
+void NotationTileCache::removePageTiles(const Page* page)
+{
+    auto it = m_tiles.lower_bound(TileKey { page, std::numeric_limits<int64_t>::min(), std::numeric_limits<int>::min(),
+                                            std::numeric_limits<int>::min() });
+    while (it != m_tiles.end() && it->first.page == page) {
+        it = m_tiles.erase(it);
+    }
+}
+
+void NotationTileCache::removeUnusedTiles()
+{
+    while (m_tiles.size() > MAX_TILE_COUNT) {
+        auto oldest = m_tiles.begin();
+        for (auto it = m_tiles.begin(); it != m_tiles.end(); ++it) {
+            if (it->second.lastUsedFrame < oldest->second.lastUsedFrame) {
+                oldest = it;
+            }
+        }
+
+        //! NOTE Don't remove the tiles of the current frame
+        if (oldest->second.lastUsedFrame == m_frame) {
+            break;
+        }
+
+        m_tiles.erase(oldest);
+    }
+}
+
+NotationTileCache::PaintResult NotationTileCache::paint(QPainter* painter, INotationPaintingPtr painting, const std::vector<Page*>& pages,
+                                                        const RectF& frameRect, double pixelScale, bool isPrinting)
+{
+    TRACEFUNC;
+
+    PaintResult result;
+    if (!painting || pages.empty() || pixelScale <= 0.0) {
+        return result;
+    }
+
+    ++m_frame;
+
+    bool layoutChanged = syncPageRevisions(pages);
+    if (m_invalidateIfLayoutUnchanged && !layoutChanged) {
+        m_tiles.clear();
+    }
+    m_invalidateIfLayoutUnchanged = false;
+
+    const int64_t scale = scaleKey(pixelScale);
+    const double tileSize = TILE_PIXEL_SIZE / pixelScale;
+
+    std::vector<TileKey> visibleKeys;
+    std::vector<TileKey> missingKeys;
+
+    for (const Page* page : pages) {
+        const PointF pagePos = page->pos();
+        const RectF pageRect = page->ldata()->bbox();
+        const RectF visibleRect = frameRect.translated(-pagePos).intersected(pageRect);
+        if (visibleRect.isEmpty()) {
+            continue;
+        }
+
+        const int firstColumn = static_cast<int>(std::floor(visibleRect.left() / tileSize));
+        const int lastColumn = static_cast<int>(std::floor(visibleRect.right() / tileSize));
+        const int firstRow = static_cast<int>(std::floor(visibleRect.top() / tileSize));
+        const int lastRow = static_cast<int>(std::floor(visibleRect.bottom() / tileSize));
+
+        for (int row = firstRow; row <= lastRow; ++row) {
+            for (int column = firstColumn; column <= lastColumn; ++column) {
+                TileKey key { page, scale, column, row };
+                visibleKeys.push_back(key);
+
+                if (m_tiles.find(key) == m_tiles.end()) {
+                    missingKeys.push_back(key);
+                }
+            }
+        }
+    }
+
+    //! NOTE Rasterise the missing tiles until the frame budget is spent (at least one tile per frame),
+    //! the rest is painted directly this time and rasterised on the next frames
+    const auto rasteriseStart = std::chrono::steady_clock::now();
+    std::vector<TileKey> pendingKeys;
+
+    for (const TileKey& key : missingKeys) {
+        if (result.paintedTiles > 0 && std::chrono::steady_clock::now() - rasteriseStart >= TILE_RASTERISE_BUDGET) {
+            pendingKeys.push_back(key);
+            continue;
+        }
+
+        Tile tile;
+        tile.rect = RectF(key.column * tileSize, key.row * tileSize, tileSize, tileSize);
+        tile.canvasRect = tile.rect.translated(key.page->pos());
+        tile.image = QImage(TILE_PIXEL_SIZE, TILE_PIXEL_SIZE, QImage::Format_ARGB32_Premultiplied);
+        tile.image.fill(Qt::transparent);
+
+        {
+            draw::Painter tilePainter(&tile.image, "notationtile");
+            tilePainter.scale(pixelScale, pixelScale);
+            tilePainter.translate(-tile.rect.topLeft());
+
+            painting->paintPageTiles({ pageTile(key.page, tile.rect, &tilePainter) }, isPrinting);
+        }
+
+        m_tiles.emplace(key, std::move(tile));
+        ++result.paintedTiles;
+    }
+
+    painter->save();
+    painter->setRenderHint(QPainter::SmoothPixmapTransform, true);
+
+    for (const TileKey& key : visibleKeys) {
+        auto it = m_tiles.find(key);
+        if (it == m_tiles.end()) {
+            continue;
+        }
+
+        it->second.lastUsedFrame = m_frame;
+        painter->drawImage(it->second.canvasRect.toQRectF(), it->second.image);
+    }
+
+    painter->restore();
+
+    if (!pendingKeys.empty()) {
+        draw::Painter framePainter(painter, "notationtile");
+
+        for (const TileKey& key : pendingKeys) {
+            const PointF pagePos = key.page->pos();
+            const RectF tileRect(key.column * tileSize, key.row * tileSize, tileSize, tileSize);
+
+            framePainter.save();
+            framePainter.translate(pagePos);
+            painting->paintPageTiles({ pageTile(key.page, tileRect.intersected(frameRect.translated(-pagePos)), &framePainter) },
+                                     isPrinting);
+            framePainter.restore();
+        }
+    }
+
+    removeUnusedTiles();
+
+    result.visibleTiles = visibleKeys.size();
+    result.pendingTiles = pendingKeys.size();
+
+    return result;
+}
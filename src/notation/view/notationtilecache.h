@@ -0,0 +1,100 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_NOTATION_NOTATIONTILECACHE_H
+#define MU_NOTATION_NOTATIONTILECACHE_H
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include <QImage>
+
+#include "draw/types/geometry.h"
+
+#include "notation/inotationpainting.h"
+
+class QPainter;
+
+namespace mu::notation {
+//! NOTE Caches the score part of the view as rasterised tiles.
+//! Tiles are laid out on a fixed pixel grid per page and zoom level;
+//! the tiles of a page are dropped when the page is laid out again.
+//! Everything interactive (selection, cursors, markers and etc) is painted on top of them.
+class NotationTileCache
+{
+public:
+    static constexpr int TILE_PIXEL_SIZE = 512;
+
+    struct PaintResult {
+        size_t visibleTiles = 0;
+        size_t paintedTiles = 0;
+        size_t pendingTiles = 0; // painted directly, will be rasterised on the next frames
+    };
+
+    void clear();
+
+    //! NOTE The rect is in canvas coordinates
+    void invalidate(const muse::RectF& rect);
+
+    //! NOTE The content might have changed without a relayout, so the cache
+    //! is dropped on the next paint if none of the pages was laid out again
+    void invalidateIfLayoutUnchanged();
+
+    //! NOTE The painter transform must map the canvas to the device, `pixelScale` is the count of device pixels per canvas unit.
+    //! If some tiles are pending, the view should be painted again
+    PaintResult paint(QPainter* painter, INotationPaintingPtr painting, const std::vector<Page*>& pages, const muse::RectF& frameRect,
+                      double pixelScale, bool isPrinting);
+
+private:
+    struct TileKey {
+        const Page* page = nullptr;
+        int64_t scale = 0;
+        int column = 0;
+        int row = 0;
+
+        bool operator<(const TileKey& other) const
+        {
+            return std::tie(page, scale, column, row) < std::tie(other.page, other.scale, other.column, other.row);
+        }
+    };
+
+    struct Tile {
+        QImage image;
+        muse::RectF rect; // in page coordinates
+        muse::RectF canvasRect;
+        uint64_t lastUsedFrame = 0;
+    };
+
+    bool syncPageRevisions(const std::vector<Page*>& pages);
+    void removePageTiles(const Page* page);
+    void removeUnusedTiles();
+
+    std::map<TileKey, Tile> m_tiles;
+    std::map<const Page*, uint64_t> m_pageRevisions;
+
+    uint64_t m_frame = 0;
+    bool m_invalidateIfLayoutUnchanged = false;
+};
+}
+
+#endif // MU_NOTATION_NOTATIONTILECACHE_H
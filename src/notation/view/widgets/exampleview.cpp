@@ -153,7 +153,6 @@ void ExampleView::drawBackground(Painter* p, const RectF& r) const
 void ExampleView::drawElements(Painter& painter, const std::vector<EngravingItem*>& el)
 {
     for (EngravingItem* e : el) {
-        e->itemDiscovered = 0;
         PointF pos(e->pagePos());
         painter.translate(pos);
         e->renderer()->drawItem(e, &painter);
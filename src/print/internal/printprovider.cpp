@@ -24,6 +24,8 @@
 #include <QPrinter>
 #include <QPrintDialog>
 
+#include "engraving/dom/score.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -55,6 +57,8 @@ Ret PrintProvider::printNotation(INotationPtr notation)
     printerDev.setColorMode(QPrinter::Color);
     printerDev.setDocName(notation->projectWorkTitleAndPartName());
     printerDev.setOutputFormat(QPrinter::NativeFormat);
+    //! NOTE A score opened in the app may still be laid out progressively
+    notation->elements()->msScore()->ensureLayoutComplete();
     printerDev.setFromTo(1, painting->pageCount());
 
     QPrintDialog pd(&printerDev, 0);
@@ -23,8 +23,11 @@
 #ifndef MU_PROJECT_INOTATIONWRITER_H
 #define MU_PROJECT_INOTATIONWRITER_H
 
+#include <functional>
 #include <map>
+#include <vector>
 
+#include "global/types/bytearray.h"
 #include "global/types/ret.h"
 #include "global/types/val.h"
 #include "global/io/iodevice.h"
@@ -49,11 +52,18 @@ public:
         UNIT_TYPE,
         PAGE_NUMBER,
         TRANSPARENT_BACKGROUND,
-        BEATS_COLORS
+        BEATS_COLORS,
+        STREAM_OUTPUT, // bool: write to the device in chunks while writing, instead of all at once at the end
+        ELEMENT_IDS, // bool: SVG only, group the output of each element under its EID, for highlighting on the web
+        BINARY_OUTPUT, // bool: positions only, write the compact delta-encoded format instead of XML
+        SINCE_LAYOUT_REVISION // int64: positions only, binary output: write records only for systems laid out after this revision,
+                              // revisions are per process, compare the session id of the output before reusing them
     };
 
     using Options = std::map<OptionKey, muse::Val>;
 
+    using PageWrittenCallback = std::function<muse::Ret (size_t pageIndex, const muse::ByteArray& data)>;
+
     virtual std::vector<UnitType> supportedUnitTypes() const = 0;
     virtual bool supportsUnitType(UnitType unitType) const = 0;
 
@@ -61,6 +71,14 @@ public:
     virtual muse::Ret writeList(const notation::INotationPtrList& notations, muse::io::IODevice& device,
                                 const Options& options = Options()) = 0;
 
+    //! NOTE Writes each of the given pages, calling onPageWritten on the calling thread in page order.
+    //! Writers may set up the score once for all the pages; the score must not change until it returns
+    virtual muse::Ret writePages(notation::INotationPtr /*notation*/, const std::vector<size_t>& /*pageIndexes*/,
+                                 const PageWrittenCallback& /*onPageWritten*/, const Options& /*options*/ = Options())
+    {
+        return muse::make_ret(muse::Ret::Code::NotSupported);
+    }
+
     virtual muse::Progress* progress() { return nullptr; }
     virtual void abort() {}
 };
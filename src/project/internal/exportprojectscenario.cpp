@@ -176,6 +176,11 @@ bool ExportProjectScenario::exportScores(const notation::INotationPtrList& notat
     // not reach this point. But if we do, existing files should be overridden.
     m_fileConflictPolicy = isCreatingOnlyOneFile ? FileConflictPolicy::ReplaceAll : FileConflictPolicy::Undefined;
 
+    //! NOTE A score opened in the app may still be laid out progressively
+    for (const INotationPtr& notation : notations) {
+        notation->elements()->msScore()->ensureLayoutComplete();
+    }
+
     INotationWriter::Options options {
         { INotationWriter::OptionKey::UNIT_TYPE, Val(unitType) },
     };
@@ -277,6 +282,7 @@ bool ExportProjectScenario::guessIsCreatingOnlyOneFile(const notation::INotation
             if (it == potentialExcerpts.cend()) {
                 ViewMode viewMode = notation->painting()->viewMode();
                 notation->painting()->setViewMode(ViewMode::PAGE);
+                notations.front()->elements()->msScore()->ensureLayoutComplete();
 
                 bool onePage = notations.front()->elements()->pages().size() == 1;
 
@@ -304,6 +310,7 @@ size_t ExportProjectScenario::exportFileCount(const INotationPtrList& notations,
         size_t count = 0;
 
         for (const INotationPtr& notation : notations) {
+            notation->elements()->msScore()->ensureLayoutComplete();
             count += notation->elements()->pages().size();
         }
 
@@ -29,6 +29,7 @@
 #include "global/io/file.h"
 #include "global/io/ioretcodes.h"
 
+#include "engraving/dom/excerpt.h"
 #include "engraving/dom/undo.h"
 
 #include "engraving/dom/masterscore.h"
@@ -198,7 +199,14 @@ Ret NotationProject::doLoad(const muse::io::path_t& path, const muse::io::path_t
     mu::engraving::compat::EngravingCompat::doPreLayoutCompatIfNeeded(m_engravingProject->masterScore());
 
     masterScore->lockUpdates(false);
+    masterScore->setLayoutPageLimit(configuration()->progressiveLayoutPages());
     masterScore->setLayoutAll();
+
+    //! NOTE The parts are laid out when they are shown or exported
+    for (mu::engraving::Excerpt* excerpt : masterScore->excerpts()) {
+        excerpt->excerptScore()->setLayoutDeferred(true);
+    }
+
     masterScore->update();
 
     mu::engraving::compat::EngravingCompat::doPostLayoutCompatIfNeeded(m_engravingProject->masterScore());
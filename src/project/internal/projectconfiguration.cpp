@@ -63,6 +63,7 @@ static const Settings::Key GENERATE_AUDIO_TIME_PERIOD_TYPE_KEY(module_name, "pro
 static const Settings::Key NUMBER_OF_SAVES_TO_GENERATE_AUDIO_KEY(module_name, "project/numberOfSavesToGenerateAudio");
 static const Settings::Key SHOW_CLOUD_IS_NOT_AVAILABLE_WARNING(module_name, "project/showCloudIsNotAvailableWarning");
 static const Settings::Key DISABLE_VERSION_CHECKING(module_name, "project/disableVersionChecking");
+static const Settings::Key PROGRESSIVE_LAYOUT_PAGES(module_name, "project/progressiveLayoutPages");
 
 static const std::string DEFAULT_FILE_SUFFIX(".mscz");
 static const std::string DEFAULT_FILE_FILTER("*.mscz");
@@ -117,6 +118,7 @@ void ProjectConfiguration::init()
     settings()->setDefaultValue(SHOW_CLOUD_IS_NOT_AVAILABLE_WARNING, Val(true));
 
     settings()->setDefaultValue(DISABLE_VERSION_CHECKING, Val(false));
+    settings()->setDefaultValue(PROGRESSIVE_LAYOUT_PAGES, Val(4));
 
     if (!userTemplatesPath().empty()) {
         fileSystem()->makePath(userTemplatesPath());
@@ -679,3 +681,15 @@ void ProjectConfiguration::setDisableVersionChecking(bool disable)
 {
     settings()->setSharedValue(DISABLE_VERSION_CHECKING, Val(disable));
 }
+
+size_t ProjectConfiguration::progressiveLayoutPages() const
+{
+    //! NOTE Only the app shows the score while it is being laid out, the converter gets a complete layout.
+    //! In the app, plugins (PluginAPI::curScore), edits and selections complete the layout when they need it
+    if (!application() || application()->runMode() != muse::IApplication::RunMode::GuiApp) {
+        return 0;
+    }
+
+    int pages = settings()->value(PROGRESSIVE_LAYOUT_PAGES).toInt();
+    return pages > 0 ? static_cast<size_t>(pages) : 0;
+}
@@ -26,6 +26,7 @@
 
 #include "modularity/ioc.h"
 #include "global/iglobalconfiguration.h"
+#include "global/iapplication.h"
 #include "io/ifilesystem.h"
 #include "accessibility/iaccessibilityconfiguration.h"
 #include "notation/inotationconfiguration.h"
@@ -43,6 +44,7 @@ class ProjectConfiguration : public IProjectConfiguration
     INJECT(muse::accessibility::IAccessibilityConfiguration, accessibilityConfiguration)
     INJECT(muse::io::IFileSystem, fileSystem)
     INJECT(muse::languages::ILanguagesService, languagesService)
+    INJECT(muse::IApplication, application)
 
 public:
     void init();
@@ -155,6 +157,8 @@ public:
     bool disableVersionChecking() const override;
     void setDisableVersionChecking(bool disable) override;
 
+    size_t progressiveLayoutPages() const override;
+
 private:
     muse::io::path_t appTemplatesPath() const;
     muse::io::path_t legacyCloudProjectsPath() const;
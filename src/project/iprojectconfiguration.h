@@ -160,6 +160,10 @@ public:
 
     virtual bool disableVersionChecking() const = 0;
     virtual void setDisableVersionChecking(bool disable) = 0;
+
+    //! NOTE The number of pages laid out while a score is opened, the rest is laid out afterwards.
+    //! 0 means the whole score is laid out at once
+    virtual size_t progressiveLayoutPages() const = 0;
 };
 }
 
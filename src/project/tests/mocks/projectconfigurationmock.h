@@ -137,6 +137,8 @@ public:
 
     MOCK_METHOD(bool, disableVersionChecking, (), (const, override));
     MOCK_METHOD(void, setDisableVersionChecking, (bool), (override));
+
+    MOCK_METHOD(size_t, progressiveLayoutPages, (), (const, override));
 };
 }
 
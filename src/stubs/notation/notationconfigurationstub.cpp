@@ -350,6 +350,39 @@ muse::async::Notification NotationConfigurationStub::isLimitCanvasScrollAreaChan
     return n;
 }
 
+bool NotationConfigurationStub::isTiledRenderingEnabled() const
+{
+    return false;
+}
+
+void NotationConfigurationStub::setIsTiledRenderingEnabled(bool)
+{
+}
+
+muse::async::Notification NotationConfigurationStub::isTiledRenderingEnabledChanged() const
+{
+    static muse::async::Notification n;
+    return n;
+}
+
+double NotationConfigurationStub::simplifiedPaintingSpatiumSize() const
+{
+    return 0.0;
+}
+
+void NotationConfigurationStub::setSimplifiedPaintingSpatiumSize(double)
+{
+}
+
+double NotationConfigurationStub::staffLinesOnlyPaintingSpatiumSize() const
+{
+    return 0.0;
+}
+
+void NotationConfigurationStub::setStaffLinesOnlyPaintingSpatiumSize(double)
+{
+}
+
 bool NotationConfigurationStub::colorNotesOutsideOfUsablePitchRange() const
 {
     return false;
@@ -133,6 +133,15 @@ public:
     void setIsLimitCanvasScrollArea(bool limited)  override;
     muse::async::Notification isLimitCanvasScrollAreaChanged() const override;
 
+    bool isTiledRenderingEnabled() const override;
+    void setIsTiledRenderingEnabled(bool enabled) override;
+    muse::async::Notification isTiledRenderingEnabledChanged() const override;
+
+    double simplifiedPaintingSpatiumSize() const override;
+    void setSimplifiedPaintingSpatiumSize(double size) override;
+    double staffLinesOnlyPaintingSpatiumSize() const override;
+    void setStaffLinesOnlyPaintingSpatiumSize(double size) override;
+
     bool colorNotesOutsideOfUsablePitchRange() const override;
     void setColorNotesOutsideOfUsablePitchRange(bool value)  override;
 